@@ -70,6 +70,7 @@ int main(int argc, char **argv)
     }
 
     InitializeSearchSpace(s, _GP_); /* It initalizes the search space */
+    SetBinarySearchSpace(s, _GP_);  /* The trees are run over bit-packed terminals */
 
     s->pReproduction = 0.3;                                /* Setting up the probability of reproduction */
     s->pMutation = 0.4;                                    /* Setting up the probability of mutation */
@@ -0,0 +1,49 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "common.h"
+#include "function.h"
+#include "pso.h"
+
+/* It defines the constraint x[0] + x[1] >= 1, i.e., 1 - x[0] - x[1] <= 0 */
+double HalfPlane(Agent *a, va_list arg)
+{
+    return 1 - a->x[0] - a->x[1];
+}
+
+int main()
+{
+
+    SearchSpace *s = NULL;
+    prtConstraint constraint[] = {HalfPlane};
+
+    s = ReadSearchSpaceFromFile("examples/model_files/pso_model.txt", _PSO_); /* It reads the model file and creates a search space. We are going to use PSO to solve our problem. */
+    s->iterations = 100;
+
+    SetConstraints(s, 1, constraint); /* Infeasible agents are discarded before calling the fitness function */
+
+    InitializeSearchSpace(s, _PSO_); /* It initalizes the search space */
+
+    if (CheckSearchSpace(s, _PSO_)) /* It checks wether the search space is valid or not */
+        runPSO(s, Sphere);          /* It minimizes function Sphere subject to the constraint (optimum at x = (0.5, 0.5)) */
+
+    fprintf(stderr, "\nBest solution: (%lf, %lf) with fitness %lf", s->g[0], s->g[1], s->gfit);
+    fprintf(stderr, "\nInfeasible agents discarded: %ld\n", s->stop.n_infeasible);
+
+    DestroySearchSpace(&s, _PSO_); /* It deallocates the search space */
+
+    return 0;
+}
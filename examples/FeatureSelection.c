@@ -0,0 +1,85 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "common.h"
+#include "pso.h"
+#include "ga.h"
+#include "hs.h"
+
+/* It defines a toy feature selection problem: the fitness value of an agent is the number of features it disagrees with
+a hidden subset of relevant features, which is given as a bit-packed array */
+double SelectionError(Agent *a, va_list arg)
+{
+    uint64_t *relevant = va_arg(arg, uint64_t *);
+
+    return (double)HammingDistance(a->b, relevant, a->n);
+}
+
+int main()
+{
+
+    SearchSpace *s = NULL;
+    int j, n = 50000;
+    uint64_t *relevant = NULL;
+
+    relevant = (uint64_t *)calloc(getBinaryWords(n), sizeof(uint64_t));
+    for (j = 0; j < n; j += 7) /* every seventh feature is relevant */
+        SetBinaryBit(relevant, j, 1);
+
+    /* Binary PSO */
+    s = CreateSearchSpace(20, n, _PSO_); /* It creates a search space with 20 particles and 50000 features */
+    SetBinarySearchSpace(s, _PSO_);      /* Each particle is stored as 50000 bits instead of 50000 doubles */
+    s->iterations = 50;
+    s->w = 0.7;
+    s->w_min = 0.7; /* w_min and w_max are only used by AIWPSO, but they are checked for every PSO search space */
+    s->w_max = 0.7;
+    s->c1 = 2;
+    s->c2 = 2;
+    InitializeSearchSpace(s, _PSO_);
+    if (CheckSearchSpace(s, _PSO_))
+        runBPSO(s, SelectionError, relevant);
+    fprintf(stderr, "\n\nBPSO: %d features selected, %.0lf wrong ones\n", CountBinaryOnes(s->gb, n), s->gfit);
+    DestroySearchSpace(&s, _PSO_);
+
+    /* Binary GA */
+    s = CreateSearchSpace(20, n, _GA_);
+    SetBinarySearchSpace(s, _GA_);
+    s->iterations = 50;
+    s->pMutation = 0.2;
+    s->selection = _TOURNAMENT_;
+    InitializeSearchSpace(s, _GA_);
+    if (CheckSearchSpace(s, _GA_))
+        runBGA(s, SelectionError, relevant);
+    fprintf(stderr, "\n\nBGA: %d features selected, %.0lf wrong ones\n", CountBinaryOnes(s->gb, n), s->gfit);
+    DestroySearchSpace(&s, _GA_);
+
+    /* Binary HS */
+    s = CreateSearchSpace(20, n, _HS_);
+    SetBinarySearchSpace(s, _HS_);
+    s->iterations = 50;
+    s->HMCR = 0.9;
+    s->PAR = 0.01; /* the pitch adjustment flips a bit, so bw, bw_min, bw_max, PAR_min and PAR_max are not used */
+    s->PAR_min = s->PAR_max = s->PAR;
+    s->bw = s->bw_min = s->bw_max = 1;
+    InitializeSearchSpace(s, _HS_);
+    if (CheckSearchSpace(s, _HS_))
+        runBHS(s, SelectionError, relevant);
+    fprintf(stderr, "\n\nBHS: %d features selected, %.0lf wrong ones\n", CountBinaryOnes(s->gb, n), s->gfit);
+    DestroySearchSpace(&s, _HS_);
+
+    free(relevant);
+
+    return 0;
+}
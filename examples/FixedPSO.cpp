@@ -0,0 +1,38 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libopt.hpp"
+
+int main()
+{
+
+    SearchSpace *s = NULL;
+
+    s = ReadSearchSpaceFromFile((char *)"examples/model_files/pso_model.txt", _PSO_); /* It reads the model file and creates a search space. We are going to use PSO to solve our problem. */
+
+    InitializeSearchSpace(s, _PSO_); /* It initalizes the search space */
+
+    if (CheckSearchSpace(s, _PSO_)) /* It checks wether the search space is valid or not */
+    {
+        libopt::PSO<2> pso(s); /* The model file defines 2 decision variables, which is fixed at compile time */
+
+        pso.run(libopt::Function<2>(Sphere)); /* It minimizes function Sphere */
+        fprintf(stderr, "\nMinimum fitness value %lf at (%lf, %lf)\n", s->gfit, s->g[0], s->g[1]);
+    }
+
+    DestroySearchSpace(&s, _PSO_); /* It deallocates the search space */
+
+    return 0;
+}
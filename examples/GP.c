@@ -16,6 +16,7 @@ limitations under the License.
 #include "common.h"
 #include "function.h"
 #include "gp.h"
+#include "jit.h"
 
 int main(int argc, char **argv)
 {
@@ -98,6 +99,7 @@ int main(int argc, char **argv)
     s = NULL;
     s = ReadSearchSpaceFromFile(argv[1], _GP_);
     InitializeSearchSpace(s, _GP_); /* It initalizes the search space */
+    s->jit = 1; /* trees that survive several generations are executed as native code, if it pays off */
 
     if (CheckSearchSpace(s, _GP_))
         runGP(s, Sphere); /* It minimizes function Sphere */
@@ -105,6 +107,7 @@ int main(int argc, char **argv)
         fprintf(stderr, "\nPlease, check your GP configuration prior running it.\n");
 
     PrintTree2File(s, s->T[s->best], "best_tree.txt"); /* It saves the best tree */
+    ExportTree2C(s, s->T[s->best], "best_tree.c", "BestTree"); /* It saves the best tree as a standalone C function */
 
     DestroySearchSpace(&s, _GP_);
     /**************************************************************************/
@@ -0,0 +1,57 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <stdio.h>
+#include "libopt.h"
+
+/* It computes the Sphere function */
+double Sphere(const double *x, int n, void *data)
+{
+    int i;
+    double sum = 0;
+
+    for (i = 0; i < n; i++)
+        sum += x[i] * x[i];
+
+    return sum;
+}
+
+int main()
+{
+
+    LibOptHandle *h = NULL;
+    double LB[2] = {-5.12, -5.12}, UB[2] = {5.12, 5.12}, x[2];
+
+    h = LibOptCreate("PSO", 10, 2); /* It creates a handle with 10 particles and 2 decision variables. We are going to use PSO to solve our problem. */
+
+    /* It configures the technique */
+    LibOptSetBounds(h, LB, UB);
+    LibOptSetInt(h, "iterations", 10);
+    LibOptSetDouble(h, "c1", 1.7);
+    LibOptSetDouble(h, "c2", 1.7);
+    LibOptSetDouble(h, "w", 0.7);
+    LibOptSetDouble(h, "w_min", 0.5);
+    LibOptSetDouble(h, "w_max", 1.5);
+
+    if (LibOptRun(h, Sphere, NULL)) /* It minimizes function Sphere */
+    {
+        LibOptGetBest(h, x);
+        fprintf(stderr, "\nMinimum fitness value %lf at (%lf, %lf)\n", LibOptGetBestFitness(h), x[0], x[1]);
+    }
+
+    LibOptDestroy(&h); /* It deallocates the handle */
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "common.h"
+#include "pso.h"
+#include "ga.h"
+
+/* It defines the ZDT1 problem, whose Pareto front is f[1] = 1 - sqrt(f[0]) for x[0] in [0,1] and x[j] = 0 otherwise */
+void ZDT1(Agent *a, double *f, va_list arg)
+{
+    int j;
+    double g = 0;
+
+    for (j = 1; j < a->n; j++)
+        g += a->x[j];
+    g = 1 + 9 * g / (a->n - 1);
+
+    f[0] = a->x[0];
+    f[1] = g * (1 - sqrt(a->x[0] / g));
+}
+
+int main()
+{
+
+    SearchSpace *s = NULL;
+    int i, j, n = 10;
+
+    s = CreateSearchSpace(50, n, _PSO_); /* It creates a search space with 50 particles and 10 decision variables within [0,1] */
+    s->iterations = 100;
+    s->w = 0.4;
+    s->w_min = 0.4; /* w_min and w_max are only used by AIWPSO, but they are checked for every PSO search space */
+    s->w_max = 0.4;
+    s->c1 = 1.5;
+    s->c2 = 1.5;
+    for (j = 0; j < n; j++)
+    {
+        s->LB[j] = 0;
+        s->UB[j] = 1;
+    }
+
+    s->archive = CreateArchive(n, 2, 100); /* It keeps up to 100 non-dominated solutions of two objectives */
+
+    InitializeSearchSpace(s, _PSO_); /* It initalizes the search space */
+
+    if (CheckSearchSpace(s, _PSO_)) /* It checks wether the search space is valid or not */
+        runMOPSO(s, ZDT1);          /* It minimizes both objectives of ZDT1 at once (runNSGA2 works the same way with a GA search space) */
+
+    fprintf(stderr, "\n\nApproximation of the Pareto front (%d solutions):", s->archive->size);
+    for (i = 0; i < s->archive->size; i += 10)
+        fprintf(stderr, "\nf = (%lf, %lf)", s->archive->f[2 * i], s->archive->f[2 * i + 1]);
+    fprintf(stderr, "\n");
+
+    DestroySearchSpace(&s, _PSO_); /* It deallocates the search space and its archive */
+
+    return 0;
+}
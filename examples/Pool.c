@@ -0,0 +1,52 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "common.h"
+#include "function.h"
+#include "pso.h"
+
+int main()
+{
+
+    SearchSpacePool *pool = NULL;
+    SearchSpace *s = NULL;
+    int i, j;
+
+    pool = CreateSearchSpacePool(1); /* It creates a pool that keeps a single search space */
+
+    /* It solves a sequence of problems with the same shape, but different boundaries */
+    for (i = 1; i <= 5; i++)
+    {
+        s = AcquireSearchSpace(pool, 10, 2, _PSO_); /* It reuses the search space of the previous problem, if any */
+        if (!s)
+            s = ReadSearchSpaceFromFile("examples/model_files/pso_model.txt", _PSO_); /* It creates the search space only once */
+
+        for (j = 0; j < s->n; j++)
+        {
+            s->LB[j] = -i;
+            s->UB[j] = 2 * i;
+        }
+        ResetSearchSpace(s, _PSO_); /* It re-initializes the search space for the new problem */
+
+        if (CheckSearchSpace(s, _PSO_)) /* It checks wether the search space is valid or not */
+            runPSO(s, Sphere);          /* It minimizes function Sphere */
+
+        ReleaseSearchSpace(pool, &s, _PSO_); /* It gives the search space back to the pool */
+    }
+
+    DestroySearchSpacePool(&pool); /* It deallocates the pool and its search space */
+
+    return 0;
+}
@@ -0,0 +1,36 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "common.h"
+#include "function.h"
+#include "pso.h"
+#include "restart.h"
+
+int main()
+{
+
+    SearchSpace *s = NULL;
+
+    s = ReadSearchSpaceFromFile("examples/model_files/pso_model.txt", _PSO_); /* It reads the model file and creates a search space. We are going to use PSO to solve our problem. */
+
+    SetTermination(s, 5000, 0, 5, 1e-6); /* It shares a budget of 5000 evaluations among the runs, and restarts PSO after 5 iterations with no improvement */
+
+    if (CheckSearchSpace(s, _PSO_))                         /* It checks wether the search space is valid or not */
+        runRestart(s, _PSO_, _BIPOP_, 8, runPSO, Rastrigin); /* It minimizes function Rastrigin with up to 8 BIPOP restarts */
+
+    DestroySearchSpace(&s, _PSO_); /* It deallocates the search space */
+
+    return 0;
+}
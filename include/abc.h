@@ -21,6 +21,7 @@ limitations under the License.
 
 #include "opt.h"
 
+void ApplyBeeTrials(SearchSpace *s, Agent **candidate, int *source, int n_trials, int *trial, prtFun Evaluate, va_list arg); /* It evaluates a batch of bee trials and applies the greedy selection */
 void runABC(SearchSpace *s, prtFun Evaluate, ...); /* It executes the Artificial Bee Colony for function minimization */
 void runTensorABC(SearchSpace *s, int tensor_id, prtFun Evaluate, ...); /* It executes the Tensor-based Artificial Bee Colony for function minimization */
 
@@ -20,6 +20,9 @@ limitations under the License.
 
 /* General-Purpose variables */
 #define LINE_SIZE 128 /* It limits the number of characters in a line when reading from model files */
+#define LEVY_BLOCK_SIZE 256 /* It defines the number of Levy steps drawn at once by GenerateLevyDistributionArray */
+#define NUMA_MAX_CPUS 1024 /* It limits the identifiers of the CPUs and NUMA nodes read from sysfs */
+#define BINARY_WORD_SIZE 64 /* It defines the number of decision variables packed into each word of a binary position */
 /*****************************/
 
 /* It defines the node of the tree used to implement GP */
@@ -30,8 +33,54 @@ typedef struct _Node{
     char left_son; /* Flag to identify whether the node is a son placed on the left or on the right */
     struct _Node *right, *left, *parent; /* Pointers to the subtrees on the right, left and parent */
     double *val; /* used for Geometric Semantic GP */
+    uint64_t *bval; /* bit-packed val, used instead of it by binary search spaces (see SetBinarySearchSpace) */
+    int n; /* number of decision variables of val (NEW_TERMINAL nodes only) */
 }Node;
 
+/* It defines the node of a linear tree, i.e., a tree stored as an array of nodes in prefix order */
+typedef struct _LinearNode{
+    int status; /* It defines the status of a given node (TERMINAL|FUNCTION|CONSTANT) */
+    int id; /* Identifier of the node (its position in the array of terminals, functions or constants) */
+    int op; /* Identifier of the function (e.g., _SUM_), only used by function nodes */
+    int size; /* Number of nodes of the subtree rooted at this node */
+    int parent; /* Position of the parent node (-1 for the root) */
+}LinearNode;
+
+/* It defines a linear tree. The subtree rooted at node i is node[i..i+node[i].size-1], and its first child (if any) is node i+1 */
+typedef struct _LinearTree{
+    int size; /* number of nodes */
+    int capacity; /* number of allocated nodes */
+    LinearNode *node; /* nodes in prefix order */
+}LinearTree;
+
+/* It defines a cache of subtree outputs used to evaluate a population of linear trees. Subtrees are looked up by a structural
+hash and then compared node by node with the first occurrence, so a hash collision never returns the output of another subtree:
+the subtrees of the population are counted first, and the ones that appear more than once (e.g., copied from the same ancestors)
+are computed only once. The outputs depend on the terminals, so the cache is cleared before each evaluation of the population,
+and the counted trees must not be changed or deallocated until then. */
+typedef struct _TreeCache{
+    long int budget; /* memory budget (in bytes) */
+    int capacity; /* maximum number of cached outputs, given by the memory budget */
+    int size; /* number of cached outputs */
+    int width; /* number of values of each output */
+    int n_slots; /* number of slots of the hash table (a power of two) */
+    int used; /* number of slots in use */
+    int generation; /* current generation: slots stamped with an older one are empty */
+    int *stamp; /* generation of each slot */
+    unsigned long long *key; /* structural hash of the subtree of each slot */
+    int *subtree; /* number of nodes of the subtree of each slot */
+    const LinearNode **origin; /* first occurrence of the subtree of each slot (its root within the tree it was counted in) */
+    int *count; /* number of occurrences of the subtree of each slot */
+    int *entry; /* position of the output of the subtree of each slot (-1 if it has not been stored) */
+    double *value; /* outputs (capacity x width), in the same order as they have been stored */
+    int scratch_size; /* number of nodes the working memory below has room for */
+    unsigned long long *hash; /* working memory: structural hash of each node of the tree being evaluated */
+    int *slot; /* working memory: slot of each shared subtree of the tree being evaluated (-1 for the other nodes) */
+    int *plan; /* working memory: nodes of the tree being evaluated that are not inside a cached subtree */
+    long int hits; /* number of subtrees read from the cache */
+    long int misses; /* number of shared subtrees computed and stored in the cache */
+}TreeCache;
+
 /* It defines a general-purpose structure */
 typedef struct _Data{
     int id;
@@ -44,12 +93,17 @@ typedef struct Agent_{
     int n; /* number of decision variables */
     double *x; /* position */
     double fit; /* fitness value */
+    double cv; /* constraint violation, i.e., the sum of the positive constraint values (0 if the agent is feasible) */
     double **t; /* tensor */
 
     /* PSO */
     double *v; /* velocity */
     double *xl; /* local best */
 
+    /* Binary techniques (see SetBinarySearchSpace) */
+    uint64_t *b; /* bit-packed position, used instead of x */
+    uint64_t *bl; /* bit-packed local best, used instead of xl */
+
     /* AIWPSO, LOA */
     double pfit; /* fitness value of the previous iteration */
 
@@ -71,10 +125,90 @@ typedef struct Agent_{
 
 }Agent;
 
+typedef double (*prtConstraint)(Agent *, va_list arg); /* Pointer to a constraint function g, such that g(x) <= 0 for feasible agents */
+typedef void (*prtTreeKernel)(double **terminal, double **constant, double *out, int n); /* native code of a GP tree (see jit.h) */
+typedef void (*prtMOFun)(Agent *, double *f, va_list arg); /* Pointer to the function used to evaluate agents on several objectives (to be minimized), which are written at f */
+
+/* Reasons for stopping an optimization run */
+#define _STOP_ITERATIONS_ 1 /* maximum number of iterations */
+#define _STOP_EVALUATIONS_ 2 /* evaluation budget */
+#define _STOP_TIME_ 3 /* wall-clock deadline */
+#define _STOP_STAGNATION_ 4 /* no improvement of the global best fitness */
+
+/* It defines the termination criteria shared by all optimization techniques.
+Any limit set to zero is disabled, and the maximum number of iterations (s->iterations) always applies. */
+typedef struct _Termination{
+    long int max_evaluations; /* maximum number of calls to the fitness function */
+    double max_time; /* wall-clock deadline (in seconds) counted from the beginning of the run */
+    int max_stagnation; /* maximum number of iterations with no improvement of the global best fitness */
+    double tolerance; /* minimum improvement of the global best fitness to reset the stagnation counter */
+
+    long int n_evaluations; /* number of calls to the fitness function so far */
+    long int n_infeasible; /* number of infeasible agents discarded without calling the fitness function so far */
+    double start_time; /* time at which the run started (in seconds) */
+    int stagnation; /* number of iterations with no improvement so far */
+    double last_gfit; /* global best fitness at the last improvement */
+    int reason; /* reason why the last run stopped */
+}Termination;
+
+/* It defines a surrogate model used to pre-screen candidate agents: an inverse distance-weighted k-nearest neighbours
+regressor built on a bounded archive of evaluated points, which is updated at each call to the fitness function */
+typedef struct _Surrogate{
+    int n; /* number of decision variables */
+    int capacity; /* maximum number of points in the archive (the oldest ones are replaced first) */
+    int size; /* number of points in the archive */
+    int next; /* position of the next point to be stored */
+    int k; /* number of neighbours used for prediction */
+    double ratio; /* fraction of the candidates that are actually evaluated */
+    double *X; /* positions of the archive (capacity x n, row-wise) */
+    double *f; /* fitness values of the archive */
+    Data *nn; /* scratch buffer with the k nearest neighbours, for the predictions that are never made concurrently */
+    Data *rank; /* scratch buffer used to rank the candidates of a search space */
+    double *pred; /* scratch buffer with the predicted fitness of the candidates of a search space */
+    char *selected; /* scratch buffer with the candidates of a search space selected to be evaluated */
+    int rank_size; /* size of the scratch buffers rank, pred and selected */
+    long int n_skipped; /* number of evaluations avoided so far */
+}Surrogate;
+
+/* It defines an external archive of mutually non-dominated solutions used by the multi-objective techniques. Solutions are
+added one at a time as they are evaluated, and the most crowded one is discarded whenever the archive overflows. With two
+objectives the archive is kept sorted by the first one, so checking and inserting a solution costs O(log size) comparisons */
+typedef struct _Archive{
+    int n; /* number of decision variables */
+    int n_objectives; /* number of objectives */
+    int capacity; /* maximum number of solutions in the archive */
+    int size; /* number of solutions in the archive */
+    double *X; /* positions of the archive (capacity x n, row-wise) */
+    double *f; /* objectives of the archive (capacity x n_objectives, row-wise) */
+    double *crowding; /* crowding distance of each solution (see CrowdingArchive) */
+    int *index; /* scratch buffer of indices used to compute the crowding distances */
+    long int n_updates; /* number of solutions accepted so far */
+}Archive;
+
+/* It defines a sampler that draws indices with given probabilities in O(1) each (Walker's alias method). It is built in O(size)
+and keeps its buffers, so it can be rebuilt with new weights at no allocation */
+typedef struct _Sampler{
+    int capacity; /* maximum number of outcomes */
+    int size; /* number of outcomes */
+    double *prob; /* probability of keeping each outcome instead of its alias */
+    int *alias; /* alias of each outcome */
+    int *stack; /* scratch buffer with the outcomes of probability below and above the average */
+}Sampler;
+
+/* It defines the NUMA topology of the machine, as read from sysfs (/sys/devices/system/node), restricted to the CPUs
+the process may run on. Machines without such information are seen as a single node. */
+typedef struct _Topology{
+    int n_nodes; /* number of NUMA nodes with CPUs available to the process */
+    int *node_id; /* identifier of each node in sysfs */
+    int *n_cpus; /* number of available CPUs of each node */
+    int **cpu; /* identifiers of the available CPUs of each node */
+}Topology;
+
 /* It defines the search space */
 typedef struct SearchSpace_{
     /* common definitions */
     int m; /* number of agents (solutions) */
+    int m_alloc; /* number of allocated agents (it may be greater than m after shrinking the population) */
     int n; /* number of decision variables */
     int iterations; /* number of iterations for convergence */
     Agent **a; /* array of pointers to agents */
@@ -85,7 +219,18 @@ typedef struct SearchSpace_{
     int best; /* index of the best agent */
     double gfit; /* global best fitness */
     int is_integer_opt; /* integer-valued optimization problem? */
+    int is_binary_opt; /* binary-valued optimization problem, whose agents are bit-packed? (see SetBinarySearchSpace) */
+    uint64_t *gb; /* bit-packed global best agent (binary search spaces only) */
     int tensor_dim; /* dimension of the tensor */
+    Termination stop; /* termination criteria */
+    Surrogate *surrogate; /* surrogate model used to pre-screen candidates (NULL if it is not used) */
+    Archive *archive; /* archive of non-dominated solutions of the multi-objective techniques (NULL if they are not used) */
+    int n_threads; /* number of workers used by the techniques that support a parallel mode (1 means sequential) */
+    int numa; /* NUMA-aware parallel mode, with pinned workers and agents placed on their nodes? (see SetNUMASearchSpace) */
+    Topology *topology; /* NUMA topology used to pin the workers (NULL if the NUMA-aware mode is not used) */
+    int n_constraints; /* number of inequality constraints (0 if the problem is unconstrained) */
+    prtConstraint *constraint; /* constraint functions */
+    double gcv; /* constraint violation of the global best agent (it only matters while no feasible agent has been found, i.e., gfit is DBL_MAX) */
 
     /* PSO */
     double w; /* inertia weight */
@@ -113,6 +258,8 @@ typedef struct SearchSpace_{
     double pReproduction; /* probability of reproduction */
     double pMutation; /* probability of mutation */
     double pCrossover; /* probability of crossover */
+    int selection; /* selection method of GA (_ROULETTE_ or _TOURNAMENT_) */
+    int tournament_size; /* number of agents that take part in each tournament of GA */
 
     /* WCA */
     int nsr; /* number of rivers */
@@ -121,6 +268,8 @@ typedef struct SearchSpace_{
     /* GP */
     int min_depth; /* minimum depth of a tree */
     int max_depth; /* maximum depth of a tree */
+    int max_tree_depth; /* maximum depth of an offspring tree (0 disables the limit) */
+    int max_tree_size; /* maximum number of nodes of an offspring tree (0 disables the limit) */
     int n_terminals; /* number of terminals */
     int n_functions; /* number of functions */
     int n_constants; /* number of constants */
@@ -129,6 +278,11 @@ typedef struct SearchSpace_{
     double **constant; /* matrix with the random constants */
     Node **T; /* pointer to the tree */
     double *tree_fit; /* fitness of each tree (in GP, the number of agents is different from the number of trees) */
+    long int cache_budget; /* memory budget (in bytes) of the subtree cache shared by the trees during evaluation (0 disables it) */
+    TreeCache **tree_cache; /* subtree cache of each thread */
+    int n_tree_caches; /* number of subtree caches */
+    char jit; /* 1 to compile the GP trees that survive several generations into native code (see jit.h) */
+    prtTreeKernel *tree_kernel; /* native code of each tree during evaluation (NULL entries are interpreted) */
 
     /* TGP */
     double ***t_constant; /* matrix with the tensor-based random constants */
@@ -145,6 +299,7 @@ typedef struct SearchSpace_{
     double HMCR; /* harmony memory considering rate */
     double PAR; /* pitch adjusting rate */
     double bw; /* bandwidth */
+    int batch_size; /* number of harmonies improvised and evaluated per iteration */
 
     /* IHS */
     double PAR_min, PAR_max; /* minimum and maximum pitch adjusting rate */
@@ -170,14 +325,34 @@ typedef struct SearchSpace_{
         int n_males; /* number of males in a pride */
         Agent **females; /* array of pointers to female lions from a pride */
         Agent **males; /* array of pointers to male lions from a pride */
+        Agent **members; /* scratch array of pointers to all lions of a pride */
+        int *index; /* scratch array of indexes used to randomly pick lions of a pride */
+        char *flag; /* scratch binary array that marks the picked lions of a pride */
+        double *prey; /* scratch position of the prey hunted by a pride */
+        double *g; /* best position found by a pride within an iteration (parallel mode) */
     }*pride_id; /* array of prides */
     int n_female_nomads; /* number of nomad females */
     int n_male_nomads; /* number of nomad males */
     Agent **female_nomads; /* array of pointers to female nomad lions */
     Agent **male_nomads; /* array of pointers to male nomad lions */
+    int lion_capacity; /* number of lions in the pool, i.e., the largest population LOA may reach within an iteration */
+    Agent **lion; /* pool that owns every lion, alive or not */
+    int n_free_lions; /* number of lions that are not alive at the moment */
+    Agent **free_lion; /* stack of pointers to the lions that are not alive at the moment */
+    int *lion_index; /* scratch array of indexes used by the nomads and the population equilibrium */
+    char *lion_flag; /* scratch binary array used by the nomads */
+    int *pride_count; /* scratch array with the 5 * n_prides + 1 per-pride counters and seeds used by runLOA */
     
 }SearchSpace;
 
+/* It defines a pool of search spaces, which are kept allocated to be reused by further problems with the same shape */
+typedef struct _SearchSpacePool{
+    int capacity; /* maximum number of search spaces kept by the pool */
+    int size; /* number of search spaces in the pool */
+    SearchSpace **s; /* search spaces */
+    int *opt_id; /* identifier of the optimization technique of each search space */
+}SearchSpacePool;
+
 typedef double (*prtFun)(Agent *, va_list arg); /* Pointer to the function used to evaluate agents */
 
 /* Agent-related functions */
@@ -187,31 +362,119 @@ void CheckAgentLimits(SearchSpace *s, Agent *a); /* It checks whether a given ag
 Agent *CopyAgent(Agent *a, int opt_id, int tensor_dim); /* It copies an agent */
 void EvaluateAgent(SearchSpace *s, Agent *a, int opt_id, prtFun Evaluate, va_list arg); /* It evaluate an agent according to each technique */
 Agent *GenerateNewAgent(SearchSpace *s, int opt_id); /* It generates a new agent according to each technique */
+void ResetAgent(Agent *a); /* It resets an agent to the state of a newly created one, keeping its allocations */
 /**************************/
 
 /* Search Space-related functions */
 SearchSpace *CreateSearchSpace(int m, int n, int opt_id, ...); /* It creates a search space */
 void DestroySearchSpace(SearchSpace **s, int opt_id); /* It deallocates a search space */
 void InitializeSearchSpace(SearchSpace *s, int opt_id); /* It initializes an allocated search space */
+void ResizeSearchSpace(SearchSpace *s, int m, int opt_id); /* It changes the number of agents of a search space, reusing its allocations */
+void ResetSearchSpace(SearchSpace *s, int opt_id); /* It prepares a search space for a new problem with the same shape, reusing its allocations */
 void ShowSearchSpace(SearchSpace *s, int opt_id); /* It shows a search space */
 void EvaluateSearchSpace(SearchSpace *s, int opt_id, prtFun Evaluate, va_list arg); /* It evaluates a search space */
 char CheckSearchSpace(SearchSpace *s, int opt_id); /* It checks whether a search space has been properly set or not */
 /**************************/
 
+/* Constraint-related functions */
+void SetConstraints(SearchSpace *s, int n_constraints, prtConstraint *constraint); /* It sets the inequality constraints of a search space */
+double ComputeConstraintViolation(SearchSpace *s, Agent *a, va_list arg); /* It computes the constraint violation of an agent */
+char IsBetterSolution(double fit1, double cv1, double fit2, double cv2); /* It compares two solutions according to Deb's feasibility rules */
+/**************************/
+
+/* Search Space Pool-related functions */
+SearchSpacePool *CreateSearchSpacePool(int capacity); /* It creates an empty pool of search spaces */
+void DestroySearchSpacePool(SearchSpacePool **pool); /* It deallocates a pool and the search spaces it keeps */
+SearchSpace *AcquireSearchSpace(SearchSpacePool *pool, int m, int n, int opt_id); /* It takes a search space with a given shape out of a pool */
+void ReleaseSearchSpace(SearchSpacePool *pool, SearchSpace **s, int opt_id); /* It gives a search space back to a pool */
+/**************************/
+
+/* Termination-related functions */
+void SetTermination(SearchSpace *s, long int max_evaluations, double max_time, int max_stagnation, double tolerance); /* It sets up the termination criteria of a search space */
+double GetWallClockTime(); /* It returns the current wall-clock time in seconds */
+void ResetTermination(SearchSpace *s); /* It resets the counters of the termination criteria at the beginning of a run */
+char StopOptimization(SearchSpace *s, int t); /* It checks whether the run must stop before iteration t */
+double EvaluateFitness(SearchSpace *s, Agent *a, prtFun Evaluate, va_list arg); /* It evaluates an agent and updates the evaluation counter */
+void EvaluateBatch(SearchSpace *s, Agent **a, int m, prtFun Evaluate, va_list arg); /* It evaluates a batch of agents, in parallel if s->n_threads > 1 */
+void EvaluateScreenedBatch(SearchSpace *s, Agent **a, int m, int *source, prtFun Evaluate, va_list arg); /* It evaluates the candidates of a batch the surrogate model does not discard */
+/**************************/
+
+/* Surrogate-related functions */
+Surrogate *CreateSurrogate(int n, int capacity, int k, double ratio); /* It creates a surrogate model */
+void DestroySurrogate(Surrogate **sg); /* It deallocates a surrogate model */
+void UpdateSurrogate(Surrogate *sg, double *x, double fit); /* It adds an evaluated point to the archive of a surrogate model */
+char SurrogateIsReady(Surrogate *sg); /* It checks whether a surrogate model has enough points to be used */
+double PredictSurrogate(Surrogate *sg, double *x, Data *nn); /* It predicts the fitness value of a position */
+char *ScreenSearchSpace(SearchSpace *s); /* It selects the most promising agents of a search space to be evaluated */
+double EvaluateCandidate(SearchSpace *s, Agent *a, double reference, prtFun Evaluate, va_list arg); /* It evaluates a candidate agent only if the surrogate model finds it promising */
+char SkipCandidate(SearchSpace *s, Agent *a, double reference); /* It decides whether the surrogate model discards a candidate agent */
+/**************************/
+
 /* General-purpose functions */
 double GenerateUniformRandomNumber(double low, double high); /* It generates a random number drawn from a uniform distribution whithin [low,high] */
 double GenerateGaussianRandomNumber(double mean, double variance); /* It generates a random number drawn from a Gaussian (normal) distribution */
+void GenerateUniformRandomArray(double *out, int n, double low, double high); /* It fills an array with numbers drawn from a uniform distribution whithin [low,high] */
+void GenerateGaussianRandomArray(double *out, int n, double mean, double variance); /* It fills an array with numbers drawn from a Gaussian (normal) distribution */
+double LevySigma(double beta); /* It computes the (cached) scale used by the Mantegna's algorithm to draw Levy steps */
 double *GenerateLevyDistribution(int n, double beta); /* It generates an n-dimensional array drawn from a Levy distribution */
+void GenerateLevyDistributionArray(double *L, int n, double beta); /* It fills a caller-provided array with numbers drawn from a Levy distribution */
 double EuclideanDistance(double *x, double *y, int n); /* It computes the Euclidean distance between two n-dimensional arrays */
 double *GetPerpendicularVector(double *x, int n); /* It generates a perpendicular vector to a given vector */
+void FillPerpendicularVector(double *x, int n, double *perp_vector); /* It fills a buffer with a perpendicular vector to a given vector */
 void NormalizeVector(double *x, int n); /* It normalizes a given vector */
 int SortAgent(const void *a, const void *b); /* It is used to sort by agent's fitness (asceding order of fitness) */
+void SelectAgents(Agent **a, int n, int k); /* It moves the k best agents to the first k positions (in no particular order) */
 int SortDataByVal(const void *a, const void *b); /* It is used to sort an array of Data by asceding order of the variable val */
 void WaiveComment(FILE *fp); /* It waives a comment in a model file */
 SearchSpace *ReadSearchSpaceFromFile(char *fileName, int opt_id); /* It loads a search space with parameters specified in a file */
 int getFUNCTIONid(char *s); /* It returns the identifier of the function used as input */
 int *RouletteSelection(SearchSpace *s, int k); /* It selects k elements based on the roulette selection method */
 int *RouletteSelectionGA(SearchSpace *s, int k); /* It selects k elements based on the roulette selection method */
+int TournamentSelection(SearchSpace *s, int size); /* It selects an agent by a tournament among size agents drawn at random */
+Sampler *CreateSampler(int capacity); /* It creates a sampler of up to capacity outcomes */
+void DestroySampler(Sampler **sp); /* It deallocates a sampler */
+void BuildSampler(Sampler *sp, double *w, int size); /* It sets the weights of the outcomes of a sampler */
+int DrawSampler(Sampler *sp); /* It draws an outcome of a sampler */
+/**************************/
+
+/* Multi-objective-related functions */
+Archive *CreateArchive(int n, int n_objectives, int capacity); /* It creates an archive of non-dominated solutions */
+void DestroyArchive(Archive **A); /* It deallocates an archive */
+void ClearArchive(Archive *A); /* It removes all solutions of an archive */
+char Dominates(double *f1, double *f2, int n_objectives); /* It checks whether a solution Pareto-dominates another one */
+char UpdateArchive(Archive *A, double *x, double *f); /* It adds a solution to an archive if no solution of the archive dominates it */
+void CrowdingArchive(Archive *A); /* It computes the crowding distances of the solutions of an archive */
+int SelectArchiveLeader(Archive *A); /* It selects a solution of an archive by a binary tournament on the crowding distance */
+int FastNonDominatedSort(double *f, int m, int n_objectives, int *rank); /* It sorts solutions into non-dominated fronts */
+void CrowdingDistance(double *f, int *id, int size, int n_objectives, double *dist); /* It computes the crowding distances of the solutions of a front */
+void EvaluateObjectives(SearchSpace *s, Agent *a, prtMOFun Evaluate, double *f, va_list arg); /* It evaluates the objectives of an agent and updates the evaluation counter */
+int EvaluateObjectivesBatch(SearchSpace *s, Agent **a, int m, prtMOFun Evaluate, double *f, va_list arg); /* It evaluates the objectives of a batch of agents and updates the archive */
+/**************************/
+
+/* NUMA-related functions */
+Topology *ReadTopology(void); /* It reads the NUMA topology of the machine */
+void DestroyTopology(Topology **tp); /* It deallocates a NUMA topology */
+int GetThreadCPU(Topology *tp, int thread, int n_threads); /* It returns the CPU a worker is pinned to */
+char PinThread(int cpu); /* It pins the calling thread to a CPU */
+void PinWorker(SearchSpace *s); /* It pins the calling worker of a parallel region according to the NUMA topology of a search space */
+void UnpinWorker(void); /* It gives the calling worker back the CPUs it could run on before PinWorker */
+void PlaceAgents(SearchSpace *s, Agent **a, int m); /* It moves the arrays of a set of agents to the nodes of the workers that evaluate them */
+void SetNUMASearchSpace(SearchSpace *s, int opt_id); /* It turns on the NUMA-aware parallel mode of a search space */
+/**************************/
+
+/* Binary-related functions */
+int getBinaryWords(int n); /* It returns the number of words of a bit-packed array of n decision variables */
+void SetBinarySearchSpace(SearchSpace *s, int opt_id); /* It turns a search space into a binary one, whose agents are bit-packed */
+void PackBinary(double *x, int n, uint64_t *b); /* It packs a real-valued array into bits */
+void UnpackBinary(uint64_t *b, int n, double *x); /* It unpacks bits into a real-valued array */
+char GetBinaryBit(uint64_t *b, int j); /* It returns the j-th bit of a bit-packed array */
+void SetBinaryBit(uint64_t *b, int j, char bit); /* It sets the j-th bit of a bit-packed array */
+void GenerateBinaryArray(uint64_t *b, int n, double p); /* It fills a bit-packed array with bits drawn at random */
+int CountBinaryOnes(uint64_t *b, int n); /* It returns the number of bits set in a bit-packed array */
+int HammingDistance(uint64_t *b1, uint64_t *b2, int n); /* It computes the Hamming distance between two bit-packed arrays */
+void EvaluateBinarySearchSpace(SearchSpace *s, prtFun Evaluate, va_list arg); /* It evaluates the agents of a binary search space and updates their local and global bests */
+void RunBinaryTree(SearchSpace *s, Node *T, uint64_t *terminal, uint64_t *constant, uint64_t *out); /* It runs a boolean tree over bit-packed terminals */
+void RunBinaryLinearTree(SearchSpace *s, LinearTree *T, uint64_t *terminal, uint64_t *constant, uint64_t *out, uint64_t *stack); /* It runs a boolean linear tree over bit-packed terminals */
 /**************************/
 
 /* Tree-related functions */
@@ -224,6 +487,8 @@ double *RunTree(SearchSpace *s, Node *T); /* It runs a given tree and outputs it
 Node *CopyTree(Node *T); /* It copies a given tree */
 void PreFixTravel4Copy(Node *T, Node *Parent); /* It performs a prefix travel on a tree */
 int getSizeTree(Node *T); /* It returns the size of a tree (number of nodes) */
+int getTreeDepth(Node *T); /* It returns the depth of a tree */
+char IsTreeWithinLimits(SearchSpace *s, Node *T); /* It checks whether a tree respects the depth and size limits of a search space */
 Node *Mutation(SearchSpace *s, Node *T, float p); /* It performs the mutation of a tree T */
 Node **Crossover(Node *Father, Node *Mother, float p); /* It performs the crossover between father and mother trees */
 Node *PreFixPositioningTree(Node *T, int pos, char *left_son, int status, int *ctr); /* It returns the parent of the pos-th node using a prefix travel */
@@ -233,6 +498,25 @@ Node *SGXE(SearchSpace *s, Node *T1_tmp, Node *T2_tmp); /* It performs the Geome
 Node *SGME(SearchSpace *s, Node *T1_tmp, Node *T2_tmp); /* It performs the Geometric Semantic Genetic Programming mutation operator for real-valued functions */
 /***********************/
 
+/* Linear tree-related functions */
+LinearTree *CreateLinearTree(int capacity); /* It creates an empty linear tree */
+void DestroyLinearTree(LinearTree **T); /* It deallocates a linear tree */
+void CopyLinearTree(LinearTree *dst, LinearTree *src); /* It copies a linear tree into another one */
+void GrowLinearTree(SearchSpace *s, LinearTree *T, int min_depth, int max_depth); /* It creates a random linear tree based on the GROW algorithm */
+void Tree2LinearTree(Node *T, LinearTree *L); /* It converts a tree into a linear tree */
+Node *LinearTree2Tree(SearchSpace *s, LinearTree *L); /* It converts a linear tree into a tree */
+void RunLinearTree(SearchSpace *s, int opt_id, LinearTree *T, double *out, double *stack, TreeCache *cache); /* It runs a given linear tree and outputs its solution array */
+void LinearMutation(SearchSpace *s, LinearTree *T, LinearTree *out, float p); /* It performs the mutation of a linear tree */
+void LinearCrossover(LinearTree *Father, LinearTree *Mother, LinearTree *Son, LinearTree *Daughter, float p); /* It performs the crossover between father and mother linear trees */
+int getLinearTreeDepth(LinearTree *T); /* It returns the depth of a linear tree */
+char IsLinearTreeWithinLimits(SearchSpace *s, LinearTree *T); /* It checks whether a linear tree respects the depth and size limits of a search space */
+void EvaluateLinearForest(SearchSpace *s, int opt_id, LinearTree **T, prtFun Evaluate, va_list arg); /* It evaluates the linear trees of a GP/TGP search space */
+TreeCache *CreateTreeCache(long int budget, int width); /* It creates a subtree cache */
+void DestroyTreeCache(TreeCache **cache); /* It deallocates a subtree cache */
+void ClearTreeCache(TreeCache *cache); /* It discards all subtrees of a subtree cache */
+void CensusTreeCache(TreeCache *cache, LinearTree *T); /* It counts the subtrees of a linear tree in a subtree cache */
+/***********************/
+
 /* Tensor-related functions */
 double **CreateTensor(int n, int tensor_dim); /* It allocates a new tensor */
 void DestroyTensor(double ***t, int n); /* It deallocates a tensor */
@@ -133,6 +133,37 @@ double Zettl(Agent *a, va_list arg); /* It computes the Zettl's function */
 double Zirilli(Agent *a, va_list arg); /* It computes the Zirilli's function */
 /***********************/
 
+/* Batch benchmark functions */
+typedef void (*prtBatchFun)(double *X, int m, int n, double *f); /* Pointer to a function that evaluates a block of m agents (m x n, row-wise) */
+
+void Ackley_First_Batch(double *X, int m, int n, double *f); /* It computes the 1st Ackley's function over a block of agents */
+void Alpine_First_Batch(double *X, int m, int n, double *f); /* It computes the 1st Alpine's function over a block of agents */
+void Chung_Reynolds_Batch(double *X, int m, int n, double *f); /* It computes the Chung Reynolds' function over a block of agents */
+void Dixon_Price_Batch(double *X, int m, int n, double *f); /* It computes the Dixon's-Price function over a block of agents */
+void Exponential_Batch(double *X, int m, int n, double *f); /* It computes the Exponential function over a block of agents */
+void Griewank_Batch(double *X, int m, int n, double *f); /* It computes the Griewank's function over a block of agents */
+void Qing_Batch(double *X, int m, int n, double *f); /* It computes the Qing's function over a block of agents */
+void Rastrigin_Batch(double *X, int m, int n, double *f); /* It computes the Rastrigin's function over a block of agents */
+void Rosenbrock_Batch(double *X, int m, int n, double *f); /* It computes the Rosenbrock's function over a block of agents */
+void Salomon_Batch(double *X, int m, int n, double *f); /* It computes the Salomon's function over a block of agents */
+void Schumer_Steiglitz_Batch(double *X, int m, int n, double *f); /* It computes the Schumer Steiglitz's function over a block of agents */
+void Schewefel_Batch(double *X, int m, int n, double *f); /* It computes the Schewefel's function over a block of agents */
+void Sphere_Batch(double *X, int m, int n, double *f); /* It computes the Sphere's function over a block of agents */
+void Sum_Squares_Batch(double *X, int m, int n, double *f); /* It computes the Sum Squares function over a block of agents */
+void Styblinski_Tang_Batch(double *X, int m, int n, double *f); /* It computes the Styblinski's-Tang function over a block of agents */
+/***********************/
+
+/* Benchmark function registry */
+typedef struct _BenchmarkFunction{
+    const char *name; /* name of the function */
+    prtFun f; /* scalar implementation */
+    prtBatchFun batch; /* batch implementation (NULL if not available) */
+}BenchmarkFunction;
+
+BenchmarkFunction *GetBenchmarkFunction(const char *name); /* It returns the registry entry of a benchmark function given its name */
+int GetNumberOfBenchmarkFunctions(); /* It returns the number of benchmark functions in the registry */
+/*****************************/
+
 /* Genetic Programming general-purpose functions */
 double *f_SUM_(double *x, double *y, int n); /* It computes the pointwise sum of two n-dimensional arrays */
 double *f_SUB_(double *x, double *y, int n); /* It computes the pointwise subtraction of two n-dimensional arrays */
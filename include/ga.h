@@ -19,5 +19,7 @@ limitations under the License.
 #include "opt.h"
 
 void runGA(SearchSpace *s, prtFun Evaluate, ...); /* It executes the Genetic Algorithm for function minimization */
+void runBGA(SearchSpace *s, prtFun Evaluate, ...); /* It executes the Binary Genetic Algorithm for function minimization */
+void runNSGA2(SearchSpace *s, prtMOFun Evaluate, ...); /* It executes the Non-dominated Sorting Genetic Algorithm II for the minimization of several objectives */
 
 #endif
@@ -24,8 +24,11 @@ limitations under the License.
 #define PSF_MEMORY 1
 #define PSF_PITCH 2
 
+void MergeHarmonies(SearchSpace *s, Agent **candidate, int b, char **rehearsal, char **op_type); /* It merges a batch of evaluated harmonies into the harmony memory */
 void runHS(SearchSpace *s, prtFun Evaluate, ...); /* It executes the Harmony Search for function minimization */
 void runIHS(SearchSpace *s, prtFun Evaluate, ...); /* It executes the Improved Harmony Search for function minimization */
+void ImproviseBinaryHarmony(SearchSpace *s, Agent *a); /* It improvises a bit-packed harmony */
+void runBHS(SearchSpace *s, prtFun Evaluate, ...); /* It executes the Binary Harmony Search for function minimization */
 void UpdateIndividualHMCR_PAR(SearchSpace *s, char **rehearsal, double *HMCR, double *PAR); /* It updates the individual values of HMCR and PAR concerning PSF-HS */
 void UpdateIndividualTensorHMCR_PAR(SearchSpace *s, int tensor_id, char ***rehearsal, double **HMCR, double **PAR); /* It updates the individual values of HMCR and PAR concerning Tensor-based PSF-HS */
 Agent *GenerateNewPSF(SearchSpace *s, double *HMCR, double *PAR, char *op_type); /* It generates a new PSF agent */
@@ -0,0 +1,64 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/* Native code for GP trees. A tree is translated into a C function that computes its output with a single loop over the
+decision variables, which is compiled by the system C compiler (the one given by the LIBOPT_JIT_CC environment variable, or cc)
+into a shared object and loaded with dlopen. Compiled functions are cached by the structure of the trees, and the trees are
+interpreted whenever the compiler or dlopen are not available. The outputs are the same as the ones of RunLinearTree.
+Starting the compiler takes a fraction of a second, so it pays off for long runs and many decision variables (e.g., samples of
+a regression problem); trees are compiled only when the time saved before they are discarded is expected to exceed it. */
+
+#ifndef JIT_H
+#define JIT_H
+
+#include "opt.h"
+
+#define JIT_MIN_GENERATIONS 3 /* number of generations a tree must be evaluated before it is compiled */
+#define JIT_MAX_BATCH 32 /* maximum number of trees compiled at each generation (the oldest ones first) */
+#define JIT_COMPILE_TIME 0.5 /* estimated time (in seconds) of a compilation, before the first one is measured */
+#define JIT_PAYOFF 2 /* trees are compiled only if interpreting them until they are discarded is expected to take JIT_PAYOFF times the compilation time */
+
+/* It defines a tree known by the compiler */
+typedef struct _JitEntry{
+    unsigned long long key; /* structural hash of the tree */
+    LinearTree *T; /* copy of the tree, which tells apart trees with the same hash */
+    int generations; /* number of generations the tree has been evaluated */
+    int last_generation; /* last generation the tree has been evaluated */
+    double cost; /* time (in seconds) to interpret the tree once (negative until it is measured) */
+    prtTreeKernel kernel; /* native code of the tree (NULL if it has not been compiled) */
+}JitEntry;
+
+/* It defines the state of the compiler along an optimization */
+typedef struct _GPJit{
+    char available; /* 0 if the compiler or dlopen have failed, so the trees are interpreted from then on */
+    char *dir; /* temporary directory of the generated files */
+    int generation; /* current generation */
+    int n_entries; /* number of known trees */
+    int max_entries; /* room for known trees */
+    JitEntry *entry; /* known trees */
+    int n_slots; /* number of slots of the hash table (a power of two) */
+    int *slot; /* position of the tree of each slot (-1 if it is empty) */
+    int n_modules; /* number of loaded shared objects */
+    void **module; /* loaded shared objects */
+    double compile_time; /* time (in seconds) of the last compilation */
+    long int compiled; /* number of compiled trees */
+}GPJit;
+
+GPJit *CreateGPJit(void); /* It creates the state of the compiler */
+void DestroyGPJit(GPJit **jit); /* It unloads the native code and deallocates the state of the compiler */
+void UpdateGPJit(GPJit *jit, SearchSpace *s, LinearTree **T); /* It sets the native code of the trees of a GP search space, compiling the ones that have survived long enough */
+char ExportTree2C(SearchSpace *s, Node *T, char *fileName, char *functionName); /* It writes a tree as a standalone C function */
+
+#endif
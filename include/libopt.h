@@ -0,0 +1,63 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/* Stable API of the shared library (lib/shared/libopt.so). It only exposes an opaque handle, so the layout of the
+search space may change without breaking the applications linked against the library. Techniques and parameters
+are identified by their names, e.g., "PSO" and "w", as in the model files. Unless stated otherwise, functions return 1
+on success and 0 otherwise. */
+
+#ifndef _LIBOPT_H_
+#define _LIBOPT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__GNUC__)
+#define LIBOPT_API __attribute__((visibility("default")))
+#else
+#define LIBOPT_API
+#endif
+
+typedef struct LibOptHandle_ LibOptHandle; /* Opaque handle to an optimization problem */
+
+typedef double (*LibOptFunction)(const double *x, int n, void *data); /* Fitness function to be minimized */
+
+/* Handle-related functions */
+LIBOPT_API LibOptHandle *LibOptCreate(const char *technique, int m, int n); /* It creates a handle with m agents and n decision variables */
+LIBOPT_API LibOptHandle *LibOptCreateFromFile(const char *technique, const char *fileName); /* It creates a handle from a model file */
+LIBOPT_API void LibOptDestroy(LibOptHandle **h); /* It deallocates a handle */
+/**************************/
+
+/* Configuration-related functions */
+LIBOPT_API int LibOptSetBounds(LibOptHandle *h, const double *LB, const double *UB); /* It sets the boundaries of the decision variables */
+LIBOPT_API int LibOptSetInt(LibOptHandle *h, const char *name, long int value); /* It sets an integer-valued parameter */
+LIBOPT_API int LibOptSetDouble(LibOptHandle *h, const char *name, double value); /* It sets a real-valued parameter */
+LIBOPT_API void LibOptSetSeed(int seed); /* It initializes the random number generator shared by all handles */
+/**************************/
+
+/* Optimization-related functions */
+LIBOPT_API int LibOptRun(LibOptHandle *h, LibOptFunction Evaluate, void *data); /* It initializes the agents and minimizes Evaluate */
+LIBOPT_API double LibOptGetBestFitness(const LibOptHandle *h); /* It returns the best fitness value found by the last run */
+LIBOPT_API int LibOptGetBest(const LibOptHandle *h, double *x); /* It copies the best position found by the last run */
+LIBOPT_API int LibOptGetDimension(const LibOptHandle *h); /* It returns the number of decision variables */
+LIBOPT_API long int LibOptGetEvaluations(const LibOptHandle *h); /* It returns the number of evaluations performed by the last run */
+/**************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
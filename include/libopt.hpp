@@ -0,0 +1,387 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/* Optional C++ layer with fixed-dimension engines (C++14 or later). The number of decision variables is a template
+parameter, so positions are stored inline (std::array) and the loops over the decision variables are fully unrolled.
+The engines read their parameters, boundaries and initial population from a SearchSpace created by the C library
+(e.g., ReadSearchSpaceFromFile + InitializeSearchSpace), share its random number generator and termination criteria,
+and store the global best agent back at s->g and s->gfit. The benchmark functions of function.h are available through
+libopt::Function<N>. */
+
+#ifndef _LIBOPT_HPP_
+#define _LIBOPT_HPP_
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "opt.h"
+
+extern "C" {
+#include "pso.h"
+#include "de.h"
+#include "function.h"
+}
+
+namespace libopt
+{
+
+/* It defines the position of an agent with N decision variables */
+template <std::size_t N>
+using Position = std::array<double, N>;
+
+template <class F, std::size_t... J>
+inline void UnrollLoop(F &&f, std::index_sequence<J...>)
+{
+    int expand[] = {0, (f(J), 0)...};
+    (void)expand;
+}
+
+/* It calls f(0), f(1), ..., f(N-1), i.e., it executes a loop over the decision variables unrolled at compile time
+Parameters:
+f: loop body, which receives the index of the decision variable */
+template <std::size_t N, class F>
+inline void Unroll(F &&f)
+{
+    UnrollLoop(f, std::make_index_sequence<N>());
+}
+
+/* It clamps a position to the boundaries of the search space (fixed-dimension CheckAgentLimits)
+Parameters:
+x: position
+LB: lower boundaries
+UB: upper boundaries */
+template <std::size_t N>
+inline void CheckLimits(Position<N> &x, const Position<N> &LB, const Position<N> &UB)
+{
+    Unroll<N>([&](std::size_t j) {
+        if (x[j] < LB[j])
+            x[j] = LB[j];
+        else if (x[j] > UB[j])
+            x[j] = UB[j];
+    });
+}
+
+/* It computes the squared Euclidean distance between two positions
+Parameters:
+x: first position
+y: second position */
+template <std::size_t N>
+inline double SquaredDistance(const Position<N> &x, const Position<N> &y)
+{
+    double d = 0;
+
+    Unroll<N>([&](std::size_t j) { d += (x[j] - y[j]) * (x[j] - y[j]); });
+
+    return d;
+}
+
+/* It wraps a C fitness function (e.g., the benchmark functions of function.h) to be used by the fixed-dimension engines.
+No additional arguments are forwarded to the function. */
+template <std::size_t N>
+class Function
+{
+  public:
+    explicit Function(prtFun Evaluate) : Evaluate_(Evaluate) {}
+
+    double operator()(const Position<N> &x) const
+    {
+        Agent a = Agent(); /* a stack agent that points to the position, so nothing is allocated */
+
+        a.n = N;
+        a.x = const_cast<double *>(x.data());
+
+        return Call(&a);
+    }
+
+  private:
+    double Call(Agent *a, ...) const
+    {
+        va_list arg;
+        double f;
+
+        va_start(arg, a);
+        f = Evaluate_(a, arg);
+        va_end(arg);
+
+        return f;
+    }
+
+    prtFun Evaluate_;
+};
+
+/* It reads the boundaries of a search space and checks its dimension
+Parameters:
+s: search space
+LB: lower boundaries
+UB: upper boundaries
+name: name of the caller used in error messages */
+template <std::size_t N>
+inline void ReadBoundaries(const SearchSpace *s, Position<N> &LB, Position<N> &UB, const char *name)
+{
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @%s.\n", name);
+        exit(-1);
+    }
+
+    if (s->n != (int)N)
+    {
+        fprintf(stderr, "\nThe search space has %d decision variables, but the engine has been compiled for %d @%s.\n", s->n, (int)N, name);
+        exit(-1);
+    }
+
+    for (std::size_t j = 0; j < N; j++)
+    {
+        LB[j] = s->LB[j];
+        UB[j] = s->UB[j];
+    }
+}
+
+/* It defines a particle with N decision variables */
+template <std::size_t N>
+struct Particle
+{
+    Position<N> x;  /* position */
+    Position<N> v;  /* velocity */
+    Position<N> xl; /* local best */
+    double fit;     /* fitness value of the local best */
+};
+
+/* Fixed-dimension Particle Swarm Optimization. It follows runPSO (pso.c) step by step, so both engines find the same
+solution when started from the same search space and random seed. */
+template <std::size_t N>
+class PSO
+{
+  public:
+    /* It creates the swarm from the parameters (m, w, c1 and c2), boundaries and agents of a search space
+    Parameters:
+    s: search space (it must have been initialized, and it receives the global best agent at the end of each run) */
+    explicit PSO(SearchSpace *s) : s_(s)
+    {
+        int i;
+
+        ReadBoundaries<N>(s, LB_, UB_, "libopt::PSO");
+
+        swarm_.resize(s->m);
+        for (i = 0; i < s->m; i++)
+        {
+            for (std::size_t j = 0; j < N; j++)
+            {
+                swarm_[i].x[j] = s->a[i]->x[j];
+                swarm_[i].v[j] = s->a[i]->v ? s->a[i]->v[j] : 0;
+                swarm_[i].xl[j] = s->a[i]->x[j];
+            }
+            swarm_[i].fit = DBL_MAX;
+        }
+        g_.fill(0);
+    }
+
+    /* It executes the Particle Swarm Optimization for function minimization and returns the global best fitness
+    Parameters:
+    Evaluate: fitness function, which receives a const Position<N> & and returns a double */
+    template <class Fitness>
+    double run(Fitness &&Evaluate)
+    {
+        int t;
+
+        ResetTermination(s_); /* It starts counting evaluations, time and stagnation */
+        s_->gfit = DBL_MAX;
+        EvaluateSwarm(Evaluate); /* Initial evaluation */
+
+        for (t = 1; !StopOptimization(s_, t); t++)
+        {
+            for (Particle<N> &p : swarm_)
+            {
+                UpdateParticle(p);
+                CheckLimits<N>(p.x, LB_, UB_);
+            }
+
+            EvaluateSwarm(Evaluate);
+        }
+
+        for (std::size_t j = 0; j < N; j++)
+            s_->g[j] = g_[j];
+
+        return s_->gfit;
+    }
+
+    const Position<N> &best() const { return g_; } /* global best agent */
+    const std::vector<Particle<N>> &swarm() const { return swarm_; } /* particles */
+
+  private:
+    /* It updates the velocity and the position of a particle (UpdateParticleVelocity and UpdateParticlePosition) */
+    void UpdateParticle(Particle<N> &p)
+    {
+        const double w = s_->w, c1 = s_->c1 * GenerateUniformRandomNumber(0, 1), c2 = s_->c2 * GenerateUniformRandomNumber(0, 1);
+
+        Unroll<N>([&](std::size_t j) {
+            p.v[j] = w * p.v[j] + c1 * (p.xl[j] - p.x[j]) + c2 * (g_[j] - p.x[j]);
+            p.x[j] = p.x[j] + p.v[j];
+        });
+    }
+
+    /* It evaluates all particles and updates their local best and the global best */
+    template <class Fitness>
+    void EvaluateSwarm(Fitness &Evaluate)
+    {
+        double f;
+
+        for (Particle<N> &p : swarm_)
+        {
+            f = Evaluate(static_cast<const Position<N> &>(p.x));
+            if (f < p.fit)
+            { /* It updates the local best value and position */
+                p.fit = f;
+                p.xl = p.x;
+            }
+
+            if (p.fit < s_->gfit)
+            { /* It updates the global best value and position */
+                s_->gfit = p.fit;
+                g_ = p.x;
+            }
+        }
+        s_->stop.n_evaluations += swarm_.size();
+    }
+
+    SearchSpace *s_;
+    Position<N> LB_, UB_, g_;
+    std::vector<Particle<N>> swarm_;
+};
+
+/* It defines an individual with N decision variables */
+template <std::size_t N>
+struct Individual
+{
+    Position<N> x; /* position */
+    double fit;    /* fitness value */
+};
+
+/* Fixed-dimension Differential Evolution (DE/rand/1/bin, Storn and Price, 1997). Each trial vector replaces its target
+as soon as it is evaluated, provided it is not worse. */
+template <std::size_t N>
+class DE
+{
+  public:
+    /* It creates the population from the parameters (m), boundaries and agents of a search space
+    Parameters:
+    s: search space (it must have been initialized, and it receives the global best agent at the end of each run)
+    F: mutation factor
+    CR: crossover probability */
+    DE(SearchSpace *s, double F = 0.5, double CR = 0.9) : s_(s), F_(F), CR_(CR)
+    {
+        int i;
+
+        ReadBoundaries<N>(s, LB_, UB_, "libopt::DE");
+        if (s->m < 4)
+        {
+            fprintf(stderr, "\nDifferential Evolution requires at least 4 agents @libopt::DE.\n");
+            exit(-1);
+        }
+
+        population_.resize(s->m);
+        for (i = 0; i < s->m; i++)
+        {
+            for (std::size_t j = 0; j < N; j++)
+                population_[i].x[j] = s->a[i]->x[j];
+            population_[i].fit = DBL_MAX;
+        }
+        g_.fill(0);
+    }
+
+    /* It executes the Differential Evolution for function minimization and returns the global best fitness
+    Parameters:
+    Evaluate: fitness function, which receives a const Position<N> & and returns a double */
+    template <class Fitness>
+    double run(Fitness &&Evaluate)
+    {
+        int t, i, r1, r2, r3, m = (int)population_.size();
+        std::size_t jrand;
+        Position<N> trial;
+        double f;
+
+        ResetTermination(s_); /* It starts counting evaluations, time and stagnation */
+        s_->gfit = DBL_MAX;
+        for (Individual<N> &a : population_)
+        { /* Initial evaluation */
+            a.fit = Evaluate(static_cast<const Position<N> &>(a.x));
+            UpdateBest(a);
+        }
+        s_->stop.n_evaluations += m;
+
+        for (t = 1; !StopOptimization(s_, t); t++)
+        {
+            for (i = 0; i < m; i++)
+            {
+                /* three distinct agents other than the target */
+                do
+                    r1 = (int)GenerateUniformRandomNumber(0, m);
+                while (r1 == i);
+                do
+                    r2 = (int)GenerateUniformRandomNumber(0, m);
+                while ((r2 == i) || (r2 == r1));
+                do
+                    r3 = (int)GenerateUniformRandomNumber(0, m);
+                while ((r3 == i) || (r3 == r1) || (r3 == r2));
+                jrand = (std::size_t)GenerateUniformRandomNumber(0, N); /* at least this variable comes from the mutant */
+
+                const Position<N> &a = population_[r1].x, &b = population_[r2].x, &c = population_[r3].x, &x = population_[i].x;
+                Unroll<N>([&](std::size_t j) {
+                    trial[j] = ((j == jrand) || (GenerateUniformRandomNumber(0, 1) < CR_)) ? a[j] + F_ * (b[j] - c[j]) : x[j];
+                });
+                CheckLimits<N>(trial, LB_, UB_);
+
+                f = Evaluate(static_cast<const Position<N> &>(trial));
+                if (f <= population_[i].fit)
+                { /* We accept the new solution */
+                    population_[i].x = trial;
+                    population_[i].fit = f;
+                    UpdateBest(population_[i]);
+                }
+            }
+            s_->stop.n_evaluations += m;
+        }
+
+        for (std::size_t j = 0; j < N; j++)
+            s_->g[j] = g_[j];
+
+        return s_->gfit;
+    }
+
+    const Position<N> &best() const { return g_; } /* global best agent */
+    const std::vector<Individual<N>> &population() const { return population_; } /* individuals */
+
+  private:
+    /* It updates the global best value and position */
+    void UpdateBest(const Individual<N> &a)
+    {
+        if (a.fit < s_->gfit)
+        {
+            s_->gfit = a.fit;
+            g_ = a.x;
+        }
+    }
+
+    SearchSpace *s_;
+    double F_, CR_;
+    Position<N> LB_, UB_, g_;
+    std::vector<Individual<N>> population_;
+};
+
+} // namespace libopt
+
+#endif
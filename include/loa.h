@@ -21,6 +21,9 @@ limitations under the License.
 #include "opt.h"
 
 /* LOA-related functions */
+Agent *GetLion(SearchSpace *s); /* It takes a lion that is not alive from the pool */
+void ReleaseLion(SearchSpace *s, Agent *a); /* It gives a dead lion back to the pool */
+void PickIndexes(int *index, int n, int k); /* It draws k distinct indexes from [0, n) */
 void Hunting(SearchSpace *s, int pride, int *selected_females, prtFun Evaluate, va_list arg); /* In each pride, some females look for a prey (hunt). */
 void MovingSafePlace(SearchSpace *s, int pride, int *selected_females, prtFun Evaluate, va_list arg); /* In each pride, remained females go toward a safe place */
 void Roaming(SearchSpace *s, int pride, prtFun Evaluate, va_list arg); /* In each pride, male lions roams in that pride's territory(best position of each lion in the pride). */
@@ -30,6 +33,7 @@ void NomadMating(SearchSpace *s, int *n_offsprings, int extra_male_nomads, prtFu
 void Defense(SearchSpace *s, int pride, int n_male_offsprings, int extra_male_nomads); /* In each pride, male lions become mature and fight with other males in their pride. Beaten males abandon their pride and become a nomad. */
 void AtackPride(SearchSpace *s, int n_nomad_male_offspring, int extra_male_nomads); /* Every nomad lion try to atack some prides, if the nomad is stronger (best fitness) than lion from the pride, they swap its positions. */
 void Migration(SearchSpace *s, int *n_offsprings, int n_nomad_female_offspring, int *extra_nomads, int *n_migrating); /* some randomly selected females will migrate and will become nomads. */
+void RunPridesInParallel(SearchSpace *s, SearchSpace *worker, int *selected_females, int *n_offsprings, prtFun Evaluate, va_list arg); /* It runs the pride phase of every pride on its own worker */
 void runLOA (SearchSpace *s,  prtFun Evaluate, ...);  /* It executes the Lion Optimization Algorithm for function minimization */
 /*************************/
 
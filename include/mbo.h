@@ -21,7 +21,9 @@ limitations under the License.
 #include "opt.h"
 
 /* MBO-related functions */
-void UpdateNeighbours(SearchSpace *s, int b, int k, prtFun Evaluate, va_list arg); /* It updates the neighbours of a single bird */
+void GenerateNeighbours(SearchSpace *s, Agent **candidate, int n_candidates); /* It draws random positions for a block of candidate neighbours */
+void UpdateNeighbours(SearchSpace *s, int b, int k, Agent **candidate); /* It updates the neighbours of a single bird with already evaluated candidates */
+void SelectNeighbours(SearchSpace *s, int b); /* It partially sorts the neighbours of a bird */
 void ShareNeighbours(SearchSpace *s); /* It shares the neighbours to the following bird */
 void ImproveBirds(SearchSpace *s); /* It tries to replace each bird for its best neighbour */
 void runMBO(SearchSpace *s, prtFun EvaluateFun, ...); /* It executes the Migrating Birds Optimization for function minimization */
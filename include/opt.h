@@ -15,10 +15,6 @@ limitations under the License.
 #ifndef _OPT_H_
 #define _OPT_H_
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-
 /* Meta-heuristics */
 #define _PSO_ 1 /* Particle Swarm Optimization */
 #define _BA_ 2 /* Bat Algorithm */
@@ -58,6 +54,13 @@ extern "C" {
 #define N_CONSTANTS 1000 /* number of constants generated at random to populate a GP agent */
 #define PROB_MUTATION_FUNCTION 0.9 /* probability of mutation on a function node */
 #define PROB_CROSSOVER_FUNCTION 0.7 /* probability of crossover on a function node */
+#define MAX_TREE_DEPTH 17 /* default maximum depth of an offspring tree (a single node has depth 1) */
+#define MAX_TREE_SIZE 2048 /* default maximum number of nodes of an offspring tree */
+
+/* GA selection methods */
+#define _ROULETTE_ 0 /* fitness-proportional selection */
+#define _TOURNAMENT_ 1 /* tournament selection */
+#define TOURNAMENT_SIZE 2 /* default number of agents that take part in a tournament */
 
 /* GP function-type nodes */
 #define _SUM_ 0
@@ -82,6 +85,7 @@ extern "C" {
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <stdint.h>
 #include <time.h>
 #include <math.h>
 #include <float.h>
@@ -91,6 +95,14 @@ extern "C" {
 #include <ctype.h>
 #include <stdarg.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #include "common.h"
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
@@ -14,13 +14,17 @@ limitations under the License.
 */
 
 /* PSO implementation is based on the paper available at http://www.cs.tufts.edu/comp/150GA/homeworks/hw3/_reading6%201995%20particle%20swarming.pdf
-AIWPSO implementation is based on the paper available at http://ceit.aut.ac.ir/~ebadzadeh/PSO.htm */
+AIWPSO implementation is based on the paper available at http://ceit.aut.ac.ir/~ebadzadeh/PSO.htm
+MOPSO implementation is based on the paper "Handling multiple objectives with particle swarm optimization" (Coello et al., IEEE TEC 2004), with the leaders drawn by crowding distance
+BPSO implementation is based on the paper "A discrete binary version of the particle swarm algorithm" (Kennedy and Eberhart, IEEE SMC 1997) */
 
 #ifndef PSO_H
 #define PSO_H
 
 #include "opt.h"
 
+#define BPSO_MAX_VELOCITY 4 /* velocities of BPSO are clamped to [-BPSO_MAX_VELOCITY,BPSO_MAX_VELOCITY], so no bit is ever fixed */
+
 /* PSO-related functions */
 void UpdateParticleVelocity(SearchSpace *s, int i); /* It updates the velocity of an agent (particle) */
 void UpdateParticlePosition(SearchSpace *s, int i); /* It updates the position of an agent (particle) */
@@ -32,6 +36,15 @@ void runAIWPSO(SearchSpace *s, prtFun Evaluate, ...); /* It executes the Particl
 double ComputeSuccess(SearchSpace *s); /* It computes the pecentage of success concerning the whole search space */
 /****************************/
 
+/* MOPSO-related functions */
+void runMOPSO(SearchSpace *s, prtMOFun Evaluate, ...); /* It executes the Multi-Objective Particle Swarm Optimization for the minimization of several objectives */
+/****************************/
+
+/* BPSO-related functions */
+void UpdateBinaryParticle(SearchSpace *s, int i, double *r); /* It updates the velocity and the bit-packed position of an agent (particle) */
+void runBPSO(SearchSpace *s, prtFun Evaluate, ...); /* It executes the Binary Particle Swarm Optimization for function minimization */
+/****************************/
+
 /* TensorPSO-related functions */
 void UpdateTensorParticleVelocity(SearchSpace *s, int i, int tensor_id); /* It updates the velocity of an tensor (particle) */
 void UpdateTensorParticlePosition(SearchSpace *s, int i, int tensor_id); /* It updates the position of an tensor (particle) */
@@ -33,9 +33,18 @@ limitations under the License.
 #define EPS 1.e-14
 #define RNMX (1.0-EPS)
 
+/* When OpenMP is enabled, every thread owns its own generator state and must be seeded through srandinter */
+#ifdef _OPENMP
+#define RAND_THREAD_LOCAL _Thread_local
+#else
+#define RAND_THREAD_LOCAL
+#endif
+
 double ran2(int *idum);
 int srandinter(int seed); /* It initializes the random number generator */
 double randinter(double a, double b); /* It returns a random number uniformly distributed between a and b */
+void randinterArray(double *out, int n, double a, double b); /* It fills an array with numbers uniformly distributed between a and b */
 double randGaussian(double mean, double variance); /* It returns a number drawn from a Gaussian distribution */
+void randGaussianArray(double *out, int n, double mean, double variance); /* It fills an array with numbers drawn from a Gaussian distribution */
 
 #endif
\ No newline at end of file
@@ -0,0 +1,34 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/* The restart strategies are based on the papers "A Restart CMA Evolution Strategy With Increasing Population Size", A. Auger and N. Hansen, IEEE CEC 2005,
+and "Benchmarking a BI-Population CMA-ES on the BBOB-2009 Function Testbed", N. Hansen, GECCO 2009 */
+
+#ifndef RESTART_H
+#define RESTART_H
+
+#include "opt.h"
+
+#define _IPOP_ 1 /* the population doubles at each restart */
+#define _BIPOP_ 2 /* large (doubling) and small (random) populations are interleaved according to the evaluations spent by each regime */
+
+#define RESTART_STAGNATION 10 /* default number of iterations with no improvement that triggers a restart */
+#define RESTART_FACTOR 2 /* factor by which the population increases at each large restart */
+
+typedef void (*prtRun)(SearchSpace *, prtFun, ...); /* Pointer to the function that runs an optimization technique (e.g., runPSO) */
+
+void runRestart(SearchSpace *s, int opt_id, int strategy, int max_restarts, prtRun run, prtFun Evaluate); /* It executes an optimization technique with restarts */
+
+#endif
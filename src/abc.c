@@ -15,6 +15,44 @@ limitations under the License.
 
 #include "abc.h"
 
+/* It evaluates a batch of bee trials and applies the greedy selection between each trial and its food source.
+The trials are evaluated at once (in parallel if s->n_threads > 1), and the selection is applied in the order of the trials.
+Parameters:
+s: search space
+candidate: array of 2 * n_trials pointers, whose first half holds the trial solutions (the second half is used as scratch)
+source: array with the food source each trial comes from
+n_trials: number of trials
+trial: array with the trial counters of the food sources
+Evaluate: pointer to the function used to evaluate particles
+arg: list of additional arguments */
+void ApplyBeeTrials(SearchSpace *s, Agent **candidate, int *source, int n_trials, int *trial, prtFun Evaluate, va_list arg)
+{
+    int i, j;
+
+    EvaluateScreenedBatch(s, candidate, n_trials, source, Evaluate, arg); /* the surrogate model, if any, screens the trials first */
+
+    for (i = 0; i < n_trials; i++)
+    {
+        if (candidate[i]->fit < s->a[source[i]]->fit)
+        { /* We accept the new solution */
+            trial[source[i]] = 0;
+            memcpy(s->a[source[i]]->x, candidate[i]->x, s->n * sizeof(double));
+            s->a[source[i]]->fit = candidate[i]->fit;
+            s->a[source[i]]->cv = candidate[i]->cv;
+        }
+        else
+        {
+            trial[source[i]]++; /* If the solution could not be improved, we increase the trial counter */
+        }
+        if (candidate[i]->fit < s->gfit)
+        { /* Update the global best */
+            s->gfit = candidate[i]->fit;
+            for (j = 0; j < s->n; j++)
+                s->g[j] = candidate[i]->x[j];
+        }
+    }
+}
+
 /* It executes the Artificial Bee Colony for function minimization
 Parameters:
 s: search space
@@ -23,9 +61,9 @@ arg: list of additional arguments */
 void runABC(SearchSpace *s, prtFun Evaluate, ...)
 {
     va_list arg, argtmp;
-    int i, j, k, t, chosen_param, neighbour, *trial, max_trial_index, limit;
-    double max_fitness, r, fitValue, *prob;
-    Agent *tmp = NULL;
+    int i, j, k, t, chosen_param, neighbour, *trial, max_trial_index, limit, *source = NULL;
+    double max_fitness, r, fitValue, *prob, *block = NULL;
+    Agent *tmp = NULL, *candidate_data = NULL, **candidate = NULL;
 
     va_start(arg, Evaluate);
     va_copy(argtmp, arg);
@@ -40,77 +78,66 @@ void runABC(SearchSpace *s, prtFun Evaluate, ...)
     trial = (int *)calloc(s->m, sizeof(int));
     prob = (double *)calloc(s->m, sizeof(double));
 
+    /* In the parallel mode, every bee phase generates its m trials from a snapshot of the food sources and evaluates them as a batch */
+    if (s->n_threads > 1)
+    {
+        source = (int *)malloc(s->m * sizeof(int));
+        block = (double *)malloc(s->m * s->n * sizeof(double));
+        candidate_data = (Agent *)calloc(s->m, sizeof(Agent));
+        candidate = (Agent **)malloc(2 * s->m * sizeof(Agent *)); /* the second half is a scratch area for ApplyBeeTrials */
+        for (i = 0; i < s->m; i++)
+        {
+            candidate_data[i].n = s->n;
+            candidate_data[i].x = block + i * s->n;
+            candidate[i] = &candidate_data[i];
+        }
+    }
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _ABC_, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
         /* Employed Bee step */
-        for (i = 0; i < s->m; i++)
-        { /* For each food source */
-            va_copy(arg, argtmp);
-
-            chosen_param = GenerateUniformRandomNumber(0, s->n - 1); /* Randomly parameter to be used */
-            do
+        if (candidate)
+        { /* every food source gets a trial built from the snapshot of the food sources */
+            for (i = 0; i < s->m; i++)
             {
-                neighbour = GenerateUniformRandomNumber(0, s->m - 1); /* Randomly neighbour to be used, which must be different from i */
-            } while (neighbour == i);
-            r = GenerateUniformRandomNumber(0, 1);
-
-            tmp = CopyAgent(s->a[i], _ABC_, _NOTENSOR_);
-            tmp->x[chosen_param] = s->a[i]->x[chosen_param] + (s->a[i]->x[chosen_param] - s->a[neighbour]->x[chosen_param]) * r; /* We now update our currently solution */
-            CheckAgentLimits(s, tmp);
+                chosen_param = GenerateUniformRandomNumber(0, s->n - 1); /* Randomly parameter to be used */
+                do
+                {
+                    neighbour = GenerateUniformRandomNumber(0, s->m - 1); /* Randomly neighbour to be used, which must be different from i */
+                } while (neighbour == i);
+                r = GenerateUniformRandomNumber(0, 1);
 
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
-            if (fitValue < s->a[i]->fit)
-            { /* We accept the new solution */
-                trial[i] = 0;
-                DestroyAgent(&(s->a[i]), _ABC_);
-                s->a[i] = CopyAgent(tmp, _ABC_, _NOTENSOR_);
-                s->a[i]->fit = fitValue;
+                source[i] = i;
+                memcpy(candidate[i]->x, s->a[i]->x, s->n * sizeof(double));
+                candidate[i]->x[chosen_param] = s->a[i]->x[chosen_param] + (s->a[i]->x[chosen_param] - s->a[neighbour]->x[chosen_param]) * r;
+                CheckAgentLimits(s, candidate[i]);
             }
-            else
-            {
-                trial[i]++; /* If the solution could not be improved, we increase the trial counter */
-            }
-            if (fitValue < s->gfit)
-            { /* Update the global best */
-                s->gfit = fitValue;
-                for (j = 0; j < s->n; j++)
-                    s->g[j] = tmp->x[j];
-            }
-            DestroyAgent(&tmp, _ABC_);
+            va_copy(arg, argtmp);
+            ApplyBeeTrials(s, candidate, source, s->m, trial, Evaluate, arg);
         }
-
-        /* Calculation of new probabilities */
-        max_fitness = s->a[0]->fit;
-        for (i = 1; i < s->m; i++)
-            if (s->a[i]->fit > max_fitness)
-                max_fitness = s->a[i]->fit;
-        for (i = 0; i < s->m; i++)
-            prob[i] = (0.9 * (s->a[i]->fit / (max_fitness + 0.00000001))) + 0.1;
-
-        /* Onlooker Bee step */
-        i = 0;
-        k = 0;
-        while (k < s->m)
+        else
         {
-            r = GenerateUniformRandomNumber(0, 1);
-            if (r < prob[i])
-            {
+            for (i = 0; i < s->m; i++)
+            { /* For each food source */
                 va_copy(arg, argtmp);
-                k++;
+
                 chosen_param = GenerateUniformRandomNumber(0, s->n - 1); /* Randomly parameter to be used */
                 do
                 {
                     neighbour = GenerateUniformRandomNumber(0, s->m - 1); /* Randomly neighbour to be used, which must be different from i */
                 } while (neighbour == i);
+                r = GenerateUniformRandomNumber(0, 1);
 
                 tmp = CopyAgent(s->a[i], _ABC_, _NOTENSOR_);
                 tmp->x[chosen_param] = s->a[i]->x[chosen_param] + (s->a[i]->x[chosen_param] - s->a[neighbour]->x[chosen_param]) * r; /* We now update our currently solution */
                 CheckAgentLimits(s, tmp);
-                fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
+
+                fitValue = EvaluateCandidate(s, tmp, s->a[i]->fit, Evaluate, arg); /* It executes the fitness function for agent tmp, unless the surrogate model discards it */
                 if (fitValue < s->a[i]->fit)
                 { /* We accept the new solution */
                     trial[i] = 0;
@@ -130,9 +157,87 @@ void runABC(SearchSpace *s, prtFun Evaluate, ...)
                 }
                 DestroyAgent(&tmp, _ABC_);
             }
-            i++;
-            if (i == s->m)
-                i = 0;
+        }
+
+        /* Calculation of new probabilities */
+        max_fitness = s->a[0]->fit;
+        for (i = 1; i < s->m; i++)
+            if (s->a[i]->fit > max_fitness)
+                max_fitness = s->a[i]->fit;
+        for (i = 0; i < s->m; i++)
+            prob[i] = (0.9 * (s->a[i]->fit / (max_fitness + 0.00000001))) + 0.1;
+
+        /* Onlooker Bee step */
+        i = 0;
+        k = 0;
+        if (candidate)
+        { /* the onlookers draw their food sources up front and build their trials from the snapshot of the food sources */
+            while (k < s->m)
+            {
+                r = GenerateUniformRandomNumber(0, 1);
+                if (r < prob[i])
+                {
+                    chosen_param = GenerateUniformRandomNumber(0, s->n - 1); /* Randomly parameter to be used */
+                    do
+                    {
+                        neighbour = GenerateUniformRandomNumber(0, s->m - 1); /* Randomly neighbour to be used, which must be different from i */
+                    } while (neighbour == i);
+
+                    source[k] = i;
+                    memcpy(candidate[k]->x, s->a[i]->x, s->n * sizeof(double));
+                    candidate[k]->x[chosen_param] = s->a[i]->x[chosen_param] + (s->a[i]->x[chosen_param] - s->a[neighbour]->x[chosen_param]) * r;
+                    CheckAgentLimits(s, candidate[k]);
+                    k++;
+                }
+                i++;
+                if (i == s->m)
+                    i = 0;
+            }
+            va_copy(arg, argtmp);
+            ApplyBeeTrials(s, candidate, source, s->m, trial, Evaluate, arg);
+        }
+        else
+        {
+            while (k < s->m)
+            {
+                r = GenerateUniformRandomNumber(0, 1);
+                if (r < prob[i])
+                {
+                    va_copy(arg, argtmp);
+                    k++;
+                    chosen_param = GenerateUniformRandomNumber(0, s->n - 1); /* Randomly parameter to be used */
+                    do
+                    {
+                        neighbour = GenerateUniformRandomNumber(0, s->m - 1); /* Randomly neighbour to be used, which must be different from i */
+                    } while (neighbour == i);
+
+                    tmp = CopyAgent(s->a[i], _ABC_, _NOTENSOR_);
+                    tmp->x[chosen_param] = s->a[i]->x[chosen_param] + (s->a[i]->x[chosen_param] - s->a[neighbour]->x[chosen_param]) * r; /* We now update our currently solution */
+                    CheckAgentLimits(s, tmp);
+                    fitValue = EvaluateCandidate(s, tmp, s->a[i]->fit, Evaluate, arg); /* It executes the fitness function for agent tmp, unless the surrogate model discards it */
+                    if (fitValue < s->a[i]->fit)
+                    { /* We accept the new solution */
+                        trial[i] = 0;
+                        DestroyAgent(&(s->a[i]), _ABC_);
+                        s->a[i] = CopyAgent(tmp, _ABC_, _NOTENSOR_);
+                        s->a[i]->fit = fitValue;
+                    }
+                    else
+                    {
+                        trial[i]++; /* If the solution could not be improved, we increase the trial counter */
+                    }
+                    if (fitValue < s->gfit)
+                    { /* Update the global best */
+                        s->gfit = fitValue;
+                        for (j = 0; j < s->n; j++)
+                            s->g[j] = tmp->x[j];
+                    }
+                    DestroyAgent(&tmp, _ABC_);
+                }
+                i++;
+                if (i == s->m)
+                    i = 0;
+            }
         }
 
         /* Scout Bee step */
@@ -146,7 +251,7 @@ void runABC(SearchSpace *s, prtFun Evaluate, ...)
             trial[max_trial_index] = 0;
             tmp = GenerateNewAgent(s, _ABC_);
             CheckAgentLimits(s, tmp);
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for new created agent */
+            fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for new created agent */
             if (fitValue < s->a[max_trial_index]->fit)
             { /* We accept the new solution */
                 DestroyAgent(&(s->a[max_trial_index]), _ABC_);
@@ -167,6 +272,13 @@ void runABC(SearchSpace *s, prtFun Evaluate, ...)
 
     free(trial);
     free(prob);
+    if (candidate)
+    {
+        free(source);
+        free(block);
+        free(candidate_data);
+        free(candidate);
+    }
     va_end(arg);
 }
 
@@ -196,9 +308,10 @@ void runTensorABC(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
     trial = (int *)calloc(s->m, sizeof(int));
     prob = (double *)calloc(s->m, sizeof(double));
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _ABC_, tensor_id, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -222,7 +335,7 @@ void runTensorABC(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
             for (j = 0; j < s->n; j++)
                 tmp->x[j] = TensorSpan(s->LB[j], s->UB[j], tmp_t[j], tensor_id);
 
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
+            fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent tmp */
             if (fitValue < s->a[i]->fit)
             { /* We accept the new solution */
                 trial[i] = 0;
@@ -280,7 +393,7 @@ void runTensorABC(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
                 for (j = 0; j < s->n; j++)
                     tmp->x[j] = TensorSpan(s->LB[j], s->UB[j], tmp_t[j], tensor_id);
 
-                fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
+                fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent tmp */
                 if (fitValue < s->a[i]->fit)
                 { /* We accept the new solution */
                     trial[i] = 0;
@@ -324,7 +437,7 @@ void runTensorABC(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
             CheckTensorLimits(s, tmp_t, tensor_id);
             for (j = 0; j < s->n; j++)
                 tmp->x[j] = TensorSpan(s->LB[j], s->UB[j], tmp_t[j], tensor_id);
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for new created agent */
+            fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for new created agent */
             if (fitValue < s->a[max_trial_index]->fit)
             { /* We accept the new solution */
                 DestroyTensor(&s->a[max_trial_index]->t, s->n);
@@ -49,7 +49,9 @@ void SetBatFrequency(SearchSpace *s, int i)
     s->a[i]->f = s->f_min + (s->f_min - s->f_max) * beta;
 }
 
-/* It executes the Bat Algorithm for function minimization
+/* It executes the Bat Algorithm for function minimization. The random numbers of each iteration are drawn at once: a block
+with the frequency, the choice of local search and the acceptance draws of every bat, and a block with the random walks of the
+bats that perform local search. Candidates are built in a single buffer, so no agent is allocated within the iterations.
 Parameters:
 s: search space
 Evaluate: pointer to the function used to evaluate particles
@@ -57,8 +59,9 @@ arg: list of additional arguments */
 void runBA(SearchSpace *s, prtFun Evaluate, ...)
 {
     va_list arg, argtmp;
-    int t, i, j;
-    double alpha = 0.9, beta, prob, fitValue;
+    int t, i, j, n_walks;
+    double alpha = 0.9, fitValue, *rnd = NULL, *walk = NULL, *w = NULL;
+    char local;
     Agent *tmp = NULL;
 
     va_start(arg, Evaluate);
@@ -77,42 +80,58 @@ void runBA(SearchSpace *s, prtFun Evaluate, ...)
         s->a[i]->A = GenerateUniformRandomNumber(0, s->A);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _BA_, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    tmp = CreateAgent(s->n, _BA_, _NOTENSOR_); /* candidate bat, reused by every bat */
+    rnd = (double *)malloc(3 * s->m * sizeof(double)); /* frequency, local search and acceptance draws of each bat */
+    walk = (double *)malloc((size_t)s->m * s->n * sizeof(double)); /* random walks of the bats that perform local search */
+
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
+        /* A bat performs local search if its draw exceeds its pulse rate, which only changes after its own turn */
+        GenerateUniformRandomArray(rnd, 3 * s->m, 0, 1);
+        for (i = 0, n_walks = 0; i < s->m; i++)
+            n_walks += (rnd[s->m + i] > s->a[i]->r);
+        if (n_walks)
+            GenerateUniformRandomArray(walk, n_walks * s->n, 0, 1);
+        w = walk;
+
+        /* Equation 1 (see SetBatFrequency) */
+        for (i = 0; i < s->m; i++)
+            s->a[i]->f = s->f_min + (s->f_min - s->f_max) * rnd[i];
+
         /* for each bat */
         for (i = 0; i < s->m; i++)
         {
             va_copy(arg, argtmp);
 
-            SetBatFrequency(s, i);   /* Equation 1 */
             UpdateBatVelocity(s, i); /* Equation 2 */
 
-            /* Equation 3
-            Here, we generate a temporary agent (bat) */
-            tmp = CopyAgent(s->a[i], _BA_, _NOTENSOR_);
-            for (j = 0; j < s->n; j++)
-                tmp->x[j] = tmp->x[j] + tmp->v[j];
-            /**************/
-
-            prob = GenerateUniformRandomNumber(0, 1);
-            if (prob > s->a[i]->r)
-            {
-                DestroyAgent(&tmp, _BA_);
-                tmp = GenerateNewAgent(s, _BA_);
+            local = (rnd[s->m + i] > s->a[i]->r);
+            if (local)
+            { /* random walk around the best solution (see GenerateNewAgent) */
+                for (j = 0; j < s->n; j++)
+                    tmp->x[j] = s->g[j] + 0.001 * w[j];
+                w += s->n;
+            }
+            else
+            { /* Equation 3 */
+                for (j = 0; j < s->n; j++)
+                    tmp->x[j] = s->a[i]->x[j] + s->a[i]->v[j];
             }
             CheckAgentLimits(s, tmp);
 
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent i */
-            prob = GenerateUniformRandomNumber(0, 1);
-            if ((fitValue < s->a[i]->fit) && (prob < s->a[i]->A))
+            fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent i */
+            if ((fitValue < s->a[i]->fit) && (rnd[2 * s->m + i] < s->a[i]->A))
             { /* We accept the new solution */
-                DestroyAgent(&(s->a[i]), _BA_);
-                s->a[i] = CopyAgent(tmp, _BA_, _NOTENSOR_);
+                memcpy(s->a[i]->x, tmp->x, s->n * sizeof(double));
+                if (local) /* a bat generated by a random walk starts at rest */
+                    memset(s->a[i]->v, 0, s->n * sizeof(double));
                 s->a[i]->fit = fitValue;
+                s->a[i]->cv = tmp->cv;
                 s->a[i]->r = s->r * (1 - exp(-alpha * t));
                 s->a[i]->A = s->A * alpha;
             }
@@ -123,13 +142,15 @@ void runBA(SearchSpace *s, prtFun Evaluate, ...)
                 for (j = 0; j < s->n; j++)
                     s->g[j] = tmp->x[j];
             }
-
-            DestroyAgent(&tmp, _BA_);
         }
 
         fprintf(stderr, "OK (minimum fitness value %lf)", s->gfit);
     }
 
+    DestroyAgent(&tmp, _BA_);
+    free(rnd);
+    free(walk);
+
     va_end(arg);
 }
 /*************************/
@@ -223,9 +244,10 @@ void runTensorBA(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         s->a[i]->A = GenerateUniformRandomNumber(0, s->A);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _BA_, tensor_id, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -259,7 +281,7 @@ void runTensorBA(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
             for (j = 0; j < s->n; j++)
                 tmp->x[j] = TensorSpan(s->LB[j], s->UB[j], tmp_t[j], tensor_id);
 
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent i */
+            fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent i */
             prob = GenerateUniformRandomNumber(0, 1);
             if ((fitValue < s->a[i]->fit) && (prob < s->a[i]->A))
             { /* We accept the new solution */
@@ -36,9 +36,10 @@ void runBHA(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _BHA_, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -55,7 +56,7 @@ void runBHA(SearchSpace *s, prtFun Evaluate, ...)
                 s->a[i]->x[j] += rand * (s->g[j] - s->a[i]->x[j]);
 
             CheckAgentLimits(s, s->a[i]);
-            s->a[i]->fit = Evaluate(s->a[i], arg); /* It executes the fitness function for agent i */
+            s->a[i]->fit = EvaluateFitness(s, s->a[i], Evaluate, arg); /* It executes the fitness function for agent i */
 
             tmp = CopyAgent(s->a[i], _BHA_, _NOTENSOR_);
             if (s->a[i]->fit < s->gfit)
@@ -117,9 +118,10 @@ void runTensorBHA(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _BHA_, tensor_id, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -139,7 +141,7 @@ void runTensorBHA(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
             CheckTensorLimits(s, s->a[i]->t, tensor_id);
             for (j = 0; j < s->n; j++)
                 s->a[i]->x[j] = TensorSpan(s->LB[j], s->UB[j], s->a[i]->t[j], tensor_id);
-            s->a[i]->fit = Evaluate(s->a[i], arg); /* It executes the fitness function for agent i */
+            s->a[i]->fit = EvaluateFitness(s, s->a[i], Evaluate, arg); /* It executes the fitness function for agent i */
 
             tmp = CopyAgent(s->a[i], _BHA_, _NOTENSOR_);
             tmp_t = CopyTensor(s->a[i]->t, s->n, tensor_id);
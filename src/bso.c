@@ -165,7 +165,7 @@ void runBSO(SearchSpace *s, prtFun Evaluate, ...)
 {
 	va_list arg, argtmp;
 	int i, j, z, k, t, *best = NULL, c1, c2, **ideas_per_cluster = NULL;
-	double p, r;
+	double p, r, *noise = NULL;
 	Agent *nidea = NULL;
 
 	va_start(arg, Evaluate);
@@ -180,16 +180,21 @@ void runBSO(SearchSpace *s, prtFun Evaluate, ...)
 	ideas_per_cluster = (int **)malloc(s->k * sizeof(int *));
 	best = (int *)malloc(s->k * sizeof(int));
 	nidea = CreateAgent(s->n, _BSO_, _NOTENSOR_);
+	noise = (double *)malloc(s->m * s->n * sizeof(double));
 
+	ResetTermination(s); /* It starts counting evaluations, time and stagnation */
 	EvaluateSearchSpace(s, _BSO_, Evaluate, arg); /* Initial evaluation */
 
-	for (t = 1; t <= s->iterations; t++)
+	for (t = 1; !StopOptimization(s, t); t++)
 	{
 		fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
 		/* clustering ideas */
 		k_means(s, best, &ideas_per_cluster);
 
+		/* drawing the Gaussian noise of all new ideas at once */
+		GenerateGaussianRandomArray(noise, s->m * s->n, 0, 1);
+
 		/* for each idea */
 		for (i = 0; i < s->m; i++)
 		{
@@ -264,11 +269,11 @@ void runBSO(SearchSpace *s, prtFun Evaluate, ...)
 			r = GenerateUniformRandomNumber(0, 1) * Logistic_Sigmoid(p);
 
 			for (k = 0; k < s->n; k++)
-				nidea->x[k] += r * randGaussian(0, 1);
+				nidea->x[k] += r * noise[i * s->n + k];
 
 			/* It evaluates the new created idea */
 			CheckAgentLimits(s, nidea);
-			p = Evaluate(nidea, arg);
+			p = EvaluateFitness(s, nidea, Evaluate, arg);
 			if (p < s->a[i]->fit)
 			{ /* if the new idea is better than the current one */
 				for (k = 0; k < s->n; k++)
@@ -288,6 +293,7 @@ void runBSO(SearchSpace *s, prtFun Evaluate, ...)
 
 	free(ideas_per_cluster);
 	free(best);
+	free(noise);
 	DestroyAgent(&nidea, _BSO_);
 	va_end(arg);
 }
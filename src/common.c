@@ -13,9 +13,19 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+#ifdef __linux__
+#define _GNU_SOURCE /* sched_setaffinity and the CPU_* macros */
+#include <sched.h>
+#endif
+#include <unistd.h>
+
 #include "common.h"
 #include "function.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /* number of arguments (descendants) required by each terminal function in GP in the following order:
 SUM, SUB, MUL, DIV, EXP, SQRT, LOG, ABS, AND, OR, XOR, NOT, TSUM, TSUB, TMUL and TDIV */
 const int N_ARGS_FUNCTION[] = {2, 2, 2, 2, 1, 1, 1, 1, 2, 2, 2, 1, 2, 2, 2, 2};
@@ -36,7 +46,10 @@ Agent *CreateAgent(int n, int opt_id, int tensor_dim){
     a = (Agent *)malloc(sizeof(Agent));
     a->v = NULL;
     a->xl = NULL;
+    a->b = NULL;
+    a->bl = NULL;
     a->fit = DBL_MAX;
+    a->cv = 0;
     a->t = NULL;
     a->t_v = NULL;
     a->t_xl = NULL;
@@ -139,10 +152,43 @@ void DestroyAgent(Agent **a, int opt_id){
             fprintf(stderr, "\nInvalid optimization identifier @DestroyAgent.\n");
             break;
     }
+    if (tmp->b) free(tmp->b);
+    if (tmp->bl) free(tmp->bl);
 
     free(tmp);
 }
 
+/* It turns an agent into a binary one, i.e., its real-valued position and local best are replaced by bit-packed ones.
+The velocity is only kept by PSO, whose binary version still uses real-valued velocities.
+Parameters:
+a: agent
+opt_id: identifier of the optimization technique */
+static void MakeBinaryAgent(Agent *a, int opt_id)
+{
+    int words = getBinaryWords(a->n);
+
+    if (a->x)
+    {
+        free(a->x);
+        a->x = NULL;
+    }
+    if (a->xl)
+    {
+        free(a->xl);
+        a->xl = NULL;
+    }
+    if ((opt_id != _PSO_) && a->v)
+    {
+        free(a->v);
+        a->v = NULL;
+    }
+
+    if (!a->b)
+        a->b = (uint64_t *)calloc(words, sizeof(uint64_t));
+    if ((opt_id == _PSO_) && !a->bl)
+        a->bl = (uint64_t *)calloc(words, sizeof(uint64_t));
+}
+
 /* It checks whether a given agent has excedeed boundaries
 Parameters:
 s: search space
@@ -181,6 +227,18 @@ Agent *CopyAgent(Agent *a, int opt_id, int tensor_dim)
 
     Agent *cpy = NULL;
     cpy = CreateAgent(a->n, opt_id, tensor_dim);
+    cpy->cv = a->cv;
+
+    if (a->b)
+    { /* binary agent */
+        MakeBinaryAgent(cpy, opt_id);
+        memcpy(cpy->b, a->b, getBinaryWords(a->n) * sizeof(uint64_t));
+        if (a->bl && cpy->bl)
+            memcpy(cpy->bl, a->bl, getBinaryWords(a->n) * sizeof(uint64_t));
+        if (a->v && cpy->v)
+            memcpy(cpy->v, a->v, a->n * sizeof(double));
+        return cpy;
+    }
 
     switch (opt_id)
     {
@@ -235,7 +293,7 @@ void EvaluateAgent(SearchSpace *s, Agent *a, int opt_id, prtFun Evaluate, va_lis
         for (i = 0; i < s->n; i++)
             a->prev_x[i] = a->x[i];
 
-        a->fit = Evaluate(a, arg);
+        a->fit = EvaluateFitness(s, a, Evaluate, arg);
         
         /* if the actual fit is the best fitness so far of the agent */
         if (a->fit < a->best_fit)
@@ -344,9 +402,64 @@ Agent *GenerateNewAgent(SearchSpace *s, int opt_id)
     return a;
 }
 
+/* It resets an agent to the state of a newly created one, keeping its allocations. Its position is kept, since it is
+re-initialized by InitializeSearchSpace.
+Parameters:
+a: agent */
+void ResetAgent(Agent *a)
+{
+    if (!a)
+    {
+        fprintf(stderr, "\nAgent not allocated @ResetAgent.\n");
+        exit(-1);
+    }
+
+    a->fit = DBL_MAX;
+    a->cv = 0;
+    a->pfit = DBL_MAX;
+    a->best_fit = DBL_MAX;
+    a->f = NAN;
+    a->r = NAN;
+    a->A = NAN;
+    if (a->v)
+        memset(a->v, 0, a->n * sizeof(double));
+    if (a->xl)
+        memset(a->xl, 0, a->n * sizeof(double));
+    if (a->prev_x)
+        memset(a->prev_x, 0, a->n * sizeof(double));
+    if (a->bl)
+        memset(a->bl, 0, getBinaryWords(a->n) * sizeof(uint64_t));
+}
+
 /**************************/
 
 /* Search Space-related functions */
+/* It hands the lions of the pool out to the nomads and to the prides, in this order, according to the sizes set by
+CreateSearchSpace. LOA keeps these sizes at the end of every iteration, so the remaining lions go back to the stack of free ones.
+Parameters:
+s: search space */
+static void AssignLions(SearchSpace *s)
+{
+    int i, j, k = 0; /* k is the next lion of the pool to be handed out */
+
+    for (i = 0; i < s->n_female_nomads; i++)
+        s->female_nomads[i] = s->lion[k++];
+    for (i = 0; i < s->n_male_nomads; i++)
+        s->male_nomads[i] = s->lion[k++];
+    for (i = 0; i < s->n_prides; i++)
+    {
+        for (j = 0; j < s->pride_id[i].n_females; j++)
+            s->pride_id[i].females[j] = s->lion[k++];
+        for (j = 0; j < s->pride_id[i].n_males; j++)
+            s->pride_id[i].males[j] = s->lion[k++];
+    }
+
+    /* the remaining lions are not alive yet */
+    s->n_free_lions = 0;
+    while (k < s->lion_capacity)
+        s->free_lion[s->n_free_lions++] = s->lion[k++];
+}
+
 /* It creates a search space
 Parameters:
 m: number of agents
@@ -364,16 +477,42 @@ SearchSpace *CreateSearchSpace(int m, int n, int opt_id, ...){
         fprintf(stderr, "\nInvalid parameters @CreateSearchSpace.\n");
         return NULL;
     }
-    int i, j, remained_lions, tensor_dim;
+    int i, j, remained_lions, pride_size, tensor_dim;
 
     va_start(arg, opt_id);
     s = (SearchSpace *)malloc(sizeof(SearchSpace));
     s->m = m;
+    s->m_alloc = m;
     s->n = n;
     s->gfit = DBL_MAX;
     s->iterations = 0;
     s->is_integer_opt = 1;
+    s->is_binary_opt = 0;
+    s->gb = NULL;
     s->tensor_dim = -1;
+    s->stop.max_evaluations = 0;
+    s->stop.max_time = 0;
+    s->stop.max_stagnation = 0;
+    s->stop.tolerance = 0;
+    s->stop.n_evaluations = 0;
+    s->stop.n_infeasible = 0;
+    s->stop.start_time = 0;
+    s->stop.stagnation = 0;
+    s->stop.last_gfit = DBL_MAX;
+    s->stop.reason = 0;
+    s->surrogate = NULL;
+    s->archive = NULL;
+    s->n_threads = 1;
+    s->numa = 0;
+    s->topology = NULL;
+    s->n_constraints = 0;
+    s->constraint = NULL;
+    s->gcv = DBL_MAX;
+    s->cache_budget = 0;
+    s->tree_cache = NULL;
+    s->n_tree_caches = 0;
+    s->jit = 0;
+    s->tree_kernel = NULL;
 
     /* PSO */
     s->w = NAN;
@@ -401,6 +540,8 @@ SearchSpace *CreateSearchSpace(int m, int n, int opt_id, ...){
     s->pReproduction = NAN;
     s->pMutation = NAN;
     s->pCrossover = NAN;
+    s->selection = _ROULETTE_;
+    s->tournament_size = TOURNAMENT_SIZE;
 
     /* WCA */
     s->nsr = 0;
@@ -418,6 +559,7 @@ SearchSpace *CreateSearchSpace(int m, int n, int opt_id, ...){
     s->HMCR = NAN;
     s->PAR = NAN;
     s->bw = NAN;
+    s->batch_size = 1;
 
     /* IHS */
     s->PAR_min = NAN;
@@ -462,6 +604,8 @@ SearchSpace *CreateSearchSpace(int m, int n, int opt_id, ...){
         if ((opt_id == _GP_) || (opt_id == _TGP_)){
             s->min_depth = va_arg(arg, int);
             s->max_depth = va_arg(arg, int);
+            s->max_tree_depth = MAX_TREE_DEPTH;
+            s->max_tree_size = MAX_TREE_SIZE;
             s->n_terminals = va_arg(arg, int);
             s->n_constants = va_arg(arg, int);
             s->n_functions = va_arg(arg, int);
@@ -496,14 +640,8 @@ SearchSpace *CreateSearchSpace(int m, int n, int opt_id, ...){
             s->imigration_rate = va_arg(arg, double); /* getting the percent of female lions that will imigrate */
             s->n_prides = va_arg(arg, int);           /* getting the number of prides */
             s->g = (double *)calloc(s->n, sizeof(double));
-            s->n_female_nomads = round(s->m * s->nomad_percent * (1 - s->sex_rate));   /* determining de number of nomad females */
-            s->female_nomads = (Agent **)malloc(sizeof(Agent *) * s->n_female_nomads); /* allocating the array of nomad females */
-            for (i = 0; i < s->n_female_nomads; i++)
-                s->female_nomads[i] = CreateAgent(s->n, opt_id, _NOTENSOR_);                   /* not using the array of agents */
+            s->n_female_nomads = round(s->m * s->nomad_percent * (1 - s->sex_rate)); /* determining de number of nomad females */
             s->n_male_nomads = round(s->m * s->nomad_percent * s->sex_rate);       /* determining de number of nomad males */
-            s->male_nomads = (Agent **)malloc(sizeof(Agent *) * s->n_male_nomads); /* allocating the array of nomad males */
-            for (i = 0; i < s->n_male_nomads; i++)
-                s->male_nomads[i] = CreateAgent(s->n, opt_id, _NOTENSOR_); /* not using the array of agents */
 
             remained_lions = s->m - s->n_female_nomads - s->n_male_nomads; /* determining how many lions will be in prides */
 
@@ -511,19 +649,43 @@ SearchSpace *CreateSearchSpace(int m, int n, int opt_id, ...){
             int *qty_lions_each_pride = (int *)calloc(s->n_prides, sizeof(int)); /* each index represents how many lions are in pride i */
             for (i = 0; i < remained_lions; i++)                                 /* for each remaning lion that is not nomad... */
                 qty_lions_each_pride[(int)GenerateUniformRandomNumber(0, s->n_prides)]++; /* sum one on a random index */
-            
+
+            /* Every female may give birth to a male and a female cub within an iteration, so the pool holds the population
+            plus two lions per female. Lions are never created nor destroyed while LOA runs, only moved among the lists below. */
+            s->lion_capacity = s->m + 2 * s->n_female_nomads;
             s->pride_id = (struct Pride *)malloc(sizeof(struct Pride) * s->n_prides); /* allocating the array of prides */
-            for (i = 0; i < s->n_prides; i++){                                                                                          /* for each pride... */
-                s->pride_id[i].n_females = round(qty_lions_each_pride[i] * (1 - s->sex_rate));         /* determining de number of females in that pride */
-                s->pride_id[i].females = (Agent **)malloc(sizeof(Agent *) * s->pride_id[i].n_females); /* allocating the array of females from that pride */
-                for (j = 0; j < s->pride_id[i].n_females; j++)
-                    s->pride_id[i].females[j] = CreateAgent(s->n, opt_id, _NOTENSOR_);                         /* not using the array of agents */
-                s->pride_id[i].n_males = qty_lions_each_pride[i] - s->pride_id[i].n_females;       /* determining the number of males in that pride */
-                s->pride_id[i].males = (Agent **)malloc(sizeof(Agent *) * s->pride_id[i].n_males); /* allocating the array of males from that pride */
-                for (j = 0; j < s->pride_id[i].n_males; j++)
-                    s->pride_id[i].males[j] = CreateAgent(s->n, opt_id, _NOTENSOR_); /* not using the array of agents */
+            for (i = 0; i < s->n_prides; i++){
+                s->pride_id[i].n_females = round(qty_lions_each_pride[i] * (1 - s->sex_rate)); /* determining de number of females in that pride */
+                s->pride_id[i].n_males = qty_lions_each_pride[i] - s->pride_id[i].n_females;   /* determining the number of males in that pride */
+                s->lion_capacity += 2 * s->pride_id[i].n_females;
             }
             free(qty_lions_each_pride);
+
+            s->lion = (Agent **)malloc(sizeof(Agent *) * s->lion_capacity); /* allocating the pool of lions */
+            for (i = 0; i < s->lion_capacity; i++)
+                s->lion[i] = CreateAgent(s->n, opt_id, _NOTENSOR_); /* not using the array of agents */
+            s->free_lion = (Agent **)malloc(sizeof(Agent *) * s->lion_capacity);
+            s->lion_index = (int *)malloc(sizeof(int) * s->lion_capacity);
+            s->lion_flag = (char *)malloc(sizeof(char) * s->lion_capacity);
+            s->pride_count = (int *)malloc(sizeof(int) * (5 * s->n_prides + 1));
+
+            /* nomads may temporarily hold any lion of the pool */
+            s->female_nomads = (Agent **)malloc(sizeof(Agent *) * s->lion_capacity); /* allocating the array of nomad females */
+            s->male_nomads = (Agent **)malloc(sizeof(Agent *) * s->lion_capacity); /* allocating the array of nomad males */
+
+            /* a pride may temporarily hold one male and one female cub per resident female */
+            for (i = 0; i < s->n_prides; i++){
+                pride_size = 2 * s->pride_id[i].n_females + s->pride_id[i].n_males; /* largest size of the pride */
+                s->pride_id[i].females = (Agent **)malloc(sizeof(Agent *) * 2 * s->pride_id[i].n_females); /* allocating the array of females from that pride */
+                s->pride_id[i].males = (Agent **)malloc(sizeof(Agent *) * (s->pride_id[i].n_males + s->pride_id[i].n_females)); /* allocating the array of males from that pride */
+                s->pride_id[i].members = (Agent **)malloc(sizeof(Agent *) * pride_size);
+                s->pride_id[i].index = (int *)malloc(sizeof(int) * pride_size);
+                s->pride_id[i].flag = (char *)malloc(sizeof(char) * pride_size);
+                s->pride_id[i].prey = (double *)malloc(sizeof(double) * 3 * s->n); /* prey position followed by two direction vectors */
+                s->pride_id[i].g = (double *)malloc(sizeof(double) * s->n);
+            }
+
+            AssignLions(s);
         }
     }
 
@@ -552,7 +714,7 @@ void DestroySearchSpace(SearchSpace **s, int opt_id){
     /* GP and LOA uses a different structure than that of others */
     if ((opt_id != _GP_) && (opt_id != _TGP_) && (opt_id != _LOA_)){ 
         if (opt_id == _MBO_){ /* We free the neighbours allocation */
-            for (i = 0; i < tmp->m; i++){
+            for (i = 0; i < tmp->m_alloc; i++){
                 for (j = 0; j < tmp->k; j++)
                     if (tmp->a[i]->nb[j])
                         DestroyAgent(&(tmp->a[i]->nb[j]), opt_id);
@@ -560,7 +722,7 @@ void DestroySearchSpace(SearchSpace **s, int opt_id){
             }
         }
 
-        for (i = 0; i < tmp->m; i++)
+        for (i = 0; i < tmp->m_alloc; i++)
             if (tmp->a[i])
                 DestroyAgent(&(tmp->a[i]), opt_id);
         free(tmp->a);
@@ -623,21 +785,30 @@ void DestroySearchSpace(SearchSpace **s, int opt_id){
             }
             if (tmp->tree_fit) free(tmp->tree_fit);
             if (tmp->g) free(tmp->g);
+
+            for (i = 0; i < tmp->n_tree_caches; i++)
+                DestroyTreeCache(&(tmp->tree_cache[i]));
+            if (tmp->tree_cache) free(tmp->tree_cache);
         }
         if (opt_id == _LOA_){
-            for (i = 0; i < tmp->n_female_nomads; i++)
-                DestroyAgent(&(tmp->female_nomads[i]), opt_id);
+            /* the pool owns every lion, so the membership lists only need to be freed */
+            for (i = 0; i < tmp->lion_capacity; i++)
+                DestroyAgent(&(tmp->lion[i]), opt_id);
+            free(tmp->lion);
+            free(tmp->free_lion);
+            free(tmp->lion_index);
+            free(tmp->lion_flag);
+            free(tmp->pride_count);
             free(tmp->female_nomads);
-            for (i = 0; i < tmp->n_male_nomads; i++)
-                DestroyAgent(&(tmp->male_nomads[i]), opt_id);
             free(tmp->male_nomads);
             for (i = 0; i < tmp->n_prides; i++){
-                for (j = 0; j < tmp->pride_id[i].n_females; j++)
-                    DestroyAgent(&(tmp->pride_id[i].females[j]), opt_id);
                 free(tmp->pride_id[i].females);
-                for (j = 0; j < tmp->pride_id[i].n_males; j++)
-                    DestroyAgent(&(tmp->pride_id[i].males[j]), opt_id);
                 free(tmp->pride_id[i].males);
+                free(tmp->pride_id[i].members);
+                free(tmp->pride_id[i].index);
+                free(tmp->pride_id[i].flag);
+                free(tmp->pride_id[i].prey);
+                free(tmp->pride_id[i].g);
             }
             free(tmp->pride_id);
             free(tmp->g);
@@ -646,6 +817,11 @@ void DestroySearchSpace(SearchSpace **s, int opt_id){
 
     if (tmp->LB) free(tmp->LB);
     if (tmp->UB) free(tmp->UB);
+    if (tmp->surrogate) DestroySurrogate(&tmp->surrogate);
+    if (tmp->archive) DestroyArchive(&tmp->archive);
+    if (tmp->constraint) free(tmp->constraint);
+    if (tmp->gb) free(tmp->gb);
+    if (tmp->topology) DestroyTopology(&tmp->topology);
 
     free(tmp);
     tmp = NULL;
@@ -676,6 +852,11 @@ void InitializeSearchSpace(SearchSpace *s, int opt_id){
         case _ABC_:
         case _BSO_:
         case _HS_:
+            if (s->is_binary_opt){ /* every bit is set with probability 0.5 */
+                for (i = 0; i < s->m; i++)
+                    GenerateBinaryArray(s->a[i]->b, s->n, 0.5);
+                break;
+            }
             for (i = 0; i < s->m; i++){
                 for (j = 0; j < s->n; j++)
                     s->a[i]->x[j] = GenerateUniformRandomNumber(s->LB[j], s->UB[j]);
@@ -718,6 +899,117 @@ void InitializeSearchSpace(SearchSpace *s, int opt_id){
     }
 }
 
+/* It changes the number of agents of a search space. When the population shrinks, the extra agents are kept allocated
+(but not used) so that they can be reused by a further growth. New agents must be initialized afterwards, e.g., by InitializeSearchSpace.
+Parameters:
+s: search space
+m: new number of agents
+opt_id: identifier of the optimization technique */
+void ResizeSearchSpace(SearchSpace *s, int m, int opt_id){
+    if (!s){
+        fprintf(stderr, "\nSearch space not allocated @ResizeSearchSpace.\n");
+        exit(-1);
+    }
+
+    int i, j;
+
+    if ((m < 1) || (opt_id == _GP_) || (opt_id == _TGP_) || (opt_id == _LOA_)){
+        fprintf(stderr, "\nInvalid number of agents or optimization identifier @ResizeSearchSpace.\n");
+        exit(-1);
+    }
+
+    if (m > s->m_alloc){
+        s->a = (Agent **)realloc(s->a, m * sizeof(Agent *));
+        for (i = s->m_alloc; i < m; i++){
+            s->a[i] = CreateAgent(s->n, opt_id, _NOTENSOR_);
+            if (s->is_binary_opt)
+                MakeBinaryAgent(s->a[i], opt_id);
+            if (opt_id == _MBO_){
+                s->a[i]->nb = (Agent **)malloc(s->k * sizeof(Agent *));
+                for (j = 0; j < s->k; j++)
+                    s->a[i]->nb[j] = CreateAgent(s->n, opt_id, _NOTENSOR_);
+            }
+        }
+        s->m_alloc = m;
+    }
+
+    s->m = m;
+}
+
+/* It prepares a search space to solve a new problem with the same shape, keeping all of its allocations. The agents are
+re-initialized within the current boundaries (so LB and UB must be set beforehand), and the fitness values, the global best,
+the archives of the surrogate model and of the multi-objective techniques, and the termination counters are cleared. The other parameters are kept. GP trees are grown again,
+LOA lions are handed out to the prides and nomads as CreateSearchSpace did, and tensors are drawn again if the search space was initialized by InitializeTensorSearchSpace.
+Parameters:
+s: search space
+opt_id: identifier of the optimization technique */
+void ResetSearchSpace(SearchSpace *s, int opt_id){
+    if (!s){
+        fprintf(stderr, "\nSearch space not allocated @ResetSearchSpace.\n");
+        exit(-1);
+    }
+
+    int i, j;
+
+    switch (opt_id){
+        case _GP_:
+        case _TGP_:
+            for (i = 0; i < s->m; i++){
+                DestroyTree(&(s->T[i]));
+                s->T[i] = GROW(s, s->min_depth, s->max_depth);
+                s->tree_fit[i] = DBL_MAX;
+            }
+            for (i = 0; i < s->n_terminals; i++)
+                ResetAgent(s->a[i]);
+            break;
+        case _LOA_:
+            for (i = 0; i < s->lion_capacity; i++)
+                ResetAgent(s->lion[i]);
+            AssignLions(s); /* the pride and nomad lists are rebuilt as CreateSearchSpace left them */
+            break;
+        default:
+            for (i = 0; i < s->m; i++){
+                ResetAgent(s->a[i]);
+                if (s->a[i]->nb) /* MBO */
+                    for (j = 0; j < s->k; j++)
+                        ResetAgent(s->a[i]->nb[j]);
+            }
+            break;
+    }
+    if ((s->tensor_dim > 0) && (opt_id != _GP_) && (opt_id != _TGP_))
+    { /* the agents carry tensors of the dimension recorded by InitializeTensorSearchSpace */
+        for (i = 0; i < s->m; i++)
+            for (j = 0; j < s->n; j++)
+            {
+                if (s->a[i]->t_v)
+                    memset(s->a[i]->t_v[j], 0, s->tensor_dim * sizeof(double));
+                if (s->a[i]->t_xl)
+                    memset(s->a[i]->t_xl[j], 0, s->tensor_dim * sizeof(double));
+            }
+        if (s->t_g)
+            for (j = 0; j < s->n; j++)
+                memset(s->t_g[j], 0, s->tensor_dim * sizeof(double));
+        InitializeTensorSearchSpace(s, s->tensor_dim);
+    }
+    else
+        InitializeSearchSpace(s, opt_id);
+
+    memset(s->g, 0, s->n * sizeof(double));
+    if (s->gb)
+        memset(s->gb, 0, getBinaryWords(s->n) * sizeof(uint64_t));
+    s->gfit = DBL_MAX;
+    s->gcv = DBL_MAX;
+    s->best = 0;
+    ResetTermination(s);
+    if (s->surrogate){
+        s->surrogate->size = 0;
+        s->surrogate->next = 0;
+        s->surrogate->n_skipped = 0;
+    }
+    if (s->archive)
+        ClearArchive(s->archive);
+}
+
 /* It shows a search space
 Parameters:
 s: search space
@@ -750,7 +1042,12 @@ void ShowSearchSpace(SearchSpace *s, int opt_id)
         {
             fprintf(stderr, "\nAgent %d-> ", i);
             for (j = 0; j < s->n; j++)
-                fprintf(stderr, "x[%d]: %f   ", j, s->a[i]->x[j]);
+            {
+                if (s->is_binary_opt)
+                    fprintf(stderr, "x[%d]: %d   ", j, GetBinaryBit(s->a[i]->b, j));
+                else
+                    fprintf(stderr, "x[%d]: %f   ", j, s->a[i]->x[j]);
+            }
             fprintf(stderr, "fitness value: %f", s->a[i]->fit);
         }
         break;
@@ -827,6 +1124,303 @@ void ShowSearchSpace(SearchSpace *s, int opt_id)
     fprintf(stderr, "\n-----------------------------------------------------\n");
 }
 
+/* It makes sure there is one subtree cache per thread, with the memory budget of the search space split among them, and clears them
+Parameters:
+s: search space
+width: number of values of each output */
+static void PrepareTreeCaches(SearchSpace *s, int width)
+{
+    int i;
+    long int budget = s->cache_budget / s->n_threads;
+
+    if ((s->n_tree_caches != s->n_threads) || !s->tree_cache[0] || (s->tree_cache[0]->width != width) || (s->tree_cache[0]->budget != budget))
+    {
+        for (i = 0; i < s->n_tree_caches; i++)
+            DestroyTreeCache(&s->tree_cache[i]);
+        free(s->tree_cache);
+
+        s->n_tree_caches = s->n_threads;
+        s->tree_cache = (TreeCache **)malloc(s->n_tree_caches * sizeof(TreeCache *));
+        for (i = 0; i < s->n_tree_caches; i++)
+            s->tree_cache[i] = CreateTreeCache(budget, width); /* NULL if the budget is too small, which disables the cache */
+    }
+
+    for (i = 0; i < s->n_tree_caches; i++)
+        ClearTreeCache(s->tree_cache[i]);
+}
+
+/* It evaluates the boolean trees of a binary GP search space (see SetBinarySearchSpace) as EvaluateForest does, but over
+bit-packed terminals and constants, which are packed once. The output of every tree is written both at individual->b and,
+unpacked, at individual->x, so the fitness function may read either of them. Subtree caches and native code are not used.
+Parameters:
+s: search space
+L: linear trees (NULL to evaluate s->T)
+EvaluateFun: pointer to the function used to evaluate the trees
+arg: list of additional arguments */
+static void EvaluateBinaryForest(SearchSpace *s, LinearTree **L, prtFun Evaluate, va_list arg)
+{
+    int i, j, max_size = 1, words = getBinaryWords(s->n);
+    char improved = 0;
+    double *f = NULL, *cv = NULL;
+    uint64_t *b = NULL, *terminal = NULL, *constant = NULL;
+
+    terminal = (uint64_t *)malloc((size_t)s->n_terminals * words * sizeof(uint64_t));
+    for (i = 0; i < s->n_terminals; i++)
+        PackBinary(s->a[i]->x, s->n, terminal + (size_t)i * words);
+
+    if (s->constant && (s->n_constants > 0))
+    {
+        constant = (uint64_t *)calloc((size_t)s->n_constants * words, sizeof(uint64_t));
+        for (i = 0; i < s->n_constants; i++)
+            for (j = 0; j < s->n; j++)
+                if (s->constant[j][i] >= 0.5)
+                    SetBinaryBit(constant + (size_t)i * words, j, 1);
+    }
+
+    b = (uint64_t *)malloc((size_t)s->m * words * sizeof(uint64_t)); /* output of each tree */
+    f = (double *)malloc(s->m * sizeof(double));
+    cv = (double *)malloc(s->m * sizeof(double));
+
+    if (L)
+        for (i = 0; i < s->m; i++)
+            if (L[i]->size > max_size)
+                max_size = L[i]->size;
+
+#pragma omp parallel num_threads(s->n_threads) if (s->n_threads > 1)
+    {
+        int k;
+        uint64_t *stack = NULL;
+        Agent *individual = NULL;
+        va_list argtmp;
+
+        PinWorker(s); /* before allocating, so the working memory of the worker is placed on its node */
+        individual = CreateAgent(s->n, _GP_, _NOTENSOR_);
+        individual->b = (uint64_t *)malloc(words * sizeof(uint64_t));
+        if (L)
+            stack = (uint64_t *)malloc((size_t)max_size * words * sizeof(uint64_t));
+
+#pragma omp for schedule(static)
+        for (k = 0; k < s->m; k++)
+        {
+            if (L)
+                RunBinaryLinearTree(s, L[k], terminal, constant, individual->b, stack);
+            else
+                RunBinaryTree(s, s->T[k], terminal, constant, individual->b);
+            UnpackBinary(individual->b, s->n, individual->x);
+
+            va_copy(argtmp, arg); /* every tree reads the additional arguments from its own copy */
+            f[k] = EvaluateFitness(s, individual, Evaluate, argtmp);
+            va_end(argtmp);
+
+            cv[k] = individual->cv;
+            memcpy(b + (size_t)k * words, individual->b, words * sizeof(uint64_t));
+        }
+
+        DestroyAgent(&individual, _GP_);
+        if (stack)
+            free(stack);
+        UnpinWorker();
+    }
+
+    for (i = 0; i < s->m; i++)
+    {
+        if (f[i] < s->tree_fit[i]) /* It updates the fitness value */
+            s->tree_fit[i] = f[i];
+
+        if (IsBetterSolution(s->tree_fit[i], cv[i], s->gfit, s->gcv))
+        { /* It updates the global best value */
+            s->best = i;
+            s->gfit = s->tree_fit[i];
+            s->gcv = cv[i];
+            memcpy(s->gb, b + (size_t)i * words, words * sizeof(uint64_t));
+            improved = 1;
+        }
+    }
+    if (improved)
+        UnpackBinary(s->gb, s->n, s->g);
+
+    free(b);
+    free(f);
+    free(cv);
+    free(terminal);
+    if (constant)
+        free(constant);
+}
+
+/* It evaluates the trees of a GP/TGP search space, given either as trees (s->T) or as linear trees, and updates the fitness
+value of each tree and the global best agent. The trees are evaluated in parallel if s->n_threads > 1: every thread has its own
+output agent and working memory, and the results are reduced afterwards in the order of the trees, so the outcome does not
+depend on the number of threads. Linear trees share the outputs of common subtrees if s->cache_budget > 0, and the ones
+with an entry in s->tree_kernel are executed as native code.
+Parameters:
+s: search space
+opt_id: _GP_ or _TGP_
+L: linear trees (NULL to evaluate s->T)
+EvaluateFun: pointer to the function used to evaluate the trees
+arg: list of additional arguments */
+static void EvaluateForest(SearchSpace *s, int opt_id, LinearTree **L, prtFun Evaluate, va_list arg)
+{
+    int i, max_size = 1;
+    double *x = NULL, *f = NULL, *cv = NULL, **terminal = NULL;
+    prtTreeKernel *kernel = (L && (opt_id == _GP_)) ? s->tree_kernel : NULL;
+
+    if (s->is_binary_opt && (opt_id == _GP_))
+    {
+        EvaluateBinaryForest(s, L, Evaluate, arg);
+        return;
+    }
+
+    x = (double *)malloc(s->m * s->n * sizeof(double)); /* output agent of each tree */
+    f = (double *)malloc(s->m * sizeof(double));
+    cv = (double *)malloc(s->m * sizeof(double));
+
+    if (L)
+        for (i = 0; i < s->m; i++)
+            if (L[i]->size > max_size)
+                max_size = L[i]->size;
+
+    if (L && (s->cache_budget > 0))
+        PrepareTreeCaches(s, (opt_id == _TGP_) ? s->n * s->tensor_dim : s->n);
+
+    if (kernel)
+    { /* native code reads the terminals through plain arrays */
+        terminal = (double **)malloc(s->n_terminals * sizeof(double *));
+        for (i = 0; i < s->n_terminals; i++)
+            terminal[i] = s->a[i]->x;
+    }
+
+#pragma omp parallel num_threads(s->n_threads) if (s->n_threads > 1)
+    {
+        int k, j, w = (opt_id == _TGP_) ? s->n * s->tensor_dim : s->n;
+        double *stack = NULL, *out = NULL, *tmp = NULL, **t_out = NULL;
+        Agent *individual = NULL;
+        TreeCache *cache = NULL;
+        va_list argtmp;
+
+        PinWorker(s); /* before allocating, so the working memory of the worker is placed on its node */
+        individual = CreateAgent(s->n, opt_id, (opt_id == _TGP_) ? s->tensor_dim : _NOTENSOR_);
+
+        if (L && (s->cache_budget > 0))
+        { /* every thread has its own cache, so no locking is needed */
+#ifdef _OPENMP
+            cache = s->tree_cache[omp_get_thread_num()];
+#else
+            cache = s->tree_cache[0];
+#endif
+        }
+
+        if (L)
+        { /* working memory of this thread */
+            stack = (double *)malloc(max_size * w * sizeof(double));
+            if (opt_id == _TGP_)
+            {
+                out = (double *)malloc(w * sizeof(double));
+                t_out = (double **)malloc(s->n * sizeof(double *)); /* row pointers, so the output can be handled as a tensor */
+                for (j = 0; j < s->n; j++)
+                    t_out[j] = out + j * s->tensor_dim;
+            }
+        }
+
+        if (cache)
+        { /* every thread counts the subtrees of the trees it evaluates next, since both loops have the same static schedule */
+#pragma omp for schedule(static)
+            for (k = 0; k < s->m; k++)
+                if (!kernel || !kernel[k])
+                    CensusTreeCache(cache, L[k]);
+        }
+
+#pragma omp for schedule(static)
+        for (k = 0; k < s->m; k++)
+        {
+            /* It runs over a tree computing the output individual (current solution) */
+            if (opt_id == _GP_)
+            {
+                if (kernel && kernel[k])
+                    kernel[k](terminal, s->constant, individual->x, s->n);
+                else if (L)
+                    RunLinearTree(s, _GP_, L[k], individual->x, stack, cache);
+                else
+                {
+                    tmp = RunTree(s, s->T[k]);
+                    memcpy(individual->x, tmp, s->n * sizeof(double));
+                    free(tmp);
+                }
+            }
+            else
+            {
+                if (L)
+                    RunLinearTree(s, _TGP_, L[k], out, stack, cache);
+                else
+                    t_out = RunTTree(s, s->T[k]);
+                CheckTensorLimits(s, t_out, s->tensor_dim);
+
+                for (j = 0; j < s->n; j++)
+                    individual->x[j] = TensorSpan(s->LB[j], s->UB[j], t_out[j], s->tensor_dim);
+                if (!L)
+                    DestroyTensor(&t_out, s->n);
+            }
+
+            CheckAgentLimits(s, individual);
+
+            va_copy(argtmp, arg); /* every tree reads the additional arguments from its own copy */
+            f[k] = EvaluateFitness(s, individual, Evaluate, argtmp); /* It executes the fitness function for tree k */
+            va_end(argtmp);
+
+            cv[k] = individual->cv;
+            memcpy(x + k * s->n, individual->x, s->n * sizeof(double));
+        }
+
+        DestroyAgent(&individual, opt_id);
+        if (stack)
+            free(stack);
+        if (out)
+        {
+            free(out);
+            free(t_out);
+        }
+        UnpinWorker();
+    }
+
+    for (i = 0; i < s->m; i++)
+    {
+        if (f[i] < s->tree_fit[i]) /* It updates the fitness value */
+            s->tree_fit[i] = f[i];
+
+        if (IsBetterSolution(s->tree_fit[i], cv[i], s->gfit, s->gcv))
+        { /* It updates the global best value */
+            s->best = i;
+            s->gfit = s->tree_fit[i];
+            s->gcv = cv[i];
+            memcpy(s->g, x + i * s->n, s->n * sizeof(double));
+        }
+    }
+
+    free(x);
+    free(f);
+    free(cv);
+    if (terminal)
+        free(terminal);
+}
+
+/* It sets the fitness value of the agents of a search space screened out by the surrogate model to their prediction, but
+never better than the worst fitness value actually evaluated in the same pass, so an optimistic prediction does not
+outrank a real evaluation in the selections and acceptance tests of the following iterations.
+Parameters:
+s: search space
+selected: flags returned by ScreenSearchSpace (nothing is done if it is NULL)
+worst: worst fitness value evaluated in the same pass */
+static void FitScreenedAgents(SearchSpace *s, char *selected, double worst)
+{
+    int i;
+
+    if (!selected)
+        return;
+
+    for (i = 0; i < s->m; i++)
+        if (!selected[i])
+            s->a[i]->fit = (s->surrogate->pred[i] > worst) ? s->surrogate->pred[i] : worst;
+}
+
 /* It evaluates a search space
  * This function only evaluates each agent and sets its best fitness value,
  * as well as it sets the global best fitness value and agent.
@@ -843,8 +1437,8 @@ void EvaluateSearchSpace(SearchSpace *s, int opt_id, prtFun Evaluate, va_list ar
     }
 
     int i, j;
-    double f, **t_tmp = NULL, *tmp = NULL;
-    Agent *individual = NULL;
+    double f, cv, worst = -DBL_MAX; /* worst fitness value evaluated in this pass */
+    char *selected = NULL;
     va_list argtmp;
 
     va_copy(argtmp, arg);
@@ -860,39 +1454,58 @@ void EvaluateSearchSpace(SearchSpace *s, int opt_id, prtFun Evaluate, va_list ar
     case _ABC_:
     case _HS_:
     case _BSO_:
+        selected = ScreenSearchSpace(s); /* NULL if all agents must be evaluated */
         for (i = 0; i < s->m; i++)
         {
-            f = Evaluate(s->a[i], arg); /* It executes the fitness function for agent i */
+            if (selected && !selected[i]) /* agents screened out by the surrogate model are handled after the others (see FitScreenedAgents) */
+                continue;
 
-            if (f < s->a[i]->fit) /* It updates the fitness value */
+            cv = s->a[i]->cv;
+            f = EvaluateFitness(s, s->a[i], Evaluate, arg); /* It executes the fitness function for agent i */
+
+            if (IsBetterSolution(f, s->a[i]->cv, s->a[i]->fit, cv)) /* It updates the fitness value */
                 s->a[i]->fit = f;
+            else
+                s->a[i]->cv = cv;
+            if (s->a[i]->fit > worst)
+                worst = s->a[i]->fit;
 
-            if (s->a[i]->fit < s->gfit)
+            if (IsBetterSolution(s->a[i]->fit, s->a[i]->cv, s->gfit, s->gcv))
             { /* It updates the global best value and position */
                 s->best = i;
                 s->gfit = s->a[i]->fit;
+                s->gcv = s->a[i]->cv;
                 for (j = 0; j < s->n; j++)
                     s->g[j] = s->a[i]->x[j];
             }
 
             va_copy(arg, argtmp);
         }
+        FitScreenedAgents(s, selected, worst);
         break;
     case _PSO_:
+        selected = ScreenSearchSpace(s);
         for (i = 0; i < s->m; i++)
         {
-            f = Evaluate(s->a[i], arg); /* It executes the fitness function for agent i */
+            if (selected && !selected[i]) /* agents screened out by the surrogate model keep their local best */
+                continue;
 
-            if (f < s->a[i]->fit)
+            cv = s->a[i]->cv;
+            f = EvaluateFitness(s, s->a[i], Evaluate, arg); /* It executes the fitness function for agent i */
+
+            if (IsBetterSolution(f, s->a[i]->cv, s->a[i]->fit, cv))
             { /* It updates the local best value and position */
                 s->a[i]->fit = f;
                 for (j = 0; j < s->n; j++)
                     s->a[i]->xl[j] = s->a[i]->x[j];
             }
+            else
+                s->a[i]->cv = cv; /* the constraint violation refers to the local best */
 
-            if (s->a[i]->fit < s->gfit)
+            if (IsBetterSolution(s->a[i]->fit, s->a[i]->cv, s->gfit, s->gcv))
             { /* It updates the global best value and position */
                 s->gfit = s->a[i]->fit;
+                s->gcv = s->a[i]->cv;
                 for (j = 0; j < s->n; j++)
                     s->g[j] = s->a[i]->x[j];
             }
@@ -901,84 +1514,38 @@ void EvaluateSearchSpace(SearchSpace *s, int opt_id, prtFun Evaluate, va_list ar
         }
         break;
     case _FA_:
+        selected = ScreenSearchSpace(s);
         for (i = 0; i < s->m; i++)
         {
-            f = Evaluate(s->a[i], arg); /* It executes the fitness function for agent i */
+            if (selected && !selected[i]) /* the brightness of agents screened out by the surrogate model is set afterwards (see FitScreenedAgents) */
+                continue;
+
+            f = EvaluateFitness(s, s->a[i], Evaluate, arg); /* It executes the fitness function for agent i */
 
             s->a[i]->fit = f; /* It updates the fitness value of actual agent i */
+            if (f > worst)
+                worst = f;
 
-            if (s->a[i]->fit < s->gfit)
+            if (IsBetterSolution(s->a[i]->fit, s->a[i]->cv, s->gfit, s->gcv))
             { /* It updates the global best value and position */
                 s->gfit = s->a[i]->fit;
+                s->gcv = s->a[i]->cv;
                 for (j = 0; j < s->n; j++)
                     s->g[j] = s->a[i]->x[j];
             }
 
             va_copy(arg, argtmp);
         }
+        FitScreenedAgents(s, selected, worst);
         break;
     case _GP_:
-        individual = CreateAgent(s->n, _GP_, _NOTENSOR_);
-        for (i = 0; i < s->m; i++)
-        {
-            tmp = RunTree(s, s->T[i]);
-            memcpy(individual->x, tmp, s->n * sizeof(double)); /* It runs over a tree computing the output individual (current solution) */
-            free(tmp);
-
-            CheckAgentLimits(s, individual);
-
-            f = Evaluate(individual, arg); /* It executes the fitness function for agent i */
-
-            if (f < s->tree_fit[i]) /* It updates the fitness value */
-                s->tree_fit[i] = f;
-
-            if (s->tree_fit[i] < s->gfit)
-            { /* It updates the global best value */
-                s->best = i;
-                s->gfit = s->tree_fit[i];
-                for (j = 0; j < s->n; j++)
-                    s->g[j] = individual->x[j];
-            }
-
-            va_copy(arg, argtmp);
-        }
-        DestroyAgent(&individual, _GP_);
-        break;
     case _TGP_:
-        individual = CreateAgent(s->n, _TGP_, s->tensor_dim);
-        tmp = (double *)calloc(s->n, sizeof(double));
-        for (i = 0; i < s->m; i++){
-            t_tmp = RunTTree(s, s->T[i]);
-            CheckTensorLimits(s, t_tmp, s->tensor_dim);
-    
-            for(j = 0; j < s->n; j++)
-                tmp[j] = TensorSpan(s->LB[j], s->UB[j], t_tmp[j], s->tensor_dim);
-            memcpy(individual->x, tmp, s->n * sizeof(double)); /* It runs over a tree computing the output individual (current solution) */
-            DestroyTensor(&t_tmp, s->n);
-        
-            CheckAgentLimits(s, individual);
-
-            f = Evaluate(individual, arg); /* It executes the fitness function for agent i */
-            if (f < s->tree_fit[i]) /* It updates the fitness value */
-                s->tree_fit[i] = f;
-
-            /* It updates the global best value */
-            if (s->tree_fit[i] < s->gfit){ 
-                s->best = i;
-                s->gfit = s->tree_fit[i];
-                for (j = 0; j < s->n; j++)
-                    s->g[j] = individual->x[j];
-            }
-
-            va_copy(arg, argtmp);
-        }
-        DestroyAgent(&individual, _TGP_);
-        free(tmp);
+        EvaluateForest(s, opt_id, NULL, Evaluate, arg);
         break;
     case _MBO_:
         for (i = 0; i < s->m; i++)
         {
-            f = Evaluate(s->a[i], arg); /* It executes the fitness function for agent i */
+            f = EvaluateFitness(s, s->a[i], Evaluate, arg); /* It executes the fitness function for agent i */
             s->a[i]->fit = f;           /* It updates the fitness value of actual agent i */
 
             va_copy(arg, argtmp);
@@ -1139,6 +1706,16 @@ char CheckSearchSpace(SearchSpace *s, int opt_id)
             fprintf(stderr, "\n  -> Probability of mutation undefined.");
             OK = 0;
         }
+        if ((opt_id == _GA_) && (s->selection != _ROULETTE_) && (s->selection != _TOURNAMENT_))
+        {
+            fprintf(stderr, "\n  -> Unknown selection method.");
+            OK = 0;
+        }
+        if ((opt_id == _GA_) && (s->selection == _TOURNAMENT_) && (s->tournament_size < 1))
+        {
+            fprintf(stderr, "\n  -> Invalid tournament size.");
+            OK = 0;
+        }
         break;
     case _BHA_:
         break;
@@ -1224,8 +1801,13 @@ char CheckSearchSpace(SearchSpace *s, int opt_id)
             fprintf(stderr, "\n  -> Maximum Bandwidth undefined.");
             OK = 0;
         }
-        break;
-    case _BSO_:
+        if (s->batch_size < 1)
+        {
+            fprintf(stderr, "\n  -> Number of harmonies improvised per iteration must be greater than 0.");
+            OK = 0;
+        }
+        break;
+    case _BSO_:
         if (isnan((float)s->k) || (s->k < 1))
         {
             fprintf(stderr, "\n  -> Number of clusters undefined or invalid.");
@@ -1302,445 +1884,1204 @@ char CheckSearchSpace(SearchSpace *s, int opt_id)
 }
 /**************************/
 
-/* General-purpose functions */
-/* It generates a random number uniformly distributed between low and high
+/* Search Space Pool-related functions */
+/* It creates an empty pool of search spaces
 Parameters:
-low: lower bound
-high: upper bound
-This algorithm has been inspired by: http://www.cprogramming.com/tutorial/random.html */
-double GenerateUniformRandomNumber(double low, double high)
+capacity: maximum number of search spaces kept by the pool */
+SearchSpacePool *CreateSearchSpacePool(int capacity)
 {
-    return randinter(low, high);
+    SearchSpacePool *pool = NULL;
+
+    if (capacity < 1)
+    {
+        fprintf(stderr, "\nInvalid capacity @CreateSearchSpacePool.\n");
+        return NULL;
+    }
+
+    pool = (SearchSpacePool *)malloc(sizeof(SearchSpacePool));
+    pool->capacity = capacity;
+    pool->size = 0;
+    pool->s = (SearchSpace **)malloc(capacity * sizeof(SearchSpace *));
+    pool->opt_id = (int *)malloc(capacity * sizeof(int));
+
+    return pool;
 }
 
-/* It generates a random number drawn from a Gaussian (normal) distribution
+/* It deallocates a pool and the search spaces it keeps
 Parameters:
-mean: mean of the distribution
-variance: variance of the distribution */
-double GenerateGaussianRandomNumber(double mean, double variance)
+pool: address of the pool */
+void DestroySearchSpacePool(SearchSpacePool **pool)
 {
-    return randGaussian(mean, variance);
+    SearchSpacePool *tmp = NULL;
+    int i;
+
+    tmp = *pool;
+    if (!tmp)
+    {
+        fprintf(stderr, "\nPool not allocated @DestroySearchSpacePool.\n");
+        exit(-1);
+    }
+
+    for (i = 0; i < tmp->size; i++)
+        DestroySearchSpace(&(tmp->s[i]), tmp->opt_id[i]);
+    free(tmp->s);
+    free(tmp->opt_id);
+    free(tmp);
+    *pool = NULL;
 }
 
-/* It generates an n-dimensional array drawn from a Levy distribution
- * The formulation used here is based on the paper "Multiobjective Cuckoo Search for Design Optimization", X.-S. Yang and S. Deb, Computers & Operations Research, 2013.
+/* It takes a search space with m agents and n decision variables out of a pool. A search space with more allocated agents
+may be resized to m, except for GP, TGP and LOA. The search space keeps the parameters and boundaries of its last problem, so
+they must be updated before calling ResetSearchSpace. Search spaces that differ in other structural parameters (e.g., k for MBO
+or the trees' depth for GP) must be kept in different pools. It returns NULL if there is no such search space in the pool.
 Parameters:
-n: dimension of the output array
-beta: input parameter used in the formulation */
-double *GenerateLevyDistribution(int n, double beta)
+pool: pool of search spaces
+m: number of agents
+n: number of decision variables
+opt_id: identifier of the optimization technique */
+SearchSpace *AcquireSearchSpace(SearchSpacePool *pool, int m, int n, int opt_id)
 {
-    double *L = NULL, sigma_u, sigma_v = 1;
-    double *u = NULL, *v = NULL;
+    SearchSpace *s = NULL;
+    char resizable;
     int i;
 
-    if (n < 1)
+    if (!pool)
     {
-        fprintf(stderr, "Invalid input paramater @GenerateLevyDistribution.\n");
-        return NULL;
+        fprintf(stderr, "\nPool not allocated @AcquireSearchSpace.\n");
+        exit(-1);
     }
 
-    L = (double *)malloc(n * sizeof(double));
+    resizable = (opt_id != _GP_) && (opt_id != _TGP_) && (opt_id != _LOA_);
+    for (i = pool->size - 1; i >= 0; i--) /* the most recently released search spaces first */
+    {
+        s = pool->s[i];
+        if ((pool->opt_id[i] == opt_id) && (s->n == n) && ((s->m == m) || (resizable && (s->m_alloc >= m))))
+        {
+            pool->size--;
+            pool->s[i] = pool->s[pool->size];
+            pool->opt_id[i] = pool->opt_id[pool->size];
+            if (s->m != m)
+                ResizeSearchSpace(s, m, opt_id);
+            return s;
+        }
+    }
 
-    sigma_u = pow((tgamma(1 + beta) * sin(M_PI * beta / 2)) / (tgamma((1 + beta) / 2) * beta * pow(2, (beta - 1) / 2)), 1 / beta); /* Equation 16 */
+    return NULL;
+}
 
-    u = (double *)malloc(n * sizeof(double));
-    v = (double *)malloc(n * sizeof(double));
-    sigma_u = pow(sigma_u, 2);
-    for (i = 0; i < n; i++)
-    { /* It computes Equation 15 */
-        u[i] = GenerateGaussianRandomNumber(0, sigma_u);
-        v[i] = GenerateGaussianRandomNumber(0, sigma_v);
+/* It gives a search space back to a pool, or deallocates it if the pool is full
+Parameters:
+pool: pool of search spaces
+s: address of the search space (it is set to NULL)
+opt_id: identifier of the optimization technique */
+void ReleaseSearchSpace(SearchSpacePool *pool, SearchSpace **s, int opt_id)
+{
+    if ((!pool) || (!s) || (!*s))
+    {
+        fprintf(stderr, "\nPool and/or search space not allocated @ReleaseSearchSpace.\n");
+        exit(-1);
     }
 
-    for (i = 0; i < n; i++)
-        L[i] = 0.01 * (u[i] / pow(fabs(v[i]), 1 / beta)); /* It computes Equation 14 (part of it) */
+    if (pool->size == pool->capacity)
+        DestroySearchSpace(s, opt_id);
+    else
+    {
+        pool->s[pool->size] = *s;
+        pool->opt_id[pool->size] = opt_id;
+        pool->size++;
+    }
+    *s = NULL;
+}
+/**************************/
+
+/* Constraint-related functions */
+/* It sets the inequality constraints of a search space. Each constraint function g must return a value such that g(x) <= 0
+for feasible agents, and it receives the same additional arguments of the fitness function. The constraints are checked
+before the fitness function, which is not called for infeasible agents: they get a fitness value of DBL_MAX and are ranked
+by their constraint violation according to Deb's feasibility rules.
+Parameters:
+s: search space
+n_constraints: number of constraints (0 removes the constraints)
+constraint: array of constraint functions (it is copied) */
+void SetConstraints(SearchSpace *s, int n_constraints, prtConstraint *constraint)
+{
+    if ((!s) || (n_constraints < 0) || ((n_constraints > 0) && (!constraint)))
+    {
+        fprintf(stderr, "\nInvalid input parameters @SetConstraints.\n");
+        exit(-1);
+    }
 
-    free(u);
-    free(v);
+    if (s->constraint)
+        free(s->constraint);
+    s->constraint = NULL;
+    s->n_constraints = n_constraints;
 
-    return L;
+    if (n_constraints > 0)
+    {
+        s->constraint = (prtConstraint *)malloc(n_constraints * sizeof(prtConstraint));
+        memcpy(s->constraint, constraint, n_constraints * sizeof(prtConstraint));
+    }
 }
 
-/* It computes the Euclidean distance between two n-dimensional arrays
+/* It computes the constraint violation of an agent, i.e., the sum of its positive constraint values
 Parameters:
-x: n-dimension array
-y: n-dimension array */
-double EuclideanDistance(double *x, double *y, int n)
+s: search space
+a: agent
+arg: list of additional arguments */
+double ComputeConstraintViolation(SearchSpace *s, Agent *a, va_list arg)
 {
-    double sum = 0.0;
     int i;
+    double g, cv = 0;
+    va_list argtmp;
 
-    for (i = 0; i < n; i++)
-        sum += pow(x[i] - y[i], 2);
+    for (i = 0; i < s->n_constraints; i++)
+    {
+        va_copy(argtmp, arg);
+        g = s->constraint[i](a, argtmp);
+        va_end(argtmp);
+        if (g > 0)
+            cv += g;
+    }
 
-    return sqrt(sum);
+    return cv;
 }
 
-/* It generates a perpendicular vector to a given vector
+/* It compares two solutions according to Deb's feasibility rules and returns 1 if the first one is better. Since infeasible
+solutions have a fitness value of DBL_MAX, a feasible solution always beats an infeasible one, feasible solutions are compared by
+their fitness values and infeasible solutions by their constraint violations.
 Parameters:
-x: n-dimension array
-n: dimension of vector */
-double *GetPerpendicularVector(double *x, int n)
+fit1: fitness value of the first solution
+cv1: constraint violation of the first solution
+fit2: fitness value of the second solution
+cv2: constraint violation of the second solution */
+char IsBetterSolution(double fit1, double cv1, double fit2, double cv2)
 {
-    int i;
-    double *perp_vector = (double *)calloc(n, sizeof(double));
+    if (fit1 != fit2)
+        return fit1 < fit2;
 
-    for (i = 0; i < n - 1; i += 2)
+    return cv1 < cv2;
+}
+/**************************/
+
+/* Termination-related functions */
+/* It sets up the termination criteria of a search space. Any limit set to zero is disabled.
+Parameters:
+s: search space
+max_evaluations: maximum number of calls to the fitness function
+max_time: wall-clock deadline (in seconds)
+max_stagnation: maximum number of iterations with no improvement of the global best fitness
+tolerance: minimum improvement of the global best fitness to reset the stagnation counter */
+void SetTermination(SearchSpace *s, long int max_evaluations, double max_time, int max_stagnation, double tolerance)
+{
+    if (!s)
     {
-        perp_vector[i] = -1 * x[i + 1];
-        perp_vector[i + 1] = x[i];
+        fprintf(stderr, "\nSearch space not allocated @SetTermination.\n");
+        exit(-1);
     }
 
-    return perp_vector;
+    if ((max_evaluations < 0) || (max_time < 0) || (max_stagnation < 0) || (tolerance < 0))
+    {
+        fprintf(stderr, "\nInvalid termination criteria @SetTermination.\n");
+        exit(-1);
+    }
+
+    s->stop.max_evaluations = max_evaluations;
+    s->stop.max_time = max_time;
+    s->stop.max_stagnation = max_stagnation;
+    s->stop.tolerance = tolerance;
 }
 
-/* It normalizes a given vector
-Parameters:
-x: n-dimension array
-n: dimension of vector */
-void NormalizeVector(double *x, int n)
+/* It returns the current wall-clock time in seconds */
+double GetWallClockTime()
 {
-    int i;
-    double magnitude = 0;
+    struct timeval tv;
 
-    for (i = 0; i < n; i++)
-        magnitude += x[i] * x[i];
+    gettimeofday(&tv, NULL);
 
-    magnitude = sqrt(magnitude);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
 
-    for (i = 0; i < n; i++)
-        x[i] = x[i] / magnitude;
+/* It resets the counters of the termination criteria. It is called by every optimization technique before its initial evaluation.
+Parameters:
+s: search space */
+void ResetTermination(SearchSpace *s)
+{
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @ResetTermination.\n");
+        exit(-1);
+    }
+
+    s->stop.n_evaluations = 0;
+    s->stop.n_infeasible = 0;
+    s->stop.start_time = GetWallClockTime();
+    s->stop.stagnation = 0;
+    s->stop.last_gfit = DBL_MAX;
+    s->stop.reason = 0;
 }
 
-/* It is used to sort by agent's fitness (asceding order of fitness) */
-int SortAgent(const void *a, const void *b)
+/* It checks whether the run must stop before executing iteration t. It must be called once per iteration, since it also
+updates the stagnation counter based on s->gfit. Criteria are checked once per iteration, so the evaluation budget may be
+exceeded by the number of evaluations performed within a single iteration.
+Parameters:
+s: search space
+t: iteration to be executed */
+char StopOptimization(SearchSpace *s, int t)
 {
-    const Agent *x = *(Agent **)a, *y = *(Agent **)b;
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @StopOptimization.\n");
+        exit(-1);
+    }
 
-    if (x->fit != y->fit)
-        if (x->fit > y->fit)
-            return 1;
-        else
-            return -1;
+    if (s->stop.last_gfit - s->gfit > s->stop.tolerance)
+    { /* the global best has improved */
+        s->stop.last_gfit = s->gfit;
+        s->stop.stagnation = 0;
+    }
+    else if (t > 1)
+        s->stop.stagnation++;
+
+    if (t > s->iterations)
+        s->stop.reason = _STOP_ITERATIONS_;
+    else if ((s->stop.max_evaluations > 0) && (s->stop.n_evaluations >= s->stop.max_evaluations))
+        s->stop.reason = _STOP_EVALUATIONS_;
+    else if ((s->stop.max_time > 0) && (GetWallClockTime() - s->stop.start_time >= s->stop.max_time))
+        s->stop.reason = _STOP_TIME_;
+    else if ((s->stop.max_stagnation > 0) && (s->stop.stagnation >= s->stop.max_stagnation))
+        s->stop.reason = _STOP_STAGNATION_;
     else
         return 0;
+
+    if (s->stop.reason == _STOP_EVALUATIONS_)
+        fprintf(stderr, "\nStopping: evaluation budget reached (%ld evaluations).", s->stop.n_evaluations);
+    else if (s->stop.reason == _STOP_TIME_)
+        fprintf(stderr, "\nStopping: wall-clock deadline reached (%lf seconds).", s->stop.max_time);
+    else if (s->stop.reason == _STOP_STAGNATION_)
+        fprintf(stderr, "\nStopping: no improvement for %d iterations.", s->stop.stagnation);
+
+    return 1;
 }
 
-/* It is used to sort an array of Data by asceding order of the variable val */
-int SortDataByVal(const void *a, const void *b)
+/* It evaluates an agent through the fitness function and updates the evaluation counter of the search space.
+Every optimization technique calls the fitness function through it.
+Parameters:
+s: search space
+a: agent
+Evaluate: pointer to the function used to evaluate agents
+arg: list of additional arguments */
+double EvaluateFitness(SearchSpace *s, Agent *a, prtFun Evaluate, va_list arg)
 {
-    const Data *x = (Data *)a, *y = (Data *)b;
+    double f;
 
-    if (x->val != y->val)
-        if (x->val > y->val)
-            return 1;
+    if (s->n_constraints)
+    {
+        a->cv = ComputeConstraintViolation(s, a, arg);
+        if (a->cv > 0)
+        { /* infeasible agents are not evaluated by the fitness function */
+#pragma omp atomic
+            s->stop.n_infeasible++;
+            return DBL_MAX;
+        }
+    }
+
+#pragma omp atomic
+    s->stop.n_evaluations++;
+    f = Evaluate(a, arg);
+
+    if (s->surrogate && a->x) /* bit-packed agents are not seen by the surrogate model */
+    {
+#pragma omp critical(surrogate)
+        UpdateSurrogate(s->surrogate, a->x, f);
+    }
+
+    return f;
+}
+
+/* It evaluates a batch of agents and stores the fitness values at a[i]->fit. The agents are evaluated in parallel if s->n_threads > 1,
+so the fitness function must be thread-safe in that case.
+Parameters:
+s: search space
+a: array of agents
+m: number of agents
+Evaluate: pointer to the function used to evaluate agents
+arg: list of additional arguments */
+void EvaluateBatch(SearchSpace *s, Agent **a, int m, prtFun Evaluate, va_list arg)
+{
+    int i;
+
+    if ((!s) || (!a))
+    {
+        fprintf(stderr, "\nSearch space and/or agents not allocated @EvaluateBatch.\n");
+        exit(-1);
+    }
+
+#pragma omp parallel num_threads(s->n_threads) if (s->n_threads > 1)
+    {
+        va_list argtmp;
+
+        PinWorker(s);
+        if (s->numa)
+        { /* every agent is evaluated by the worker that owns its memory (see SetNUMASearchSpace) */
+#pragma omp for schedule(static)
+            for (i = 0; i < m; i++)
+            {
+                va_copy(argtmp, arg); /* every agent reads the additional arguments from its own copy */
+                a[i]->fit = EvaluateFitness(s, a[i], Evaluate, argtmp);
+                va_end(argtmp);
+            }
+        }
         else
-            return -1;
-    else
-        return 0;
+        {
+#pragma omp for schedule(dynamic)
+            for (i = 0; i < m; i++)
+            {
+                va_copy(argtmp, arg); /* every agent reads the additional arguments from its own copy */
+                a[i]->fit = EvaluateFitness(s, a[i], Evaluate, argtmp);
+                va_end(argtmp);
+            }
+        }
+        UnpinWorker();
+    }
 }
 
-/* It waives a comment in a model file
+/* It screens a batch of candidate agents with the surrogate model (if any) and evaluates the remaining ones at once through
+EvaluateBatch. The discarded candidates get DBL_MAX as their fitness value, i.e., they are handled as non-improving ones.
 Parameters:
-fp = file pointer */
-void WaiveComment(FILE *fp)
+s: search space
+a: array of 2*m agents, whose first m positions point to the candidates and the remaining ones are used as scratch
+m: number of candidates
+source: array with the agent of the search space each candidate competes with, or NULL if all of them compete with the
+last agent (e.g., the worst one of a sorted memory)
+Evaluate: pointer to the function used to evaluate agents
+arg: list of additional arguments */
+void EvaluateScreenedBatch(SearchSpace *s, Agent **a, int m, int *source, prtFun Evaluate, va_list arg)
 {
-    char c;
+    int i, n_evaluated = 0;
+    Agent **evaluated = a + m; /* candidates that will be actually evaluated */
 
-    fscanf(fp, "%c", &c);
-    while ((c != '\n') && (!feof(fp)))
-        fscanf(fp, "%c", &c);
+    if ((!s) || (!a))
+    {
+        fprintf(stderr, "\nSearch space and/or agents not allocated @EvaluateScreenedBatch.\n");
+        exit(-1);
+    }
+
+    for (i = 0; i < m; i++)
+    {
+        if (SkipCandidate(s, a[i], s->a[source ? source[i] : s->m - 1]->fit))
+            a[i]->fit = DBL_MAX;
+        else
+            evaluated[n_evaluated++] = a[i];
+    }
+    EvaluateBatch(s, evaluated, n_evaluated, Evaluate, arg);
 }
+/**************************/
 
-/* It loads a search space with parameters specified in a file
+/* Surrogate-related functions */
+/* It creates a surrogate model. Once attached to a search space (s->surrogate), it is deallocated by DestroySearchSpace.
 Parameters:
-fileName: path to the file that contains the parameters of the search space
-opt_id: identifier of the optimization technique */
-SearchSpace *ReadSearchSpaceFromFile(char *fileName, int opt_id){
-    FILE *fp = NULL;
-    SearchSpace *s = NULL;
-    int i, j, m, n, k, iterations, n_terminals = 0, n_functions = 0, min_depth, max_depth;
-    int has_constant = 0, is_integer_opt, same_range;
-    double pReproduction, pMutation, pCrossover, **constant = NULL, *LB = NULL, *UB = NULL;
-    double ***t_constant = NULL, sex_rate, nomad_percent, roaming_percent, mating_prob, imigration_rate;
-    int n_prides, tensor_dim = -1;
-    char line[LINE_SIZE], *pline = NULL, **function = NULL, **terminal = NULL;
-    Node *head = NULL, *tail = NULL, *aux = NULL;
+n: number of decision variables
+capacity: maximum number of points in the archive
+k: number of neighbours used for prediction
+ratio: fraction of the candidates that are actually evaluated (0,1] */
+Surrogate *CreateSurrogate(int n, int capacity, int k, double ratio)
+{
+    Surrogate *sg = NULL;
 
-    fp = fopen(fileName, "r");
-    if (!fp){
-        fprintf(stderr, "\nUnable to open file %s @ReadSearchSpaceFromFile.\n", fileName);
+    if ((n < 1) || (k < 1) || (capacity < k) || (ratio <= 0) || (ratio > 1))
+    {
+        fprintf(stderr, "\nInvalid parameters @CreateSurrogate.\n");
         return NULL;
     }
 
-    if(opt_id != _TGP_) fscanf(fp, "%d %d %d", &m, &n, &iterations);
-    else fscanf(fp, "%d %d %d %d", &m, &n, &iterations, &tensor_dim);
-    WaiveComment(fp);
-    
-    switch (opt_id){
-        case _PSO_:
-            s = CreateSearchSpace(m, n, _PSO_);
-            s->iterations = iterations;
-            fscanf(fp, "%lf %lf", &(s->c1), &(s->c2));
-            WaiveComment(fp);
-            fscanf(fp, "%lf %lf %lf", &(s->w), &(s->w_min), &(s->w_max));
-            WaiveComment(fp);
-            break;
-        case _BA_:
-            s = CreateSearchSpace(m, n, _BA_);
-            s->iterations = iterations;
-            fscanf(fp, "%lf %lf", &(s->f_min), &(s->f_max));
-            WaiveComment(fp);
-            fscanf(fp, "%lf %lf", &(s->A), &(s->r));
-            WaiveComment(fp);
-            break;
-        case _FPA_:
-            s = CreateSearchSpace(m, n, _FPA_);
-            s->iterations = iterations;
-            fscanf(fp, "%lf %lf", &(s->beta), &(s->p));
-            WaiveComment(fp);
-            break;
-        case _FA_:
-            s = CreateSearchSpace(m, n, _FA_);
-            s->iterations = iterations;
-            fscanf(fp, "%lf %lf %lf", &(s->alpha), &(s->beta_0), &(s->gamma));
-            WaiveComment(fp);
-            break;
-        case _CS_:
-            s = CreateSearchSpace(m, n, _CS_);
-            s->iterations = iterations;
-            fscanf(fp, "%lf %lf %lf", &(s->beta), &(s->p), &(s->alpha));
-            WaiveComment(fp);
-            break;
-        case _GA_:
-            s = CreateSearchSpace(m, n, _GA_);
-            s->iterations = iterations;
-            fscanf(fp, "%lf", &(s->pMutation));
-            WaiveComment(fp);
-            break;
-        case _BHA_:
-            s = CreateSearchSpace(m, n, _BHA_);
-            s->iterations = iterations;
-            break;
-        case _WCA_:
-            s = CreateSearchSpace(m, n, _WCA_);
-            s->iterations = iterations;
-            fscanf(fp, "%d %lf", &(s->nsr), &(s->dmax));
-            WaiveComment(fp);
-            break;
-        case _MBO_:
-            fscanf(fp, "%d", &k);
-            s = CreateSearchSpace(m, n, _MBO_, k);
-            s->iterations = iterations;
-            fscanf(fp, "%d %d", &(s->X), &(s->M));
-            WaiveComment(fp);
-            break;
-        case _ABC_:
-            s = CreateSearchSpace(m, n, _ABC_);
-            s->iterations = iterations;
-            fscanf(fp, "%d", &(s->limit));
-            WaiveComment(fp);
-            break;
-        case _HS_:
-            s = CreateSearchSpace(m, n, _HS_);
-            s->iterations = iterations;
-            fscanf(fp, "%lf", &(s->HMCR));
-            WaiveComment(fp);
-            fscanf(fp, "%lf %lf %lf", &(s->PAR), &(s->PAR_min), &(s->PAR_max));
-            WaiveComment(fp);
-            fscanf(fp, "%lf %lf %lf", &(s->bw), &(s->bw_min), &(s->bw_max));
-            WaiveComment(fp);
-            break;
-        case _BSO_:
-            s = CreateSearchSpace(m, n, _BSO_);
-            s->iterations = iterations;
-            fscanf(fp, "%d", &(s->k));
-            WaiveComment(fp);
-            fscanf(fp, "%lf %lf %lf", &(s->p_one_cluster), &(s->p_one_center), &(s->p_two_centers));
-            WaiveComment(fp);
-            break;
-        case _GP_:
-        case _TGP_:
-            fscanf(fp, "%lf %lf %lf", &pReproduction, &pMutation, &pCrossover);
-            WaiveComment(fp);
-            fscanf(fp, "%d %d", &min_depth, &max_depth);
-            WaiveComment(fp);
+    sg = (Surrogate *)malloc(sizeof(Surrogate));
+    sg->n = n;
+    sg->capacity = capacity;
+    sg->size = 0;
+    sg->next = 0;
+    sg->k = k;
+    sg->ratio = ratio;
+    sg->X = (double *)malloc(capacity * n * sizeof(double));
+    sg->f = (double *)malloc(capacity * sizeof(double));
+    sg->nn = (Data *)malloc(k * sizeof(Data));
+    sg->rank = NULL;
+    sg->pred = NULL;
+    sg->selected = NULL;
+    sg->rank_size = 0;
+    sg->n_skipped = 0;
+
+    return sg;
+}
 
-            /* Loading function nodes */
-            fgets(line, LINE_SIZE, fp);
-            pline = strtok(line, " \t");
-            j = 0;
-            while ((pline) && (*pline != '#')){
-                aux = CreateNode(pline, 0, 0);
+/* It deallocates a surrogate model
+Parameters:
+sg: surrogate model */
+void DestroySurrogate(Surrogate **sg)
+{
+    Surrogate *tmp = *sg;
 
-                if (!head) head = aux;
-                else tail->right = aux;
-                tail = aux;
+    if (!tmp)
+    {
+        fprintf(stderr, "\nSurrogate model not allocated @DestroySurrogate.\n");
+        return;
+    }
 
-                n_functions++;
-                pline = strtok(NULL, " \t");
-            }
+    free(tmp->X);
+    free(tmp->f);
+    free(tmp->nn);
+    if (tmp->rank) free(tmp->rank);
+    if (tmp->pred) free(tmp->pred);
+    if (tmp->selected) free(tmp->selected);
+    free(tmp);
+    *sg = NULL;
+}
 
-            function = (char **)malloc(n_functions * sizeof(char *));
-            for (j = 0; j < n_functions; j++)
-                function[j] = (char *)malloc(TERMINAL_LENGTH * sizeof(char));
+/* It adds an evaluated point to the archive of a surrogate model. Once the archive is full, the oldest point is replaced,
+so the training cost is O(n) per evaluation.
+Parameters:
+sg: surrogate model
+x: position
+fit: fitness value */
+void UpdateSurrogate(Surrogate *sg, double *x, double fit)
+{
+    if (!sg || !x)
+    {
+        fprintf(stderr, "\nInvalid input parameters @UpdateSurrogate.\n");
+        return;
+    }
 
-            j = 0;
-            aux = head;
-            while (aux){
-                strcpy(function[j++], aux->elem);
-                aux = aux->right;
-            }   
-            DestroyTree(&head);
-            /*****************************/
+    if (isnan(fit) || isinf(fit) || (fit == DBL_MAX)) /* invalid fitness values would spoil the predictions */
+        return;
 
-            /* Loading terminal nodes */
-            fgets(line, LINE_SIZE, fp);
-            pline = strtok(line, " \t");
-            j = 0;
-            while ((pline) && (*pline != '#')){
-                aux = CreateNode(pline, 0, 0);
-                if (!strcmp(pline, "CONST")) has_constant = 1;
+    memcpy(sg->X + (size_t)sg->next * sg->n, x, sg->n * sizeof(double));
+    sg->f[sg->next] = fit;
+    sg->next = (sg->next + 1) % sg->capacity;
+    if (sg->size < sg->capacity)
+        sg->size++;
+}
 
-                if (!head) head = aux;
-                else
-                    tail->right = aux;
-                tail = aux;
+/* It checks whether a surrogate model has enough points to be used, i.e., more than k
+Parameters:
+sg: surrogate model */
+char SurrogateIsReady(Surrogate *sg)
+{
+    return sg && (sg->size > sg->k);
+}
 
-                n_terminals++;
-                pline = strtok(NULL, " \t");
-            }
+/* It predicts the fitness value of a position by the inverse distance-weighted average of its k nearest neighbours in the archive.
+The neighbours are kept in a small sorted buffer given by the caller, so the prediction costs O(size * n) with no allocation,
+and several threads may predict at once with buffers of their own as long as the archive is not being updated.
+Parameters:
+sg: surrogate model
+x: position
+nn: scratch buffer with room for sg->k neighbours (sg->nn may be used by the calls that are never made concurrently) */
+double PredictSurrogate(Surrogate *sg, double *x, Data *nn)
+{
+    int i, j, found = 0;
+    double d, diff, *p, w, sum_w = 0, sum_f = 0;
 
-            terminal = (char **)malloc(n_terminals * sizeof(char *));
-            for (j = 0; j < n_terminals; j++)
-                terminal[j] = (char *)malloc(TERMINAL_LENGTH * sizeof(char));
+    if (!SurrogateIsReady(sg) || !x || !nn)
+    {
+        fprintf(stderr, "\nSurrogate model not ready @PredictSurrogate.\n");
+        return DBL_MAX;
+    }
 
-            j = 0;
-            aux = head;
-            while (aux){
-                strcpy(terminal[j++], aux->elem);
-                aux = aux->right;
-            }
-            DestroyTree(&head);
-            /*****************************/
+    for (i = 0; i < sg->size; i++)
+    {
+        p = sg->X + (size_t)i * sg->n;
+        d = 0;
+        for (j = 0; j < sg->n; j++)
+        {
+            diff = x[j] - p[j];
+            d += diff * diff;
+        }
 
-            fscanf(fp, "%d %d", &is_integer_opt, &same_range);
-            WaiveComment(fp);
+        if (d == 0)
+            return sg->f[i]; /* the position has already been evaluated */
 
-            /* loading lower and upper bounds */
-            LB = (double *)malloc(n * sizeof(double));
-            UB = (double *)malloc(n * sizeof(double));
+        if ((found == sg->k) && (d >= nn[found - 1].val))
+            continue;
 
-            if (same_range){
-                for (j = 0; j < n; j++){
-                    fscanf(fp, "%lf %lf", &(LB[j]), &(UB[j]));
-                    WaiveComment(fp);
-                }   
-            }
-            else{
-                fscanf(fp, "%lf %lf", &(LB[0]), &(UB[0]));
-                WaiveComment(fp);
-                for (j = 1; j < n; j++){
-                    LB[j] = LB[0];
-                    UB[j] = UB[0];
-                }   
-            }
-            /* loading constants */
-            if (has_constant){
-                if(opt_id == _GP_){
-                    constant = (double **)malloc(n * sizeof(double *));
-                    for (j = 0; j < n; j++)
-                        constant[j] = (double *)malloc(N_CONSTANTS * sizeof(double));
+        /* inserting point i into the sorted buffer of nearest neighbours */
+        j = (found < sg->k) ? found++ : found - 1;
+        while ((j > 0) && (nn[j - 1].val > d))
+        {
+            nn[j] = nn[j - 1];
+            j--;
+        }
+        nn[j].val = d;
+        nn[j].id = i;
+    }
 
-                    for (i = 0; i < n; i++)
-                        for (j = 0; j < N_CONSTANTS; j++)
-                            constant[i][j] = GenerateUniformRandomNumber(LB[i], UB[i]);
-                            
-                }else{ /* tensor-based GP */
-                    /* here we generate N_CONSTANTS random matrices within the range [0,1] */
-                    t_constant = (double ***)malloc(N_CONSTANTS * sizeof(double **));
-                    for(i = 0; i < N_CONSTANTS; i++){
-                        t_constant[i] = (double **)malloc(n * sizeof(double *));
-                        for (j = 0; j < n; j++)
-                            t_constant[i][j] = (double *)malloc(tensor_dim * sizeof(double));
-                    }
-                    
-                    for (i = 0; i < N_CONSTANTS; i++)
-                        for (j = 0; j < n; j++)
-                            for (k = 0; k < tensor_dim; k++)
-                                t_constant[i][j][k] = GenerateUniformRandomNumber(0, 1);
-                            
-                }
-            }
-            /*********************/
-            fprintf(stderr,"\nFLAG 1");
-            if(opt_id == _GP_) s = CreateSearchSpace(m, n, _GP_, min_depth, max_depth, n_terminals, N_CONSTANTS, n_functions, terminal, constant, function);
-            else s = CreateSearchSpace(m, n, _TGP_, min_depth, max_depth, n_terminals, N_CONSTANTS, n_functions, terminal, t_constant, function, tensor_dim);
-            fprintf(stderr,"\nFLAG 2");
-            
-            s->iterations = iterations;
-            s->pReproduction = pReproduction;
-            s->pMutation = pMutation;
-            s->pCrossover = pCrossover;
-            s->is_integer_opt = is_integer_opt;
-            s->tensor_dim = tensor_dim;
+    for (i = 0; i < found; i++)
+    {
+        w = 1 / nn[i].val;
+        sum_w += w;
+        sum_f += w * sg->f[nn[i].id];
+    }
 
-            for (j = 0; j < s->n; j++){
-                s->LB[j] = LB[j];
-                s->UB[j] = UB[j];
-            }
-            free(LB);
-            free(UB);
-            break;
-        case _LOA_:
-            fscanf(fp, "%lf %lf %lf %lf %lf %lf %d", &sex_rate, &nomad_percent, &roaming_percent, &mating_prob, &pMutation, &imigration_rate, &n_prides);
-            s = CreateSearchSpace(m, n, _LOA_, sex_rate, nomad_percent, roaming_percent, mating_prob, pMutation, imigration_rate, n_prides);
-            s->iterations = iterations;
-            WaiveComment(fp);
-            break;
-        default:
-            fprintf(stderr, "\nInvalid optimization identifier @ReadSearchSpaceFromFile.\n");
-            break;
+    return sum_f / sum_w;
+}
+
+/* It selects the most promising agents of a search space to be evaluated, i.e., the fraction s->surrogate->ratio with the
+lowest predicted fitness values. It returns NULL if all agents must be evaluated (no surrogate model or not enough points),
+or an array of flags owned by the surrogate model, where 1 means the agent must be evaluated.
+Parameters:
+s: search space */
+char *ScreenSearchSpace(SearchSpace *s)
+{
+    Surrogate *sg = NULL;
+    int i, n_selected;
+
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @ScreenSearchSpace.\n");
+        exit(-1);
     }
 
-    if ((opt_id != _GP_) && (opt_id != _TGP_)){
-        for (j = 0; j < s->n; j++){
-            fscanf(fp, "%lf %lf", &(s->LB[j]), &(s->UB[j]));
-            WaiveComment(fp);
-        }
+    sg = s->surrogate;
+    if (!SurrogateIsReady(sg))
+        return NULL;
+
+    if (sg->rank_size < s->m)
+    {
+        sg->rank = (Data *)realloc(sg->rank, s->m * sizeof(Data));
+        sg->pred = (double *)realloc(sg->pred, s->m * sizeof(double));
+        sg->selected = (char *)realloc(sg->selected, s->m * sizeof(char));
+        sg->rank_size = s->m;
     }
 
-    fclose(fp);
+    for (i = 0; i < s->m; i++)
+    {
+        sg->pred[i] = PredictSurrogate(sg, s->a[i]->x, sg->nn);
+        sg->rank[i].id = i;
+        sg->rank[i].val = sg->pred[i];
+        sg->selected[i] = 0;
+    }
+    qsort(sg->rank, s->m, sizeof(Data), SortDataByVal);
 
-    return s;
+    n_selected = (int)ceil(sg->ratio * s->m);
+    for (i = 0; i < n_selected; i++)
+        sg->selected[sg->rank[i].id] = 1;
+    sg->n_skipped += s->m - n_selected;
+
+    return sg->selected;
 }
 
-/* It returns the identifier of the function used as input
+/* It evaluates a candidate agent that competes with a solution whose fitness value is reference. If a surrogate model is
+available and predicts the candidate is not better than reference, the candidate is evaluated with probability
+s->surrogate->ratio only; otherwise, DBL_MAX is returned, i.e., the candidate is handled as a non-improving one.
 Parameters:
-s: string with the function node description */
-int getFUNCTIONid(char *s)
+s: search space
+a: candidate agent
+reference: fitness value the candidate competes with
+Evaluate: pointer to the function used to evaluate agents
+arg: list of additional arguments */
+double EvaluateCandidate(SearchSpace *s, Agent *a, double reference, prtFun Evaluate, va_list arg)
 {
-    if (!strcmp(s, "SUM"))
-        return _SUM_;
-    else if (!strcmp(s, "SUB"))
-        return _SUB_;
-    else if (!strcmp(s, "MUL"))
-        return _MUL_;
-    else if (!strcmp(s, "DIV"))
-        return _DIV_;
-    else if (!strcmp(s, "EXP"))
-        return _EXP_;
-    else if (!strcmp(s, "SQRT"))
-        return _SQRT_;
-    else if (!strcmp(s, "LOG"))
-        return _LOG_;
-    else if (!strcmp(s, "ABS"))
-        return _ABS_;
-    else if (!strcmp(s, "AND"))
-        return _AND_;
-    else if (!strcmp(s, "OR"))
-        return _OR_;
-    else if (!strcmp(s, "XOR"))
+    if (SkipCandidate(s, a, reference))
+        return DBL_MAX;
+
+    return EvaluateFitness(s, a, Evaluate, arg);
+}
+
+/* It decides whether the surrogate model discards a candidate agent that competes with a solution whose fitness value is reference.
+It is used to screen a whole batch of candidates before evaluating the remaining ones at once.
+Parameters:
+s: search space
+a: candidate agent
+reference: fitness value the candidate competes with */
+char SkipCandidate(SearchSpace *s, Agent *a, double reference)
+{
+    double pred = -DBL_MAX;
+
+    /* the prediction must not overlap with the archive updates performed by EvaluateFitness */
+#pragma omp critical(surrogate)
+    {
+        if (SurrogateIsReady(s->surrogate))
+            pred = PredictSurrogate(s->surrogate, a->x, s->surrogate->nn); /* the predictions are serialized here */
+    }
+
+    if ((pred >= reference) && (GenerateUniformRandomNumber(0, 1) >= s->surrogate->ratio))
+    {
+#pragma omp atomic
+        s->surrogate->n_skipped++;
+        return 1;
+    }
+
+    return 0;
+}
+/**************************/
+
+/* General-purpose functions */
+/* It generates a random number uniformly distributed between low and high
+Parameters:
+low: lower bound
+high: upper bound
+This algorithm has been inspired by: http://www.cprogramming.com/tutorial/random.html */
+double GenerateUniformRandomNumber(double low, double high)
+{
+    return randinter(low, high);
+}
+
+/* It generates a random number drawn from a Gaussian (normal) distribution
+Parameters:
+mean: mean of the distribution
+variance: variance of the distribution */
+double GenerateGaussianRandomNumber(double mean, double variance)
+{
+    return randGaussian(mean, variance);
+}
+
+/* It fills an array with numbers drawn from a uniform distribution whithin [low,high]
+Parameters:
+out: output array
+n: number of samples
+low: lower bound
+high: upper bound */
+void GenerateUniformRandomArray(double *out, int n, double low, double high)
+{
+    if (!out || n < 1)
+    {
+        fprintf(stderr, "Invalid input paramater @GenerateUniformRandomArray.\n");
+        return;
+    }
+
+    randinterArray(out, n, low, high);
+}
+
+/* It fills an array with numbers drawn from a Gaussian (normal) distribution
+Parameters:
+out: output array
+n: number of samples
+mean: mean of the distribution
+variance: variance of the distribution */
+void GenerateGaussianRandomArray(double *out, int n, double mean, double variance)
+{
+    if (!out || n < 1)
+    {
+        fprintf(stderr, "Invalid input paramater @GenerateGaussianRandomArray.\n");
+        return;
+    }
+
+    randGaussianArray(out, n, mean, variance);
+}
+
+/* It computes the scale sigma_u used by the Mantegna's algorithm to draw Levy steps (Equation 16).
+ * It depends on beta only, so the last computed value is cached per thread (OpenMP workers may call it concurrently).
+Parameters:
+beta: input parameter used in the formulation */
+double LevySigma(double beta)
+{
+    static RAND_THREAD_LOCAL double cached_beta = NAN, cached_sigma = NAN;
+
+    if (beta != cached_beta)
+    {
+        cached_sigma = pow((tgamma(1 + beta) * sin(M_PI * beta / 2)) / (tgamma((1 + beta) / 2) * beta * pow(2, (beta - 1) / 2)), 1 / beta); /* Equation 16 */
+        cached_beta = beta;
+    }
+
+    return cached_sigma;
+}
+
+/* It fills a caller-provided array with numbers drawn from a Levy distribution (Mantegna's algorithm)
+ * The formulation used here is based on the paper "Multiobjective Cuckoo Search for Design Optimization", X.-S. Yang and S. Deb, Computers & Operations Research, 2013.
+Parameters:
+L: output array
+n: dimension of the output array
+beta: input parameter used in the formulation */
+void GenerateLevyDistributionArray(double *L, int n, double beta)
+{
+    double v[LEVY_BLOCK_SIZE], sigma_u, inv_beta;
+    int i, j, size;
+
+    if (!L || n < 1)
+    {
+        fprintf(stderr, "Invalid input paramater @GenerateLevyDistributionArray.\n");
+        return;
+    }
+
+    sigma_u = LevySigma(beta);
+    inv_beta = 1 / beta;
+
+    for (i = 0; i < n; i += LEVY_BLOCK_SIZE)
+    {
+        size = (n - i < LEVY_BLOCK_SIZE) ? n - i : LEVY_BLOCK_SIZE;
+
+        /* It computes Equation 15: u ~ N(0, sigma_u^2) is drawn straight into L, and v ~ N(0, 1) */
+        GenerateGaussianRandomArray(L + i, size, 0, sigma_u);
+        GenerateGaussianRandomArray(v, size, 0, 1);
+
+        for (j = 0; j < size; j++)
+            L[i + j] = 0.01 * (L[i + j] / pow(fabs(v[j]), inv_beta)); /* It computes Equation 14 (part of it) */
+    }
+}
+
+/* It generates an n-dimensional array drawn from a Levy distribution
+ * The formulation used here is based on the paper "Multiobjective Cuckoo Search for Design Optimization", X.-S. Yang and S. Deb, Computers & Operations Research, 2013.
+Parameters:
+n: dimension of the output array
+beta: input parameter used in the formulation */
+double *GenerateLevyDistribution(int n, double beta)
+{
+    double *L = NULL;
+
+    if (n < 1)
+    {
+        fprintf(stderr, "Invalid input paramater @GenerateLevyDistribution.\n");
+        return NULL;
+    }
+
+    L = (double *)malloc(n * sizeof(double));
+    GenerateLevyDistributionArray(L, n, beta);
+
+    return L;
+}
+
+/* It computes the Euclidean distance between two n-dimensional arrays
+Parameters:
+x: n-dimension array
+y: n-dimension array */
+double EuclideanDistance(double *x, double *y, int n)
+{
+    double sum = 0.0;
+    int i;
+
+    for (i = 0; i < n; i++)
+        sum += pow(x[i] - y[i], 2);
+
+    return sqrt(sum);
+}
+
+/* It generates a perpendicular vector to a given vector
+Parameters:
+x: n-dimension array
+n: dimension of vector */
+double *GetPerpendicularVector(double *x, int n)
+{
+    double *perp_vector = (double *)malloc(n * sizeof(double));
+
+    FillPerpendicularVector(x, n, perp_vector);
+
+    return perp_vector;
+}
+
+/* It fills a buffer with a perpendicular vector to a given vector
+Parameters:
+x: n-dimension array
+n: dimension of vector
+perp_vector: n-dimension output array */
+void FillPerpendicularVector(double *x, int n, double *perp_vector)
+{
+    int i;
+
+    for (i = 0; i < n - 1; i += 2)
+    {
+        perp_vector[i] = -1 * x[i + 1];
+        perp_vector[i + 1] = x[i];
+    }
+    if (n % 2)
+        perp_vector[n - 1] = 0;
+}
+
+/* It normalizes a given vector
+Parameters:
+x: n-dimension array
+n: dimension of vector */
+void NormalizeVector(double *x, int n)
+{
+    int i;
+    double magnitude = 0;
+
+    for (i = 0; i < n; i++)
+        magnitude += x[i] * x[i];
+
+    magnitude = sqrt(magnitude);
+
+    for (i = 0; i < n; i++)
+        x[i] = x[i] / magnitude;
+}
+
+/* It is used to sort by agent's fitness (asceding order of fitness) */
+int SortAgent(const void *a, const void *b)
+{
+    const Agent *x = *(Agent **)a, *y = *(Agent **)b;
+
+    if (x->fit != y->fit)
+        if (x->fit > y->fit)
+            return 1;
+        else
+            return -1;
+    else if (x->cv != y->cv) /* infeasible agents share the same fitness value, so they are ranked by their constraint violation */
+        if (x->cv > y->cv)
+            return 1;
+        else
+            return -1;
+    else
+        return 0;
+}
+
+/* It moves the k best agents (smallest fitness) to the first k positions of an array, in no particular order.
+It runs in linear expected time, and it should be followed by qsort over the first k positions if their order matters.
+Parameters:
+a: array of agents
+n: number of agents
+k: number of agents to be selected */
+void SelectAgents(Agent **a, int n, int k)
+{
+    int left = 0, right = n - 1, i, j;
+    double pivot;
+    Agent *aux = NULL;
+
+    if ((k <= 0) || (k >= n))
+        return;
+
+    /* Hoare's selection: it keeps partitioning the side that contains position k - 1 */
+    while (left < right)
+    {
+        pivot = a[left + (right - left) / 2]->fit;
+        i = left;
+        j = right;
+        while (i <= j)
+        {
+            while (a[i]->fit < pivot)
+                i++;
+            while (a[j]->fit > pivot)
+                j--;
+            if (i <= j)
+            {
+                aux = a[i];
+                a[i] = a[j];
+                a[j] = aux;
+                i++;
+                j--;
+            }
+        }
+        if (k - 1 <= j)
+            right = j;
+        else if (k - 1 >= i)
+            left = i;
+        else
+            break;
+    }
+}
+
+/* It is used to sort an array of Data by asceding order of the variable val */
+int SortDataByVal(const void *a, const void *b)
+{
+    const Data *x = (Data *)a, *y = (Data *)b;
+
+    if (x->val != y->val)
+        if (x->val > y->val)
+            return 1;
+        else
+            return -1;
+    else
+        return 0;
+}
+
+/* It waives a comment in a model file
+Parameters:
+fp = file pointer */
+void WaiveComment(FILE *fp)
+{
+    char c;
+
+    fscanf(fp, "%c", &c);
+    while ((c != '\n') && (!feof(fp)))
+        fscanf(fp, "%c", &c);
+}
+
+/* It loads a search space with parameters specified in a file
+Parameters:
+fileName: path to the file that contains the parameters of the search space
+opt_id: identifier of the optimization technique */
+SearchSpace *ReadSearchSpaceFromFile(char *fileName, int opt_id){
+    FILE *fp = NULL;
+    SearchSpace *s = NULL;
+    int i, j, m, n, k, iterations, n_terminals = 0, n_functions = 0, min_depth, max_depth;
+    int has_constant = 0, is_integer_opt, same_range;
+    double pReproduction, pMutation, pCrossover, **constant = NULL, *LB = NULL, *UB = NULL;
+    double ***t_constant = NULL, sex_rate, nomad_percent, roaming_percent, mating_prob, imigration_rate;
+    int n_prides, tensor_dim = -1;
+    char line[LINE_SIZE], *pline = NULL, **function = NULL, **terminal = NULL;
+    Node *head = NULL, *tail = NULL, *aux = NULL;
+
+    fp = fopen(fileName, "r");
+    if (!fp){
+        fprintf(stderr, "\nUnable to open file %s @ReadSearchSpaceFromFile.\n", fileName);
+        return NULL;
+    }
+
+    if(opt_id != _TGP_) fscanf(fp, "%d %d %d", &m, &n, &iterations);
+    else fscanf(fp, "%d %d %d %d", &m, &n, &iterations, &tensor_dim);
+    WaiveComment(fp);
+    
+    switch (opt_id){
+        case _PSO_:
+            s = CreateSearchSpace(m, n, _PSO_);
+            s->iterations = iterations;
+            fscanf(fp, "%lf %lf", &(s->c1), &(s->c2));
+            WaiveComment(fp);
+            fscanf(fp, "%lf %lf %lf", &(s->w), &(s->w_min), &(s->w_max));
+            WaiveComment(fp);
+            break;
+        case _BA_:
+            s = CreateSearchSpace(m, n, _BA_);
+            s->iterations = iterations;
+            fscanf(fp, "%lf %lf", &(s->f_min), &(s->f_max));
+            WaiveComment(fp);
+            fscanf(fp, "%lf %lf", &(s->A), &(s->r));
+            WaiveComment(fp);
+            break;
+        case _FPA_:
+            s = CreateSearchSpace(m, n, _FPA_);
+            s->iterations = iterations;
+            fscanf(fp, "%lf %lf", &(s->beta), &(s->p));
+            WaiveComment(fp);
+            break;
+        case _FA_:
+            s = CreateSearchSpace(m, n, _FA_);
+            s->iterations = iterations;
+            fscanf(fp, "%lf %lf %lf", &(s->alpha), &(s->beta_0), &(s->gamma));
+            WaiveComment(fp);
+            break;
+        case _CS_:
+            s = CreateSearchSpace(m, n, _CS_);
+            s->iterations = iterations;
+            fscanf(fp, "%lf %lf %lf", &(s->beta), &(s->p), &(s->alpha));
+            WaiveComment(fp);
+            break;
+        case _GA_:
+            s = CreateSearchSpace(m, n, _GA_);
+            s->iterations = iterations;
+            fscanf(fp, "%lf", &(s->pMutation));
+            WaiveComment(fp);
+            break;
+        case _BHA_:
+            s = CreateSearchSpace(m, n, _BHA_);
+            s->iterations = iterations;
+            break;
+        case _WCA_:
+            s = CreateSearchSpace(m, n, _WCA_);
+            s->iterations = iterations;
+            fscanf(fp, "%d %lf", &(s->nsr), &(s->dmax));
+            WaiveComment(fp);
+            break;
+        case _MBO_:
+            fscanf(fp, "%d", &k);
+            s = CreateSearchSpace(m, n, _MBO_, k);
+            s->iterations = iterations;
+            fscanf(fp, "%d %d", &(s->X), &(s->M));
+            WaiveComment(fp);
+            break;
+        case _ABC_:
+            s = CreateSearchSpace(m, n, _ABC_);
+            s->iterations = iterations;
+            fscanf(fp, "%d", &(s->limit));
+            WaiveComment(fp);
+            break;
+        case _HS_:
+            s = CreateSearchSpace(m, n, _HS_);
+            s->iterations = iterations;
+            fgets(line, LINE_SIZE, fp); /* the number of harmonies per iteration is optional, so the whole line is parsed */
+            if (sscanf(line, "%lf %d", &(s->HMCR), &(s->batch_size)) < 2)
+                s->batch_size = 1;
+            fscanf(fp, "%lf %lf %lf", &(s->PAR), &(s->PAR_min), &(s->PAR_max));
+            WaiveComment(fp);
+            fscanf(fp, "%lf %lf %lf", &(s->bw), &(s->bw_min), &(s->bw_max));
+            WaiveComment(fp);
+            break;
+        case _BSO_:
+            s = CreateSearchSpace(m, n, _BSO_);
+            s->iterations = iterations;
+            fscanf(fp, "%d", &(s->k));
+            WaiveComment(fp);
+            fscanf(fp, "%lf %lf %lf", &(s->p_one_cluster), &(s->p_one_center), &(s->p_two_centers));
+            WaiveComment(fp);
+            break;
+        case _GP_:
+        case _TGP_:
+            fscanf(fp, "%lf %lf %lf", &pReproduction, &pMutation, &pCrossover);
+            WaiveComment(fp);
+            fscanf(fp, "%d %d", &min_depth, &max_depth);
+            WaiveComment(fp);
+
+            /* Loading function nodes */
+            fgets(line, LINE_SIZE, fp);
+            pline = strtok(line, " \t");
+            j = 0;
+            while ((pline) && (*pline != '#')){
+                aux = CreateNode(pline, 0, 0);
+
+                if (!head) head = aux;
+                else tail->right = aux;
+                tail = aux;
+
+                n_functions++;
+                pline = strtok(NULL, " \t");
+            }
+
+            function = (char **)malloc(n_functions * sizeof(char *));
+            for (j = 0; j < n_functions; j++)
+                function[j] = (char *)malloc(TERMINAL_LENGTH * sizeof(char));
+
+            j = 0;
+            aux = head;
+            while (aux){
+                strcpy(function[j++], aux->elem);
+                aux = aux->right;
+            }   
+            DestroyTree(&head);
+            /*****************************/
+
+            /* Loading terminal nodes */
+            fgets(line, LINE_SIZE, fp);
+            pline = strtok(line, " \t");
+            j = 0;
+            while ((pline) && (*pline != '#')){
+                aux = CreateNode(pline, 0, 0);
+                if (!strcmp(pline, "CONST")) has_constant = 1;
+
+                if (!head) head = aux;
+                else
+                    tail->right = aux;
+                tail = aux;
+
+                n_terminals++;
+                pline = strtok(NULL, " \t");
+            }
+
+            terminal = (char **)malloc(n_terminals * sizeof(char *));
+            for (j = 0; j < n_terminals; j++)
+                terminal[j] = (char *)malloc(TERMINAL_LENGTH * sizeof(char));
+
+            j = 0;
+            aux = head;
+            while (aux){
+                strcpy(terminal[j++], aux->elem);
+                aux = aux->right;
+            }
+            DestroyTree(&head);
+            /*****************************/
+
+            fscanf(fp, "%d %d", &is_integer_opt, &same_range);
+            WaiveComment(fp);
+
+            /* loading lower and upper bounds */
+            LB = (double *)malloc(n * sizeof(double));
+            UB = (double *)malloc(n * sizeof(double));
+
+            if (same_range){
+                for (j = 0; j < n; j++){
+                    fscanf(fp, "%lf %lf", &(LB[j]), &(UB[j]));
+                    WaiveComment(fp);
+                }   
+            }
+            else{
+                fscanf(fp, "%lf %lf", &(LB[0]), &(UB[0]));
+                WaiveComment(fp);
+                for (j = 1; j < n; j++){
+                    LB[j] = LB[0];
+                    UB[j] = UB[0];
+                }   
+            }
+            /* loading constants */
+            if (has_constant){
+                if(opt_id == _GP_){
+                    constant = (double **)malloc(n * sizeof(double *));
+                    for (j = 0; j < n; j++)
+                        constant[j] = (double *)malloc(N_CONSTANTS * sizeof(double));
+
+                    for (i = 0; i < n; i++)
+                        for (j = 0; j < N_CONSTANTS; j++)
+                            constant[i][j] = GenerateUniformRandomNumber(LB[i], UB[i]);
+                            
+                }else{ /* tensor-based GP */
+                    /* here we generate N_CONSTANTS random matrices within the range [0,1] */
+                    t_constant = (double ***)malloc(N_CONSTANTS * sizeof(double **));
+                    for(i = 0; i < N_CONSTANTS; i++){
+                        t_constant[i] = (double **)malloc(n * sizeof(double *));
+                        for (j = 0; j < n; j++)
+                            t_constant[i][j] = (double *)malloc(tensor_dim * sizeof(double));
+                    }
+                    
+                    for (i = 0; i < N_CONSTANTS; i++)
+                        for (j = 0; j < n; j++)
+                            for (k = 0; k < tensor_dim; k++)
+                                t_constant[i][j][k] = GenerateUniformRandomNumber(0, 1);
+                            
+                }
+            }
+            /*********************/
+            fprintf(stderr,"\nFLAG 1");
+            if(opt_id == _GP_) s = CreateSearchSpace(m, n, _GP_, min_depth, max_depth, n_terminals, N_CONSTANTS, n_functions, terminal, constant, function);
+            else s = CreateSearchSpace(m, n, _TGP_, min_depth, max_depth, n_terminals, N_CONSTANTS, n_functions, terminal, t_constant, function, tensor_dim);
+            fprintf(stderr,"\nFLAG 2");
+            
+            s->iterations = iterations;
+            s->pReproduction = pReproduction;
+            s->pMutation = pMutation;
+            s->pCrossover = pCrossover;
+            s->is_integer_opt = is_integer_opt;
+            s->tensor_dim = tensor_dim;
+
+            for (j = 0; j < s->n; j++){
+                s->LB[j] = LB[j];
+                s->UB[j] = UB[j];
+            }
+            free(LB);
+            free(UB);
+            break;
+        case _LOA_:
+            fscanf(fp, "%lf %lf %lf %lf %lf %lf %d", &sex_rate, &nomad_percent, &roaming_percent, &mating_prob, &pMutation, &imigration_rate, &n_prides);
+            s = CreateSearchSpace(m, n, _LOA_, sex_rate, nomad_percent, roaming_percent, mating_prob, pMutation, imigration_rate, n_prides);
+            s->iterations = iterations;
+            WaiveComment(fp);
+            break;
+        default:
+            fprintf(stderr, "\nInvalid optimization identifier @ReadSearchSpaceFromFile.\n");
+            break;
+    }
+
+    if ((opt_id != _GP_) && (opt_id != _TGP_)){
+        for (j = 0; j < s->n; j++){
+            fscanf(fp, "%lf %lf", &(s->LB[j]), &(s->UB[j]));
+            WaiveComment(fp);
+        }
+    }
+
+    fclose(fp);
+
+    return s;
+}
+
+/* It returns the identifier of the function used as input
+Parameters:
+s: string with the function node description */
+int getFUNCTIONid(char *s)
+{
+    if (!strcmp(s, "SUM"))
+        return _SUM_;
+    else if (!strcmp(s, "SUB"))
+        return _SUB_;
+    else if (!strcmp(s, "MUL"))
+        return _MUL_;
+    else if (!strcmp(s, "DIV"))
+        return _DIV_;
+    else if (!strcmp(s, "EXP"))
+        return _EXP_;
+    else if (!strcmp(s, "SQRT"))
+        return _SQRT_;
+    else if (!strcmp(s, "LOG"))
+        return _LOG_;
+    else if (!strcmp(s, "ABS"))
+        return _ABS_;
+    else if (!strcmp(s, "AND"))
+        return _AND_;
+    else if (!strcmp(s, "OR"))
+        return _OR_;
+    else if (!strcmp(s, "XOR"))
         return _XOR_;
     else if (!strcmp(s, "NOT"))
         return _NOT_;
@@ -1754,898 +3095,3121 @@ int getFUNCTIONid(char *s)
         return _TDIV_;
     else
     {
-        fprintf(stderr, "\nUndefined function @getFUNCTIONid.");
-        exit(-1);
+        fprintf(stderr, "\nUndefined function @getFUNCTIONid.");
+        exit(-1);
+    }
+}
+
+/* It selects k elements based on the roulette selection method.
+ * The output is an array with the indices of the selected elements.
+Parameters:
+s: search space
+k: number of elements to be selected */
+int *RouletteSelection(SearchSpace *s, int k)
+{
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @RouletteSelection.\n");
+        return NULL;
+    }
+
+    if (k < 1)
+    {
+        fprintf(stderr, "\nInvalid input @RouletteSelection.\n");
+        return NULL;
+    }
+
+    int *elem = NULL, i, j;
+    double sum, *accum = NULL, prob;
+    Data *D = NULL;
+
+    elem = (int *)malloc(k * sizeof(int));
+    D = (Data *)malloc(s->m * sizeof(Data));
+
+    /* It normalizes the fitness of each agent ***/
+    sum = 0;
+    for (i = 0; i < s->m; i++)
+    {
+        D[i].id = i;
+        D[i].val = 1 / s->tree_fit[i];
+        sum += D[i].val;
+    }
+    for (i = 0; i < s->m; i++)
+        D[i].val /= sum;
+
+    /* It sorts the population by ascending values of fitness */
+    qsort(D, s->m, sizeof(Data), SortDataByVal);
+
+    /* It computes the accumulate normalized fitness */
+    accum = (double *)calloc(s->m, sizeof(double));
+    for (i = 0; i < s->m; i++)
+    {
+        for (j = i; j >= 0; j--)
+            accum[i] += D[j].val;
+    }
+
+    for (j = 0; j < k; j++)
+    {
+        /* It picks up the selected individual */
+        prob = GenerateUniformRandomNumber(0, 1);
+        i = 0;
+        while ((accum[i] < prob) && (i < s->m))
+            i++;
+        if (i)
+            elem[j] = D[i - 1].id;
+        else
+            elem[j] = D[i].id;
+        elem[j] = D[i].id;
+    }
+
+    free(D);
+    free(accum);
+
+    return elem;
+}
+
+int *RouletteSelectionGA(SearchSpace *s, int k)
+{
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @RouletteSelectionGA.\n");
+        return NULL;
+    }
+
+    if (k < 1)
+    {
+        fprintf(stderr, "\nInvalid input @RouletteSelectionGA.\n");
+        return NULL;
+    }
+
+    int *elem = NULL, i, j;
+    double min, sum, *accum = NULL, prob;
+    Data *D = NULL;
+
+    elem = (int *)malloc(k * sizeof(int));
+    D = (Data *)malloc(s->m * sizeof(Data));
+
+    /* It normalizes the fitness of each agent ***/
+    sum = 0;
+    min = DBL_MAX;
+
+    for(i = 0; i < s->m; i++)
+        min = s->a[i]->fit < min ? s->a[i]->fit : min;
+
+    for (i = 0; i < s->m; i++) {
+        D[i].id = i;
+        D[i].val = s->a[i]->fit + min != 0 ? ((-2)*min) : 0;
+        D[i].val = 1 / D[i].val;
+        sum += D[i].val;
+    }
+    for (i = 0; i < s->m; i++)
+        D[i].val /= sum;
+
+    /* It sorts the population by ascending values of fitness */
+    qsort(D, s->m, sizeof(Data), SortDataByVal);
+
+    /* It computes the accumulate normalized fitness */
+    accum = (double *)calloc(s->m, sizeof(double));
+    for (i = 0; i < s->m; i++)
+    {
+        for (j = i; j >= 0; j--)
+            accum[i] += D[j].val;
+    }
+
+    for (j = 0; j < k; j++)
+    {
+        /* It picks up the selected individual */
+        prob = GenerateUniformRandomNumber(0, 1);
+        i = 0;
+        while ((accum[i] < prob) && (i < s->m))
+            i++;
+        if (i)
+            elem[j] = D[i - 1].id;
+        else
+            elem[j] = D[i].id;
+        elem[j] = D[i].id;
+    }
+
+    free(D);
+    free(accum);
+
+    return elem;
+}
+
+/* It selects an agent by a tournament among agents drawn at random (with replacement), i.e., the best of them according to
+Deb's feasibility rules. It costs O(size), regardless of the number of agents.
+Parameters:
+s: search space
+size: number of agents that take part in the tournament */
+int TournamentSelection(SearchSpace *s, int size)
+{
+    int i, best, candidate;
+
+    if (!s || (size < 1))
+    {
+        fprintf(stderr, "\nInvalid input parameters @TournamentSelection.\n");
+        return -1;
+    }
+
+    best = (int)GenerateUniformRandomNumber(0, s->m);
+    for (i = 1; i < size; i++)
+    {
+        candidate = (int)GenerateUniformRandomNumber(0, s->m);
+        if (IsBetterSolution(s->a[candidate]->fit, s->a[candidate]->cv, s->a[best]->fit, s->a[best]->cv))
+            best = candidate;
+    }
+
+    return best;
+}
+
+/* It creates a sampler of up to capacity outcomes
+Parameters:
+capacity: maximum number of outcomes */
+Sampler *CreateSampler(int capacity)
+{
+    Sampler *sp = NULL;
+
+    if (capacity < 1)
+    {
+        fprintf(stderr, "\nInvalid parameters @CreateSampler.\n");
+        return NULL;
+    }
+
+    sp = (Sampler *)malloc(sizeof(Sampler));
+    sp->capacity = capacity;
+    sp->size = 0;
+    sp->prob = (double *)malloc(capacity * sizeof(double));
+    sp->alias = (int *)malloc(capacity * sizeof(int));
+    sp->stack = (int *)malloc(capacity * sizeof(int));
+
+    return sp;
+}
+
+/* It deallocates a sampler
+Parameters:
+sp: sampler */
+void DestroySampler(Sampler **sp)
+{
+    Sampler *tmp = *sp;
+
+    if (!tmp)
+    {
+        fprintf(stderr, "\nSampler not allocated @DestroySampler.\n");
+        return;
+    }
+
+    free(tmp->prob);
+    free(tmp->alias);
+    free(tmp->stack);
+    free(tmp);
+    *sp = NULL;
+}
+
+/* It sets the weights of the outcomes of a sampler (Vose's construction of the alias tables). Outcome i is drawn with
+probability w[i] / sum(w), or uniformly at random if all weights are zero.
+Parameters:
+sp: sampler
+w: non-negative weights (size-sized array)
+size: number of outcomes */
+void BuildSampler(Sampler *sp, double *w, int size)
+{
+    int i, l, g, n_small = 0, n_large = 0;
+    double sum = 0;
+
+    if (!sp || !w || (size < 1) || (size > sp->capacity))
+    {
+        fprintf(stderr, "\nInvalid input parameters @BuildSampler.\n");
+        return;
+    }
+
+    for (i = 0; i < size; i++)
+        sum += w[i];
+
+    /* the outcomes below the average are stacked from the beginning of the buffer, and the other ones from its end */
+    for (i = 0; i < size; i++)
+    {
+        sp->prob[i] = (sum > 0) ? w[i] * size / sum : 1;
+        sp->alias[i] = i;
+        if (sp->prob[i] < 1)
+            sp->stack[n_small++] = i;
+        else
+            sp->stack[size - ++n_large] = i;
+    }
+
+    while (n_small && n_large)
+    { /* the slot of a small outcome is filled up by a large one */
+        l = sp->stack[--n_small];
+        g = sp->stack[size - n_large];
+        sp->alias[l] = g;
+        sp->prob[g] -= 1 - sp->prob[l];
+        if (sp->prob[g] < 1)
+        {
+            n_large--;
+            sp->stack[n_small++] = g;
+        }
+    }
+
+    while (n_small) /* rounding errors */
+        sp->prob[sp->stack[--n_small]] = 1;
+    while (n_large)
+        sp->prob[sp->stack[size - n_large--]] = 1;
+
+    sp->size = size;
+}
+
+/* It draws an outcome of a sampler with a single random number
+Parameters:
+sp: sampler */
+int DrawSampler(Sampler *sp)
+{
+    int i;
+    double u;
+
+    if (!sp || !sp->size)
+    {
+        fprintf(stderr, "\nSampler not built @DrawSampler.\n");
+        return -1;
+    }
+
+    u = GenerateUniformRandomNumber(0, sp->size);
+    i = (int)u;
+    if (i >= sp->size)
+        i = sp->size - 1;
+
+    return (u - i < sp->prob[i]) ? i : sp->alias[i];
+}
+/**************************/
+
+/* Multi-objective-related functions */
+/* It compares two solutions by the objective j, or lexicographically by all objectives if j < 0
+Parameters:
+f1: objectives of the first solution
+f2: objectives of the second solution
+n_objectives: number of objectives
+j: objective used for comparison */
+static int CompareObjectives(double *f1, double *f2, int n_objectives, int j)
+{
+    int k;
+
+    if (j >= 0)
+        return (f1[j] > f2[j]) - (f1[j] < f2[j]);
+
+    for (k = 0; k < n_objectives; k++)
+        if (f1[k] != f2[k])
+            return (f1[k] > f2[k]) - (f1[k] < f2[k]);
+
+    return 0;
+}
+
+/* It sorts the indices of solutions in ascending order of the objective j (lexicographic order if j < 0). It is a bottom-up
+merge sort, since qsort would require the objectives to be kept in a global variable.
+Parameters:
+id: indices of the solutions (size-sized array)
+tmp: scratch buffer (size-sized array)
+size: number of solutions
+f: objectives of all solutions (row-wise)
+n_objectives: number of objectives
+j: objective used for sorting */
+static void SortObjectives(int *id, int *tmp, int size, double *f, int n_objectives, int j)
+{
+    int width, lo, mid, hi, a, b, k, *src = id, *dst = tmp, *swap;
+
+    for (width = 1; width < size; width *= 2)
+    {
+        for (lo = 0; lo < size; lo += 2 * width)
+        {
+            mid = (lo + width < size) ? lo + width : size;
+            hi = (lo + 2 * width < size) ? lo + 2 * width : size;
+            for (a = lo, b = mid, k = lo; (a < mid) && (b < hi); k++)
+            {
+                if (CompareObjectives(f + (size_t)src[b] * n_objectives, f + (size_t)src[a] * n_objectives, n_objectives, j) < 0)
+                    dst[k] = src[b++];
+                else
+                    dst[k] = src[a++];
+            }
+            while (a < mid)
+                dst[k++] = src[a++];
+            while (b < hi)
+                dst[k++] = src[b++];
+        }
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != id)
+        memcpy(id, src, size * sizeof(int));
+}
+
+/* It creates an archive of non-dominated solutions. Once attached to a search space (s->archive), it is deallocated by DestroySearchSpace.
+Parameters:
+n: number of decision variables
+n_objectives: number of objectives
+capacity: maximum number of solutions in the archive */
+Archive *CreateArchive(int n, int n_objectives, int capacity)
+{
+    Archive *A = NULL;
+
+    if ((n < 1) || (n_objectives < 2) || (capacity < 2))
+    {
+        fprintf(stderr, "\nInvalid parameters @CreateArchive.\n");
+        return NULL;
+    }
+
+    A = (Archive *)malloc(sizeof(Archive));
+    A->n = n;
+    A->n_objectives = n_objectives;
+    A->capacity = capacity;
+    A->size = 0;
+    A->n_updates = 0;
+
+    /* an extra slot keeps a new solution until the most crowded one is discarded */
+    A->X = (double *)malloc((size_t)(capacity + 1) * n * sizeof(double));
+    A->f = (double *)malloc((size_t)(capacity + 1) * n_objectives * sizeof(double));
+    A->crowding = (double *)malloc((capacity + 1) * sizeof(double));
+    A->index = (int *)malloc((capacity + 1) * sizeof(int));
+
+    return A;
+}
+
+/* It deallocates an archive
+Parameters:
+A: archive */
+void DestroyArchive(Archive **A)
+{
+    Archive *tmp = *A;
+
+    if (!tmp)
+    {
+        fprintf(stderr, "\nArchive not allocated @DestroyArchive.\n");
+        return;
+    }
+
+    free(tmp->X);
+    free(tmp->f);
+    free(tmp->crowding);
+    free(tmp->index);
+    free(tmp);
+    *A = NULL;
+}
+
+/* It removes all solutions of an archive, keeping its allocations
+Parameters:
+A: archive */
+void ClearArchive(Archive *A)
+{
+    if (!A)
+    {
+        fprintf(stderr, "\nArchive not allocated @ClearArchive.\n");
+        return;
+    }
+
+    A->size = 0;
+    A->n_updates = 0;
+}
+
+/* It checks whether a solution Pareto-dominates another one, i.e., it is not worse in any objective and it is better in at least one
+Parameters:
+f1: objectives of the first solution
+f2: objectives of the second solution
+n_objectives: number of objectives */
+char Dominates(double *f1, double *f2, int n_objectives)
+{
+    int j;
+    char better = 0;
+
+    for (j = 0; j < n_objectives; j++)
+    {
+        if (f1[j] > f2[j])
+            return 0;
+        if (f1[j] < f2[j])
+            better = 1;
+    }
+
+    return better;
+}
+
+/* It removes the solution at a given position of an archive, keeping the order of the remaining ones
+Parameters:
+A: archive
+i: position of the solution */
+static void RemoveFromArchive(Archive *A, int i)
+{
+    memmove(A->X + (size_t)i * A->n, A->X + (size_t)(i + 1) * A->n, (size_t)(A->size - i - 1) * A->n * sizeof(double));
+    memmove(A->f + (size_t)i * A->n_objectives, A->f + (size_t)(i + 1) * A->n_objectives, (size_t)(A->size - i - 1) * A->n_objectives * sizeof(double));
+    A->size--;
+}
+
+/* It adds a solution to an archive if no solution of the archive dominates (or equals) it, and it removes the solutions dominated
+by the new one. With two objectives the archive is sorted by the first objective, so the second one strictly decreases along it:
+the new solution is dominated only if its predecessor is not worse in the second objective, and the solutions it dominates are
+the ones that follow it up to the first one with a smaller second objective. With more objectives the archive is scanned.
+If the archive overflows, its most crowded solution is discarded (the extreme ones are kept whenever possible). It returns 1 if the solution is kept.
+Parameters:
+A: archive
+x: position
+f: objectives */
+char UpdateArchive(Archive *A, double *x, double *f)
+{
+    int M, i, j, lo, hi, mid, pos;
+
+    if (!A || !x || !f)
+    {
+        fprintf(stderr, "\nInvalid input parameters @UpdateArchive.\n");
+        return 0;
+    }
+
+    M = A->n_objectives;
+    for (j = 0; j < M; j++)
+        if (isnan(f[j]) || (f[j] == DBL_MAX)) /* infeasible solutions are not archived */
+            return 0;
+
+    if (M == 2)
+    {
+        lo = 0;
+        hi = A->size;
+        while (lo < hi)
+        { /* first solution whose first objective is greater than f[0] */
+            mid = (lo + hi) / 2;
+            if (A->f[2 * mid] <= f[0])
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if ((lo > 0) && (A->f[2 * (lo - 1) + 1] <= f[1]))
+            return 0;
+
+        pos = ((lo > 0) && (A->f[2 * (lo - 1)] == f[0])) ? lo - 1 : lo; /* the predecessor may tie on the first objective */
+        for (hi = lo; (hi < A->size) && (A->f[2 * hi + 1] >= f[1]); hi++);
+
+        /* the dominated solutions [pos,hi) give room to the new one */
+        memmove(A->X + (size_t)(pos + 1) * A->n, A->X + (size_t)hi * A->n, (size_t)(A->size - hi) * A->n * sizeof(double));
+        memmove(A->f + 2 * (pos + 1), A->f + 2 * hi, (size_t)(A->size - hi) * 2 * sizeof(double));
+        A->size += 1 - (hi - pos);
+    }
+    else
+    {
+        for (i = 0; i < A->size; i++)
+            if (Dominates(A->f + (size_t)i * M, f, M) || !CompareObjectives(A->f + (size_t)i * M, f, M, -1))
+                return 0;
+
+        for (i = 0, pos = 0; i < A->size; i++)
+        {
+            if (Dominates(f, A->f + (size_t)i * M, M))
+                continue;
+            if (pos != i)
+            {
+                memcpy(A->X + (size_t)pos * A->n, A->X + (size_t)i * A->n, A->n * sizeof(double));
+                memcpy(A->f + (size_t)pos * M, A->f + (size_t)i * M, M * sizeof(double));
+            }
+            pos++;
+        }
+        A->size = pos + 1;
+    }
+
+    memcpy(A->X + (size_t)pos * A->n, x, A->n * sizeof(double));
+    memcpy(A->f + (size_t)pos * M, f, M * sizeof(double));
+
+    if (A->size > A->capacity)
+    {
+        CrowdingArchive(A);
+        for (i = 1, j = 0; i < A->size; i++)
+            if (A->crowding[i] < A->crowding[j])
+                j = i;
+        RemoveFromArchive(A, j);
+        if (j == pos)
+            return 0;
+    }
+
+    A->n_updates++;
+
+    return 1;
+}
+
+/* It computes the crowding distances of the solutions of an archive (A->crowding). With two objectives the neighbours of each
+solution are the adjacent ones, so it costs O(size).
+Parameters:
+A: archive */
+void CrowdingArchive(Archive *A)
+{
+    int i;
+    double *f, range0, range1;
+
+    if (!A)
+    {
+        fprintf(stderr, "\nArchive not allocated @CrowdingArchive.\n");
+        return;
+    }
+
+    if (A->n_objectives != 2)
+    {
+        for (i = 0; i < A->size; i++)
+            A->index[i] = i;
+        CrowdingDistance(A->f, A->index, A->size, A->n_objectives, A->crowding);
+        return;
+    }
+
+    for (i = 0; i < A->size; i++)
+        A->crowding[i] = DBL_MAX;
+    if (A->size < 3)
+        return;
+
+    f = A->f;
+    range0 = f[2 * (A->size - 1)] - f[0];
+    range1 = f[1] - f[2 * (A->size - 1) + 1];
+    for (i = 1; i < A->size - 1; i++)
+        A->crowding[i] = (f[2 * (i + 1)] - f[2 * (i - 1)]) / range0 + (f[2 * (i - 1) + 1] - f[2 * (i + 1) + 1]) / range1;
+}
+
+/* It selects a solution of an archive by a binary tournament, in which the less crowded solution wins. The crowding distances
+must be up to date (see CrowdingArchive). It returns the position of the solution, or -1 if the archive is empty.
+Parameters:
+A: archive */
+int SelectArchiveLeader(Archive *A)
+{
+    int i, k;
+
+    if (!A || !A->size)
+        return -1;
+
+    i = (int)GenerateUniformRandomNumber(0, A->size);
+    k = (int)GenerateUniformRandomNumber(0, A->size);
+
+    return (A->crowding[i] >= A->crowding[k]) ? i : k;
+}
+
+/* It sorts solutions into non-dominated fronts by the Efficient Non-dominated Sort with binary search (ENS-BS). Solutions are
+visited in lexicographic order, so a solution can only be dominated by the ones visited before it, and each one is assigned to the
+first front with no solution dominating it, which is found by a binary search over the fronts. With two objectives only the last
+solution of a front has to be checked, so the sort costs O(m log m); otherwise the front is scanned from its last solution.
+It returns the number of fronts.
+Parameters:
+f: objectives of the solutions (m x n_objectives, row-wise)
+m: number of solutions
+n_objectives: number of objectives
+rank: output array with the front of each solution (0 for the non-dominated ones) */
+int FastNonDominatedSort(double *f, int m, int n_objectives, int *rank)
+{
+    int i, p, q, lo, hi, mid, n_fronts = 0, *id = NULL, *tmp = NULL, *last = NULL, *prev = NULL;
+    char dominated;
+
+    if (!f || !rank || (m < 1) || (n_objectives < 1))
+    {
+        fprintf(stderr, "\nInvalid input parameters @FastNonDominatedSort.\n");
+        return 0;
+    }
+
+    id = (int *)malloc(4 * (size_t)m * sizeof(int));
+    tmp = id + m;
+    last = id + 2 * m; /* last solution assigned to each front */
+    prev = id + 3 * m; /* solution assigned to the same front right before each solution (-1 for the first one) */
+
+    for (i = 0; i < m; i++)
+        id[i] = i;
+    SortObjectives(id, tmp, m, f, n_objectives, -1);
+
+    for (i = 0; i < m; i++)
+    {
+        p = id[i];
+        lo = 0;
+        hi = n_fronts;
+        while (lo < hi)
+        {
+            mid = (lo + hi) / 2;
+            dominated = 0;
+            if (n_objectives == 2) /* the last solution of a front has the smallest second objective */
+                dominated = Dominates(f + 2 * (size_t)last[mid], f + 2 * (size_t)p, 2);
+            else
+                for (q = last[mid]; (q >= 0) && !dominated; q = prev[q])
+                    dominated = Dominates(f + (size_t)q * n_objectives, f + (size_t)p * n_objectives, n_objectives);
+
+            if (dominated)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        rank[p] = lo;
+        prev[p] = (lo < n_fronts) ? last[lo] : -1;
+        last[lo] = p;
+        if (lo == n_fronts)
+            n_fronts++;
+    }
+
+    free(id);
+
+    return n_fronts;
+}
+
+/* It computes the crowding distances of the solutions of a front, i.e., the sum over the objectives of the normalized distance
+between the two neighbours of each solution. The extreme solutions of each objective get DBL_MAX.
+Parameters:
+f: objectives of all solutions (row-wise)
+id: indices of the solutions of the front
+size: number of solutions of the front
+n_objectives: number of objectives
+dist: output array with the crowding distances, indexed as f (i.e., dist[id[i]]) */
+void CrowdingDistance(double *f, int *id, int size, int n_objectives, double *dist)
+{
+    int i, j, *order = NULL, *tmp = NULL;
+    double range;
+
+    if (!f || !id || !dist)
+    {
+        fprintf(stderr, "\nInvalid input parameters @CrowdingDistance.\n");
+        return;
+    }
+
+    for (i = 0; i < size; i++)
+        dist[id[i]] = (size < 3) ? DBL_MAX : 0;
+    if (size < 3)
+        return;
+
+    order = (int *)malloc(2 * (size_t)size * sizeof(int));
+    tmp = order + size;
+    for (j = 0; j < n_objectives; j++)
+    {
+        memcpy(order, id, size * sizeof(int));
+        SortObjectives(order, tmp, size, f, n_objectives, j);
+
+        dist[order[0]] = dist[order[size - 1]] = DBL_MAX;
+        range = f[(size_t)order[size - 1] * n_objectives + j] - f[(size_t)order[0] * n_objectives + j];
+        if (range <= 0)
+            continue;
+
+        for (i = 1; i < size - 1; i++)
+            if (dist[order[i]] < DBL_MAX)
+                dist[order[i]] += (f[(size_t)order[i + 1] * n_objectives + j] - f[(size_t)order[i - 1] * n_objectives + j]) / range;
+    }
+
+    free(order);
+}
+
+/* It evaluates the objectives of an agent and updates the evaluation counter of the search space. The number of objectives is
+given by the archive of the search space (s->archive). Infeasible agents are not evaluated, and all of their objectives are set
+to DBL_MAX, so they are dominated by any feasible agent.
+Parameters:
+s: search space
+a: agent
+Evaluate: pointer to the function used to evaluate the objectives of agents
+f: output array with the objectives
+arg: list of additional arguments */
+void EvaluateObjectives(SearchSpace *s, Agent *a, prtMOFun Evaluate, double *f, va_list arg)
+{
+    int j;
+
+    if (s->n_constraints)
+    {
+        a->cv = ComputeConstraintViolation(s, a, arg);
+        if (a->cv > 0)
+        {
+#pragma omp atomic
+            s->stop.n_infeasible++;
+            for (j = 0; j < s->archive->n_objectives; j++)
+                f[j] = DBL_MAX;
+            return;
+        }
+    }
+
+#pragma omp atomic
+    s->stop.n_evaluations++;
+    Evaluate(a, f, arg);
+}
+
+/* It evaluates the objectives of a batch of agents, in parallel if s->n_threads > 1, and then it offers them to the archive of the
+search space in the order of the batch, so the archive does not depend on the number of threads. Since there is no single global
+best, s->gfit is set to minus the number of solutions accepted by the archive so far, so the stagnation criterion counts the
+iterations with no new non-dominated solution. It returns the number of agents accepted by the archive.
+Parameters:
+s: search space
+a: array of agents
+m: number of agents
+Evaluate: pointer to the function used to evaluate the objectives of agents
+f: output array with the objectives of the agents (m x s->archive->n_objectives, row-wise)
+arg: list of additional arguments */
+int EvaluateObjectivesBatch(SearchSpace *s, Agent **a, int m, prtMOFun Evaluate, double *f, va_list arg)
+{
+    int i, M, accepted = 0;
+
+    if ((!s) || (!a) || (!f) || (!s->archive))
+    {
+        fprintf(stderr, "\nSearch space, agents and/or archive not allocated @EvaluateObjectivesBatch.\n");
+        exit(-1);
+    }
+
+    M = s->archive->n_objectives;
+
+#pragma omp parallel num_threads(s->n_threads) if (s->n_threads > 1)
+    {
+        va_list argtmp;
+
+        PinWorker(s);
+        if (s->numa)
+        { /* every agent is evaluated by the worker that owns its memory (see SetNUMASearchSpace) */
+#pragma omp for schedule(static)
+            for (i = 0; i < m; i++)
+            {
+                va_copy(argtmp, arg); /* every agent reads the additional arguments from its own copy */
+                EvaluateObjectives(s, a[i], Evaluate, f + (size_t)i * M, argtmp);
+                va_end(argtmp);
+            }
+        }
+        else
+        {
+#pragma omp for schedule(dynamic)
+            for (i = 0; i < m; i++)
+            {
+                va_copy(argtmp, arg); /* every agent reads the additional arguments from its own copy */
+                EvaluateObjectives(s, a[i], Evaluate, f + (size_t)i * M, argtmp);
+                va_end(argtmp);
+            }
+        }
+        UnpinWorker();
+    }
+
+    for (i = 0; i < m; i++)
+        accepted += UpdateArchive(s->archive, a[i]->x, f + (size_t)i * M);
+
+    CrowdingArchive(s->archive);
+    s->gfit = -(double)s->archive->n_updates;
+
+    return accepted;
+}
+/**************************/
+
+/* NUMA-related functions */
+/* It reads a list of CPUs or nodes in the sysfs format (e.g., "0-3,8-11") from a file
+Parameters:
+fileName: name of the file
+mask: output array with NUMA_MAX_CPUS positions, where the listed identifiers are set to 1
+It returns the number of listed identifiers (0 if the file cannot be read). */
+static int ReadCPUList(char *fileName, char *mask)
+{
+    FILE *fp = NULL;
+    char line[4096], *p = NULL;
+    int a, b, j, count = 0;
+
+    memset(mask, 0, NUMA_MAX_CPUS * sizeof(char));
+    fp = fopen(fileName, "r");
+    if (!fp)
+        return 0;
+    if (!fgets(line, sizeof(line), fp))
+    {
+        fclose(fp);
+        return 0;
+    }
+    fclose(fp);
+
+    for (p = strtok(line, ",\n"); p; p = strtok(NULL, ",\n"))
+    {
+        if (sscanf(p, "%d-%d", &a, &b) < 2)
+        {
+            if (sscanf(p, "%d", &a) < 1)
+                continue;
+            b = a;
+        }
+        for (j = a; (j <= b) && (j < NUMA_MAX_CPUS); j++)
+            if ((j >= 0) && !mask[j])
+            {
+                mask[j] = 1;
+                count++;
+            }
+    }
+
+    return count;
+}
+
+#ifdef __linux__
+/* It reads the CPUs the process may run on. The mask of the main thread (whose identifier is the one of the process) is read
+once, before any worker is pinned, so the outcome does not depend on the thread that calls it.
+Parameters:
+set: output mask
+It returns 1 on success and 0 otherwise. */
+static char ReadProcessAffinity(cpu_set_t *set)
+{
+    static cpu_set_t process_set;
+    static char status = 0; /* 0: not read yet, 1: read, -1: not available */
+
+#pragma omp critical(numa)
+    {
+        if (!status)
+            status = sched_getaffinity(getpid(), sizeof(cpu_set_t), &process_set) ? -1 : 1;
+    }
+    if (status < 0)
+        return 0;
+    *set = process_set;
+
+    return 1;
+}
+#endif
+
+/* It reads the NUMA topology of the machine from sysfs, keeping the CPUs the process may run on (its affinity mask)
+and the nodes that have some of them. If sysfs is not available, the online CPUs are seen as a single node. */
+Topology *ReadTopology(void)
+{
+    Topology *tp = NULL;
+    char allowed[NUMA_MAX_CPUS], nodes[NUMA_MAX_CPUS], cpus[NUMA_MAX_CPUS], fileName[128];
+    int i, j, k;
+
+    memset(allowed, 0, sizeof(allowed));
+#ifdef __linux__
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    if (ReadProcessAffinity(&set))
+    {
+        for (j = 0; (j < NUMA_MAX_CPUS) && (j < CPU_SETSIZE); j++)
+            allowed[j] = CPU_ISSET(j, &set) ? 1 : 0;
+    }
+    else
+#endif
+    {
+        k = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        for (j = 0; (j < k) && (j < NUMA_MAX_CPUS); j++)
+            allowed[j] = 1;
+    }
+
+    tp = (Topology *)malloc(sizeof(Topology));
+    tp->n_nodes = 0;
+    tp->node_id = (int *)malloc(NUMA_MAX_CPUS * sizeof(int));
+    tp->n_cpus = (int *)calloc(NUMA_MAX_CPUS, sizeof(int));
+    tp->cpu = (int **)calloc(NUMA_MAX_CPUS, sizeof(int *));
+
+    if (ReadCPUList("/sys/devices/system/node/online", nodes))
+    {
+        for (i = 0; i < NUMA_MAX_CPUS; i++)
+        {
+            if (!nodes[i])
+                continue;
+            sprintf(fileName, "/sys/devices/system/node/node%d/cpulist", i);
+            if (!ReadCPUList(fileName, cpus))
+                continue;
+
+            k = tp->n_nodes;
+            tp->cpu[k] = (int *)malloc(NUMA_MAX_CPUS * sizeof(int));
+            for (j = 0; j < NUMA_MAX_CPUS; j++)
+                if (cpus[j] && allowed[j])
+                    tp->cpu[k][tp->n_cpus[k]++] = j;
+            if (tp->n_cpus[k])
+                tp->node_id[tp->n_nodes++] = i;
+            else
+            { /* memory-only node, or none of its CPUs is available */
+                free(tp->cpu[k]);
+                tp->cpu[k] = NULL;
+            }
+        }
+    }
+
+    if (!tp->n_nodes)
+    { /* a single node with every available CPU */
+        tp->cpu[0] = (int *)malloc(NUMA_MAX_CPUS * sizeof(int));
+        for (j = 0; j < NUMA_MAX_CPUS; j++)
+            if (allowed[j])
+                tp->cpu[0][tp->n_cpus[0]++] = j;
+        if (!tp->n_cpus[0])
+            tp->cpu[0][tp->n_cpus[0]++] = 0;
+        tp->node_id[0] = 0;
+        tp->n_nodes = 1;
+    }
+
+    return tp;
+}
+
+/* It deallocates a NUMA topology
+Parameters:
+tp: address of the topology */
+void DestroyTopology(Topology **tp)
+{
+    int i;
+
+    if (!*tp)
+        return;
+
+    for (i = 0; i < (*tp)->n_nodes; i++)
+        free((*tp)->cpu[i]);
+    free((*tp)->cpu);
+    free((*tp)->n_cpus);
+    free((*tp)->node_id);
+    free(*tp);
+    *tp = NULL;
+}
+
+/* It returns the CPU a worker is pinned to. The workers are spread over the available CPUs in contiguous blocks, node after
+node and in proportion to the number of CPUs of each node, so the workers that own consecutive agents share a node and
+no two workers share a CPU unless there are more workers than CPUs.
+Parameters:
+tp: NUMA topology
+thread: identifier of the worker (0 to n_threads-1)
+n_threads: number of workers */
+int GetThreadCPU(Topology *tp, int thread, int n_threads)
+{
+    int i, p, total = 0;
+
+    if (!tp || (n_threads < 1) || (thread < 0) || (thread >= n_threads))
+    {
+        fprintf(stderr, "\nInvalid input parameters @GetThreadCPU.\n");
+        exit(-1);
+    }
+
+    for (i = 0; i < tp->n_nodes; i++)
+        total += tp->n_cpus[i];
+
+    p = (int)(((long int)thread * total) / n_threads);
+    for (i = 0; p >= tp->n_cpus[i]; i++)
+        p -= tp->n_cpus[i];
+
+    return tp->cpu[i][p];
+}
+
+/* It pins the calling thread to a CPU, so the memory it touches first is placed on the node of that CPU
+Parameters:
+cpu: identifier of the CPU
+It returns 1 on success and 0 otherwise (or if pinning is not supported). */
+char PinThread(int cpu)
+{
+#ifdef __linux__
+    cpu_set_t set;
+
+    if ((cpu < 0) || (cpu >= CPU_SETSIZE))
+        return 0;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    return !sched_setaffinity(0, sizeof(cpu_set_t), &set);
+#else
+    return 0;
+#endif
+}
+
+#if defined(_OPENMP) && defined(__linux__)
+static RAND_THREAD_LOCAL cpu_set_t worker_affinity; /* CPUs the calling worker could run on before PinWorker */
+static RAND_THREAD_LOCAL char worker_pinned = 0; /* has the calling worker been pinned by PinWorker? */
+#endif
+
+/* It pins the calling worker of a parallel region to its CPU (see GetThreadCPU) if the NUMA-aware mode is on, saving the
+CPUs it could run on so UnpinWorker gives them back.
+It must be called by every worker at the beginning of the parallel regions that work on the agents.
+Parameters:
+s: search space */
+void PinWorker(SearchSpace *s)
+{
+#ifdef _OPENMP
+    if (s->numa && s->topology)
+    {
+#ifdef __linux__
+        if (!worker_pinned)
+            worker_pinned = !sched_getaffinity(0, sizeof(cpu_set_t), &worker_affinity);
+#endif
+        PinThread(GetThreadCPU(s->topology, omp_get_thread_num(), omp_get_num_threads()));
+    }
+#endif
+}
+
+/* It gives the calling worker back the CPUs it could run on before PinWorker (nothing is done if it has not been pinned).
+It must be called by every worker at the end of the parallel regions that call PinWorker, so neither the calling thread
+(worker 0) nor the threads OpenMP keeps for later regions stay pinned after a run. */
+void UnpinWorker(void)
+{
+#if defined(_OPENMP) && defined(__linux__)
+    if (worker_pinned)
+    {
+        sched_setaffinity(0, sizeof(cpu_set_t), &worker_affinity);
+        worker_pinned = 0;
+    }
+#endif
+}
+
+/* It moves an array to memory touched first by the calling thread
+Parameters:
+p: array (it is deallocated)
+size: size of the array in bytes */
+static void *RelocateArray(void *p, size_t size)
+{
+    void *q = NULL;
+
+    if (!p)
+        return NULL;
+
+    q = malloc(size);
+    memcpy(q, p, size);
+    free(p);
+
+    return q;
+}
+
+/* It moves the arrays of a set of agents to the node of the worker that evaluates them in the NUMA-aware mode, i.e., every
+array is allocated again by the worker that gets agent i in the static schedule EvaluateBatch follows over m agents.
+Nothing is done if the mode is off. The techniques call it for the buffers they keep along the run (e.g., offspring).
+Parameters:
+s: search space
+a: array of agents, whose arrays must have been allocated one by one (e.g., by CreateAgent or CopyAgent)
+m: number of agents */
+void PlaceAgents(SearchSpace *s, Agent **a, int m)
+{
+    if (!s || !a)
+    {
+        fprintf(stderr, "\nSearch space and/or agents not allocated @PlaceAgents.\n");
+        exit(-1);
+    }
+
+    if (!s->numa)
+        return;
+
+#pragma omp parallel num_threads(s->n_threads) if (s->n_threads > 1)
+    {
+        int i, words = getBinaryWords(s->n);
+        Agent *p = NULL;
+
+        PinWorker(s);
+
+#pragma omp for schedule(static)
+        for (i = 0; i < m; i++)
+        {
+            p = a[i];
+            p->x = (double *)RelocateArray(p->x, p->n * sizeof(double));
+            p->v = (double *)RelocateArray(p->v, p->n * sizeof(double));
+            p->xl = (double *)RelocateArray(p->xl, p->n * sizeof(double));
+            p->prev_x = (double *)RelocateArray(p->prev_x, p->n * sizeof(double));
+            p->b = (uint64_t *)RelocateArray(p->b, words * sizeof(uint64_t));
+            p->bl = (uint64_t *)RelocateArray(p->bl, words * sizeof(uint64_t));
+        }
+        UnpinWorker();
+    }
+}
+
+/* It turns on the NUMA-aware parallel mode of a search space. The workers (s->n_threads) are pinned to CPUs spread over
+the NUMA nodes (see GetThreadCPU), and the arrays of each agent are allocated again by the worker that owns it, so its
+pages are placed on the node of that worker (see PlaceAgents). Every agent is evaluated by its owner from then on, since the
+evaluations follow the same static schedule as the placement, and each node keeps its partition of the population local.
+Only the parallel evaluations benefit from it, i.e., the ones made through EvaluateBatch and EvaluateObjectivesBatch, the
+GP/TGP forests and the LOA prides. The binary techniques (runBPSO, runBGA and runBHS) and MBO evaluate placed agents.
+WCA moves the positions into a block of its own, whose rows are first touched by the workers that evaluate them, but the
+ranking swaps raindrops among the sea, the rivers and the streams, so the rows of the swapped ones drift to other workers.
+HS, IHS and ABC improvise new candidates at each iteration and evaluate the ones kept by the surrogate model as a
+compacted batch, so they are evaluated in parallel but not placed. The techniques that evaluate their population
+sequentially (e.g., PSO, GA and BA through EvaluateSearchSpace) do not benefit at all.
+It should be called after the search space is initialized, and again if the population is resized. The workers are only
+pinned within the parallel regions: every thread, including the calling one (worker 0), gets its former CPUs back at the
+end of each region. It requires OpenMP (OPENMP=-fopenmp).
+Parameters:
+s: search space
+opt_id: identifier of the optimization technique */
+void SetNUMASearchSpace(SearchSpace *s, int opt_id)
+{
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @SetNUMASearchSpace.\n");
+        exit(-1);
+    }
+
+    if (!s->topology)
+        s->topology = ReadTopology();
+    s->numa = 1;
+
+    if ((opt_id == _GP_) || (opt_id == _TGP_) || (opt_id == _LOA_))
+        return; /* the terminals are shared by all workers, and the working memory is allocated by the workers themselves */
+
+    PlaceAgents(s, s->a, s->m);
+}
+/**************************/
+
+/* Binary-related functions */
+/* It counts the bits set in a word
+Parameters:
+w: word */
+static int PopCount(uint64_t w)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(w);
+#else
+    w = w - ((w >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int)((w * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/* It returns the mask of the bits of the last word of a bit-packed array that hold decision variables
+Parameters:
+n: number of decision variables */
+static uint64_t BinaryTailMask(int n)
+{
+    int r = n % BINARY_WORD_SIZE;
+
+    return r ? (((uint64_t)1 << r) - 1) : ~(uint64_t)0;
+}
+
+/* It returns the number of words of a bit-packed array of n decision variables
+Parameters:
+n: number of decision variables */
+int getBinaryWords(int n)
+{
+    return (n + BINARY_WORD_SIZE - 1) / BINARY_WORD_SIZE;
+}
+
+/* It turns a search space into a binary one: the position of every agent is stored as a bit-packed array (a->b), with
+decision variable j at bit j % BINARY_WORD_SIZE of word j / BINARY_WORD_SIZE, and the real-valued arrays it replaces are
+deallocated. The boundaries are set to [0,1], and the global best is kept both bit-packed (s->gb) and unpacked (s->g).
+Such search spaces must be optimized by the binary techniques (runBPSO, runBGA and runBHS), whose fitness functions read a->b.
+PSO agents keep their real-valued velocities (one per bit), so they do not shrink as much as GA and HS agents.
+As for GP, the trees must only use boolean functions (AND, OR, XOR and NOT), and they are run over bit-packed terminals, so every
+function node computes BINARY_WORD_SIZE decision variables at once; NOT is the logical complement in this case.
+The bits beyond the n-th one of every bit-packed array are always zero.
+Parameters:
+s: search space
+opt_id: _PSO_, _GA_, _HS_ or _GP_ */
+void SetBinarySearchSpace(SearchSpace *s, int opt_id)
+{
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @SetBinarySearchSpace.\n");
+        exit(-1);
+    }
+
+    int i, j;
+
+    switch (opt_id)
+    {
+    case _PSO_:
+    case _GA_:
+    case _HS_:
+        for (i = 0; i < s->m_alloc; i++)
+            MakeBinaryAgent(s->a[i], opt_id);
+        for (j = 0; j < s->n; j++)
+        {
+            s->LB[j] = 0;
+            s->UB[j] = 1;
+        }
+        break;
+    case _GP_:
+        for (i = 0; i < s->n_functions; i++)
+        {
+            j = getFUNCTIONid(s->function[i]);
+            if ((j != _AND_) && (j != _OR_) && (j != _XOR_) && (j != _NOT_))
+            {
+                fprintf(stderr, "\nBinary GP only supports the functions AND, OR, XOR and NOT @SetBinarySearchSpace.\n");
+                exit(-1);
+            }
+        }
+        break;
+    default:
+        fprintf(stderr, "\nInvalid optimization identifier @SetBinarySearchSpace.\n");
+        exit(-1);
+        break;
+    }
+
+    if (!s->gb)
+        s->gb = (uint64_t *)calloc(getBinaryWords(s->n), sizeof(uint64_t));
+    s->is_binary_opt = 1;
+}
+
+/* It packs a real-valued array into bits, i.e., bit j is set if x[j] >= 0.5
+Parameters:
+x: real-valued array
+n: number of decision variables
+b: output bit-packed array */
+void PackBinary(double *x, int n, uint64_t *b)
+{
+    int j;
+
+    memset(b, 0, getBinaryWords(n) * sizeof(uint64_t));
+    for (j = 0; j < n; j++)
+        if (x[j] >= 0.5)
+            b[j / BINARY_WORD_SIZE] |= (uint64_t)1 << (j % BINARY_WORD_SIZE);
+}
+
+/* It unpacks bits into a real-valued array of zeros and ones
+Parameters:
+b: bit-packed array
+n: number of decision variables
+x: output real-valued array */
+void UnpackBinary(uint64_t *b, int n, double *x)
+{
+    int j;
+
+    for (j = 0; j < n; j++)
+        x[j] = (double)((b[j / BINARY_WORD_SIZE] >> (j % BINARY_WORD_SIZE)) & 1);
+}
+
+/* It returns the j-th bit of a bit-packed array
+Parameters:
+b: bit-packed array
+j: position of the bit */
+char GetBinaryBit(uint64_t *b, int j)
+{
+    return (char)((b[j / BINARY_WORD_SIZE] >> (j % BINARY_WORD_SIZE)) & 1);
+}
+
+/* It sets the j-th bit of a bit-packed array
+Parameters:
+b: bit-packed array
+j: position of the bit
+bit: new value (0 or 1) */
+void SetBinaryBit(uint64_t *b, int j, char bit)
+{
+    uint64_t mask = (uint64_t)1 << (j % BINARY_WORD_SIZE);
+
+    if (bit)
+        b[j / BINARY_WORD_SIZE] |= mask;
+    else
+        b[j / BINARY_WORD_SIZE] &= ~mask;
+}
+
+/* It fills a bit-packed array with bits drawn at random
+Parameters:
+b: output bit-packed array
+n: number of decision variables
+p: probability of each bit being set */
+void GenerateBinaryArray(uint64_t *b, int n, double p)
+{
+    int j;
+
+    memset(b, 0, getBinaryWords(n) * sizeof(uint64_t));
+    for (j = 0; j < n; j++)
+        if (GenerateUniformRandomNumber(0, 1) < p)
+            b[j / BINARY_WORD_SIZE] |= (uint64_t)1 << (j % BINARY_WORD_SIZE);
+}
+
+/* It returns the number of bits set in a bit-packed array, e.g., the number of features selected by an agent
+Parameters:
+b: bit-packed array
+n: number of decision variables */
+int CountBinaryOnes(uint64_t *b, int n)
+{
+    int i, ones = 0, words = getBinaryWords(n);
+
+    for (i = 0; i < words; i++)
+        ones += PopCount(b[i]);
+
+    return ones;
+}
+
+/* It computes the Hamming distance between two bit-packed arrays, i.e., the number of decision variables they differ in
+Parameters:
+b1, b2: bit-packed arrays
+n: number of decision variables */
+int HammingDistance(uint64_t *b1, uint64_t *b2, int n)
+{
+    int i, d = 0, words = getBinaryWords(n);
+
+    for (i = 0; i < words; i++)
+        d += PopCount(b1[i] ^ b2[i]);
+
+    return d;
+}
+
+/* It evaluates the agents of a binary search space (in parallel if s->n_threads > 1), and updates their local
+bests (if they have one, i.e., a->bl) and the global best agent
+Parameters:
+s: search space
+Evaluate: pointer to the function used to evaluate agents
+arg: list of additional arguments */
+void EvaluateBinarySearchSpace(SearchSpace *s, prtFun Evaluate, va_list arg)
+{
+    if (!s || !s->is_binary_opt)
+    {
+        fprintf(stderr, "\nBinary search space not allocated @EvaluateBinarySearchSpace.\n");
+        exit(-1);
+    }
+
+    int i, words = getBinaryWords(s->n);
+    char improved = 0;
+    Agent *a = NULL;
+
+    EvaluateBatch(s, s->a, s->m, Evaluate, arg);
+
+    for (i = 0; i < s->m; i++)
+    {
+        a = s->a[i];
+        if (a->bl && (a->fit < a->best_fit))
+        { /* It updates the local best */
+            a->best_fit = a->fit;
+            memcpy(a->bl, a->b, words * sizeof(uint64_t));
+        }
+
+        if (IsBetterSolution(a->fit, a->cv, s->gfit, s->gcv))
+        { /* It updates the global best */
+            s->best = i;
+            s->gfit = a->fit;
+            s->gcv = a->cv;
+            memcpy(s->gb, a->b, words * sizeof(uint64_t));
+            improved = 1;
+        }
+    }
+
+    if (improved)
+        UnpackBinary(s->gb, s->n, s->g);
+}
+
+/* It runs a boolean tree over bit-packed terminals and constants, so every function node computes BINARY_WORD_SIZE decision
+variables at once (see SetBinarySearchSpace)
+Parameters:
+s: search space
+T: tree
+terminal: bit-packed terminals (n_terminals x getBinaryWords(s->n)), in the order of s->a
+constant: bit-packed constants (n_constants x getBinaryWords(s->n))
+out: output bit-packed array */
+void RunBinaryTree(SearchSpace *s, Node *T, uint64_t *terminal, uint64_t *constant, uint64_t *out)
+{
+    int j, op, words;
+    uint64_t *y = NULL;
+
+    if (!s || !T || !out)
+    {
+        fprintf(stderr, "\nInvalid input parameters @RunBinaryTree.\n");
+        exit(-1);
+    }
+
+    words = getBinaryWords(s->n);
+    if (T->status == TERMINAL)
+        memcpy(out, terminal + (size_t)T->id * words, words * sizeof(uint64_t));
+    else if (T->status == CONSTANT)
+        memcpy(out, constant + (size_t)T->id * words, words * sizeof(uint64_t));
+    else if (T->status == NEW_TERMINAL)
+    {
+        if (T->bval)
+            memcpy(out, T->bval, words * sizeof(uint64_t));
+        else
+            PackBinary(T->val, s->n, out);
+    }
+    else
+    {
+        op = getFUNCTIONid(T->elem);
+        if (op == _NOT_)
+        {
+            RunBinaryTree(s, T->left ? T->left : T->right, terminal, constant, out);
+            for (j = 0; j < words; j++)
+                out[j] = ~out[j];
+            out[words - 1] &= BinaryTailMask(s->n);
+            return;
+        }
+
+        RunBinaryTree(s, T->left, terminal, constant, out);
+        y = (uint64_t *)malloc(words * sizeof(uint64_t));
+        RunBinaryTree(s, T->right, terminal, constant, y);
+        switch (op)
+        {
+        case _AND_:
+            for (j = 0; j < words; j++)
+                out[j] &= y[j];
+            break;
+        case _OR_:
+            for (j = 0; j < words; j++)
+                out[j] |= y[j];
+            break;
+        case _XOR_:
+            for (j = 0; j < words; j++)
+                out[j] ^= y[j];
+            break;
+        default:
+            fprintf(stderr, "\nFunction %s is not boolean @RunBinaryTree.\n", T->elem);
+            exit(-1);
+            break;
+        }
+        free(y);
+    }
+}
+
+/* It runs a boolean linear tree over bit-packed terminals and constants. As in RunLinearTree, the nodes are visited backwards,
+so the arguments of each function node are on the top of a stack when it is reached.
+Parameters:
+s: search space
+T: linear tree
+terminal: bit-packed terminals (n_terminals x getBinaryWords(s->n)), in the order of s->a
+constant: bit-packed constants (n_constants x getBinaryWords(s->n))
+out: output bit-packed array
+stack: working memory with room for T->size outputs (it is allocated here if NULL) */
+void RunBinaryLinearTree(SearchSpace *s, LinearTree *T, uint64_t *terminal, uint64_t *constant, uint64_t *out, uint64_t *stack)
+{
+    int i, j, words, sp = 0;
+    uint64_t *x = NULL, *y = NULL, *buffer = stack;
+    const LinearNode *node = NULL;
+
+    if (!s || !T || !T->size || !out)
+    {
+        fprintf(stderr, "\nInvalid input parameters @RunBinaryLinearTree.\n");
+        exit(-1);
+    }
+
+    words = getBinaryWords(s->n);
+    if (!buffer)
+        buffer = (uint64_t *)malloc((size_t)T->size * words * sizeof(uint64_t));
+
+    for (i = T->size - 1; i >= 0; i--)
+    {
+        node = &T->node[i];
+        if (node->status == FUNCTION)
+        {
+            x = buffer + (size_t)(sp - 1) * words; /* first argument */
+            if (node->op == _NOT_)
+            {
+                for (j = 0; j < words; j++)
+                    x[j] = ~x[j];
+                x[words - 1] &= BinaryTailMask(s->n);
+                continue;
+            }
+
+            y = x - words; /* second argument, which is replaced by the output */
+            sp--;
+            switch (node->op)
+            {
+            case _AND_:
+                for (j = 0; j < words; j++)
+                    y[j] &= x[j];
+                break;
+            case _OR_:
+                for (j = 0; j < words; j++)
+                    y[j] |= x[j];
+                break;
+            case _XOR_:
+                for (j = 0; j < words; j++)
+                    y[j] ^= x[j];
+                break;
+            default:
+                fprintf(stderr, "\nNon-boolean function @RunBinaryLinearTree.\n");
+                exit(-1);
+                break;
+            }
+        }
+        else
+        { /* terminal and constant nodes are pushed onto the stack */
+            x = buffer + (size_t)sp * words;
+            sp++;
+            if (node->status == CONSTANT)
+                memcpy(x, constant + (size_t)node->id * words, words * sizeof(uint64_t));
+            else
+                memcpy(x, terminal + (size_t)node->id * words, words * sizeof(uint64_t));
+        }
+    }
+
+    memcpy(out, buffer, words * sizeof(uint64_t));
+
+    if (!stack)
+        free(buffer);
+}
+/**************************/
+
+/* Tree-related functions */
+/* It creates a tree node
+Parameters:
+value: content of the node
+node_id: identifier of the node id, i.e. its position in the array of terminals, functions or constants
+status: TERMINAL|FUNCTION|CONSTANT|NEW_TERMINAL
+n_decision_variables: only when status = NEW_TERMINAL */
+Node *CreateNode(char *value, int node_id, char status, ...)
+{
+    Node *tmp = NULL;
+    tmp = (Node *)malloc(sizeof(Node));
+    va_list arg;
+    int n_decision_variables;
+
+    if (!value)
+    {
+        fprintf(stderr, "\nInvalid input @CreateNode.\n");
+        return NULL;
+    }
+
+    tmp->id = node_id;
+    tmp->left = tmp->right = tmp->parent = NULL;
+    tmp->status = status;
+    tmp->left_son = 1; /* by default, every node is a left node */
+    tmp->elem = (char *)malloc((strlen(value) + 1) * sizeof(char));
+    strcpy(tmp->elem, value);
+
+    tmp->val = NULL;
+    tmp->bval = NULL;
+    tmp->n = 0;
+    if (status == NEW_TERMINAL)
+    {
+        va_start(arg, status);
+        n_decision_variables = va_arg(arg, int);
+        va_end(arg);
+        tmp->n = n_decision_variables;
+        tmp->val = (double *)malloc(n_decision_variables * sizeof(double));
+    }
+
+    return tmp;
+}
+
+/* It creates a random tree based on the GROW algorithm described in "Two Fast Tree-Creation Algorithms for Genetic Programming", S. Lukw, IEEE Transactions on Evolutionary Computation, 2000.
+Parameters:
+s: search space
+dmin: minimum depth
+dmax: maximum depth */
+Node *GROW(SearchSpace *s, int min_depth, int max_depth)
+{
+    int i, aux, const_id;
+    Node *tmp = NULL, *node = NULL;
+
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @GROW.\n");
+        return NULL;
+    }
+
+    if (min_depth == max_depth)
+    {
+        aux = round(GenerateUniformRandomNumber(0, s->n_terminals - 1));
+        if (!strcmp(s->terminal[aux], "CONST"))
+        {
+            const_id = round(GenerateUniformRandomNumber(0, s->n_constants - 1));
+            return CreateNode(s->terminal[aux], const_id, CONSTANT);
+        }
+        return CreateNode(s->terminal[aux], aux, TERMINAL);
+    }
+    else
+    {
+        aux = round(GenerateUniformRandomNumber(0, s->n_functions + s->n_terminals - 1));
+        if (aux >= s->n_functions)
+        { /* If aux is a terminal node */
+            aux = aux - s->n_functions;
+            if (!strcmp(s->terminal[aux], "CONST"))
+            {
+                const_id = round(GenerateUniformRandomNumber(0, s->n_constants - 1));
+                tmp = CreateNode(s->terminal[aux], const_id, CONSTANT);
+            }
+            else
+                tmp = CreateNode(s->terminal[aux], aux, TERMINAL);
+            return tmp;
+        }
+        else
+        { /* The new node is function one */
+            node = CreateNode(s->function[aux], aux, FUNCTION);
+            for (i = 0; i < N_ARGS_FUNCTION[getFUNCTIONid(s->function[aux])]; i++)
+            {
+                tmp = GROW(s, min_depth + 1, max_depth);
+                if (!i)
+                    node->left = tmp;
+                else
+                {
+                    node->right = tmp;
+                    tmp->left_son = 0;
+                }
+                tmp->parent = node;
+            }
+            return node;
+        }
+    }
+}
+
+/* It deallocates a tree
+Parameters:
+T: pointer to the tree */
+void DestroyTree(Node **T)
+{
+    if (*T)
+    {
+        DestroyTree(&(*T)->left);
+        DestroyTree(&(*T)->right);
+        free((*T)->elem);
+        if ((*T)->val)
+            free((*T)->val);
+        if ((*T)->bval)
+            free((*T)->bval);
+        free(*T);
+        *T = NULL;
+    }
+}
+
+/* It stores a tree in a text file (prefix mode)
+Parameters:
+s: search space
+T: pointer to the tree
+fileName: output file name */
+void PrintTree2File(SearchSpace *s, Node *T, char *fileName)
+{
+    FILE *fp = NULL;
+
+    if (!T)
+    {
+        fprintf(stderr, "\nTree not allocated @PrintTree2File.\n");
+        exit(-1);
+    }
+
+    fp = fopen(fileName, "a");
+    PreFixPrintTree4File(s, T, fp);
+    fprintf(fp, "\n");
+    fclose(fp);
+}
+
+/* It performs a prefix search in tree and saves the nodes in a text file
+Parameters:
+s: search space
+T: pointer to the tree
+fileName: output file name */
+void PreFixPrintTree4File(SearchSpace *s, Node *T, FILE *fp)
+{
+    int j;
+    if (T)
+    {
+        if (T->status != TERMINAL)
+            fprintf(fp, "(");
+        if (T->status == CONSTANT)
+        {
+            for (j = 0; j < s->n - 1; j++)
+                fprintf(fp, "%lf,", s->constant[j][T->id]);
+            fprintf(fp, "%lf", s->constant[j][T->id]);
+        }
+        else
+            fprintf(fp, "%s ", T->elem);
+        PreFixPrintTree4File(s, T->left, fp);
+        PreFixPrintTree4File(s, T->right, fp);
+        if (T->status != TERMINAL)
+            fprintf(fp, ")");
+    }
+}
+
+/* It runs a given tree and outputs its solution array
+Parameters:
+s: search space
+T: current tree */
+double *RunTree(SearchSpace *s, Node *T)
+{
+    double *x = NULL, *y = NULL, *out = NULL;
+    int i;
+
+    if (T)
+    {
+        x = RunTree(s, T->left);  /* It runs over the subtree on the left */
+        y = RunTree(s, T->right); /* It runs over the subtree on the right */
+
+        if (T->status == TERMINAL || T->status == CONSTANT || T->status == NEW_TERMINAL)
+        {
+            out = (double *)calloc(s->n, sizeof(double));
+            if (T->status == CONSTANT)
+            {
+                for (i = 0; i < s->n; i++)
+                    out[i] = s->constant[i][T->id];
+            }
+            else
+            {
+                if (T->status == NEW_TERMINAL)
+                {
+                    for (i = 0; i < s->n; i++)
+                        out[i] = T->val ? T->val[i] : GetBinaryBit(T->bval, i);
+                }
+                else
+                {
+                    for (i = 0; i < s->n; i++)
+                        out[i] = s->a[T->id]->x[i];
+                }
+            }
+            return out;
+        }
+        else
+        {
+            if (!strcmp(T->elem, "SUM"))
+                out = f_SUM_(x, y, s->n);
+            else if (!strcmp(T->elem, "SUB"))
+                out = f_SUB_(x, y, s->n);
+            else if (!strcmp(T->elem, "MUL"))
+                out = f_MUL_(x, y, s->n);
+            else if (!strcmp(T->elem, "DIV"))
+                out = f_DIV_(x, y, s->n);
+            else if (!strcmp(T->elem, "EXP"))
+            {
+                if (x)
+                    out = f_EXP_(x, s->n);
+                else
+                    out = f_EXP_(y, s->n);
+            }
+            else if (!strcmp(T->elem, "SQRT"))
+            {
+                if (x)
+                    out = f_SQRT_(x, s->n);
+                else
+                    out = f_SQRT_(y, s->n);
+            }
+            else if (!strcmp(T->elem, "LOG"))
+            {
+                if (x)
+                    out = f_LOG_(x, s->n);
+                else
+                    out = f_LOG_(y, s->n);
+            }
+            else if (!strcmp(T->elem, "AND"))
+                out = f_AND_(x, y, s->n);
+            else if (!strcmp(T->elem, "OR"))
+                out = f_OR_(x, y, s->n);
+            else if (!strcmp(T->elem, "XOR"))
+                out = f_XOR_(x, y, s->n);
+            else if (!strcmp(T->elem, "NOT"))
+            {
+                if (x)
+                    out = f_NOT_(x, s->n);
+                else
+                    out = f_NOT_(y, s->n);
+            }
+            /* it deallocates the sons of the current one, since they have been used already */
+            if (x)
+                free(x);
+            if (y)
+                free(y);
+            return out;
+        }
+    }
+    else
+        return NULL;
+}
+
+/* It copies the semantics of a NEW_TERMINAL node, which are either real-valued or bit-packed
+Parameters:
+dst: node created by CreateNode with the same status and number of decision variables
+src: node to be copied */
+static void CopyNodeValues(Node *dst, Node *src)
+{
+    if (src->val)
+        memcpy(dst->val, src->val, src->n * sizeof(double));
+    else
+    {
+        free(dst->val);
+        dst->val = NULL;
+    }
+
+    if (src->bval)
+    {
+        dst->bval = (uint64_t *)malloc(getBinaryWords(src->n) * sizeof(uint64_t));
+        memcpy(dst->bval, src->bval, getBinaryWords(src->n) * sizeof(uint64_t));
+    }
+}
+
+/* It copies a given tree
+Parameters:
+T: tree */
+Node *CopyTree(Node *T)
+{
+    Node *root = NULL;
+
+    if (!T)
+    {
+        fprintf(stderr, "\nThere is no tree allocated @CopyTree.\n");
+        return NULL;
+    }
+    else
+    {
+        root = CreateNode(T->elem, T->id, T->status, T->n);
+        if (T->status == NEW_TERMINAL)
+            CopyNodeValues(root, T);
+        root->left_son = T->left_son;
+        PreFixTravel4Copy(T->left, root);
+        PreFixTravel4Copy(T->right, root);
+
+        return root;
+    }
+}
+
+/* It performs a prefix travel on a tree
+Parameters:
+T: pointer to the subtree on the left
+Parent: pointer to the subtree on the right */
+void PreFixTravel4Copy(Node *T, Node *Parent)
+{
+    Node *aux = NULL;
+    if (T)
+    {
+        aux = CreateNode(T->elem, T->id, T->status, T->n);
+        if (T->status == NEW_TERMINAL)
+            CopyNodeValues(aux, T);
+        aux->left_son = T->left_son;
+        aux->left = NULL;
+        aux->right = NULL;
+        if (T->left_son)
+            Parent->left = aux;
+        else
+            Parent->right = aux;
+        aux->parent = Parent;
+
+        PreFixTravel4Copy(T->left, aux);
+        PreFixTravel4Copy(T->right, aux);
+    }
+}
+
+/* It returns the size of a tree (number of nodes)
+Parameters:
+T: pointer to the tree */
+int getSizeTree(Node *T)
+{
+    if (T)
+        return 1 + getSizeTree(T->left) + getSizeTree(T->right);
+    else
+        return 0;
+}
+
+/* It returns the depth of a tree, i.e., the number of nodes of its longest path from the root
+Parameters:
+T: pointer to the tree */
+int getTreeDepth(Node *T)
+{
+    int left, right;
+
+    if (!T)
+        return 0;
+
+    left = getTreeDepth(T->left);
+    right = getTreeDepth(T->right);
+
+    return 1 + ((left > right) ? left : right);
+}
+
+/* It checks whether a tree respects the depth and size limits of a search space (s->max_tree_depth and s->max_tree_size).
+Offspring that do not respect them are discarded by the GP engines, which bounds the evaluation cost and the memory of the population.
+Parameters:
+s: search space
+T: pointer to the tree */
+char IsTreeWithinLimits(SearchSpace *s, Node *T)
+{
+    if (!s || !T)
+    {
+        fprintf(stderr, "\nInvalid input parameters @IsTreeWithinLimits.\n");
+        return 0;
+    }
+
+    if ((s->max_tree_size > 0) && (getSizeTree(T) > s->max_tree_size))
+        return 0;
+
+    if ((s->max_tree_depth > 0) && (getTreeDepth(T) > s->max_tree_depth))
+        return 0;
+
+    return 1;
+}
+
+/* It performs the mutation of a tree T
+Paremeters:
+s: search space
+T: pointer to the node to be mutated
+p: probability of mutation at a function node */
+Node *Mutation(SearchSpace *s, Node *T, float p)
+{
+    if (!s || !T)
+    {
+        fprintf(stderr, "\nThere is no tree or search space allocated @Mutation.\n");
+        return NULL;
+    }
+
+    Node *NewTree = NULL, *tmp = NULL, *aux = NULL, *MutatedTree = NULL;
+    int mutation_point, size_tree = getSizeTree(T), ctr = 0;
+    double r;
+    char left_son;
+
+    MutatedTree = CopyTree(T);
+    mutation_point = round(GenerateUniformRandomNumber(2, size_tree)); /* Mutation point cannot be the root */
+
+    r = GenerateUniformRandomNumber(0, 1);
+    if (p > r)
+        NewTree = PreFixPositioningTree(MutatedTree, mutation_point, &left_son, FUNCTION, &ctr); /* the mutation point is a function node */
+    else
+        NewTree = PreFixPositioningTree(MutatedTree, mutation_point, &left_son, TERMINAL, &ctr); /* the mutation point is a terminal node */
+
+    /* if the mutation point's parent is not a root (this may happen when the mutation point is a function, \
+     and PreFixPositioningTree stops at a terminal node whose father is a root */
+    if (NewTree)
+    {
+        aux = GROW(s, s->min_depth, s->max_depth); /* It creates the new subtree */
+
+        /* It deletes the old subtree */
+        if (left_son)
+            tmp = NewTree->left;
+        else
+            tmp = NewTree->right;
+        DestroyTree(&tmp);
+
+        /* it connects the new subtree to the mutated tree */
+        if (left_son)
+        {
+            NewTree->left = aux;
+            aux->left_son = 1;
+        }
+        else
+        {
+            NewTree->right = aux;
+            aux->left_son = 0;
+        }
+        aux->parent = NewTree;
+    }
+    else
+    {
+        DestroyTree(&MutatedTree);
+        MutatedTree = GROW(s, s->min_depth, s->max_depth);
+    }
+
+    return MutatedTree;
+}
+
+/* It performs the crossover between father and mother trees
+Parameters:
+Father: pointer to the father tree
+Mother: pointer to the mother tree
+p: probability of mutation on a function node */
+Node **Crossover(Node *Father, Node *Mother, float p)
+{
+    Node **offspring = NULL, *aux_father = NULL, *aux_mother = NULL, *tmp = NULL;
+    int ctr = 0, crossover_point, size_tree;
+    double r;
+    char left_son_father, left_son_mother;
+
+    if (!Father || !Mother)
+    {
+        fprintf(stderr, "\nInvalid input data @Crossover.\n");
+        return NULL;
+    }
+
+    offspring = (Node **)malloc(2 * sizeof(Node *));
+
+    /* It generates the offsprings */
+    size_tree = getSizeTree(Father);
+    crossover_point = round(GenerateUniformRandomNumber(2, size_tree)); /* Crossover point cannot be the root */
+    offspring[0] = CopyTree(Father);
+    r = GenerateUniformRandomNumber(0, 1);
+    if (p >= r)
+        aux_father = PreFixPositioningTree(offspring[0], crossover_point, &left_son_father, FUNCTION, &ctr); /* the mutation point is a function node */
+    else
+        aux_father = PreFixPositioningTree(offspring[0], crossover_point, &left_son_father, TERMINAL, &ctr); /* the mutation point is a terminal node */
+
+    size_tree = getSizeTree(Mother);
+    crossover_point = round(GenerateUniformRandomNumber(2, size_tree)); /* Crossover point cannot be the root */
+    offspring[1] = CopyTree(Mother);
+    ctr = 0;
+    r = GenerateUniformRandomNumber(0, 1);
+    if (p >= r)
+        aux_mother = PreFixPositioningTree(offspring[1], crossover_point, &left_son_mother, FUNCTION, &ctr); /* the mutation point is a function node */
+    else
+        aux_mother = PreFixPositioningTree(offspring[1], crossover_point, &left_son_mother, TERMINAL, &ctr); /* the mutation point is a terminal node */
+
+    /* If the crossover points have been properly found */
+    if ((aux_father) && (aux_mother))
+    {
+        /* It performs the crossover for offspring #1 */
+        if (left_son_father)
+        {
+            tmp = aux_father->left;
+            if (left_son_mother)
+            {
+                aux_father->left = aux_mother->left;
+                (aux_mother->left)->left_son = 1;
+            }
+            else
+            {
+                aux_father->left = aux_mother->right;
+                (aux_mother->right)->left_son = 1;
+            }
+        }
+        else
+        {
+            tmp = aux_father->right;
+            if (left_son_mother)
+            {
+                aux_father->right = aux_mother->left;
+                (aux_mother->left)->left_son = 0;
+            }
+            else
+            {
+                aux_father->right = aux_mother->right;
+                (aux_mother->right)->left_son = 0;
+            }
+        }
+        aux_mother->parent = aux_father;
+
+        /* it performs the crossover for offspring #2 */
+        if (left_son_mother)
+        {
+            aux_mother->left = tmp;
+            tmp->left_son = 1;
+        }
+        else
+        {
+            aux_mother->right = tmp;
+            tmp->left_son = 0;
+        }
+        tmp->parent = aux_mother;
+    }
+
+    return offspring;
+}
+
+/* It returns the parent of the pos-th node using a prefix travel
+Parameters:
+T: pointer to the tree
+pos: position of the node to be retrieved
+left_son: flag to identify whether the pos-th node is a left-son or not
+status: status of the node (FUNCTION|TERMINAL)
+ctr: pointer to the integer used to count nodes through the previx travel */
+Node *PreFixPositioningTree(Node *T, int pos, char *left_son, int status, int *ctr)
+{
+    Node *Aux = NULL;
+
+    if (T)
+    {
+        (*ctr)++;
+        if (*ctr == pos)
+        {
+            *left_son = T->left_son;
+            *ctr = 0;
+
+            if (status == TERMINAL)
+                return T->parent;
+
+            /* If the node is a terminal and status = FUNCTION, thus the breakpoint will be its father (if this last is not a root),
+             which is certainly a function node */
+            else if ((T->parent)->parent)
+            {
+                *left_son = (T->parent)->left_son;
+                return (T->parent)->parent;
+            }
+            else
+                return NULL;
+        }
+        else
+        {
+            Aux = PreFixPositioningTree(T->left, pos, left_son, status, ctr);
+            if (Aux)
+                return Aux;
+            else
+            {
+                Aux = PreFixPositioningTree(T->right, pos, left_son, status, ctr);
+                if (Aux)
+                    return Aux;
+                else
+                    return NULL;
+            }
+        }
     }
+    else
+        return NULL;
 }
 
-/* It selects k elements based on the roulette selection method.
- * The output is an array with the indices of the selected elements.
+/* It performs the Geometric Semantic Genetic Programming crossover operator for boolean functions
 Parameters:
 s: search space
-k: number of elements to be selected */
-int *RouletteSelection(SearchSpace *s, int k)
+T1: pointer to the first tree
+T2: pointer to the second tree */
+Node *SGXB(SearchSpace *s, Node *T1_tmp, Node *T2_tmp)
 {
-    if (!s)
-    {
-        fprintf(stderr, "\nSearch space not allocated @RouletteSelection.\n");
-        return NULL;
-    }
+    Node *T3 = NULL, *TR = NULL, *TR_cpy = NULL, *LeftTree = NULL;
+    Node *RightTree = NULL, *T1 = NULL, *T2 = NULL, *NOT = NULL;
 
-    if (k < 1)
+    if (!s || !T1_tmp || !T2_tmp)
     {
-        fprintf(stderr, "\nInvalid input @RouletteSelection.\n");
+        fprintf(stderr, "\nInput error @SGXB.\n");
         return NULL;
     }
 
-    int *elem = NULL, i, j;
-    double sum, *accum = NULL, prob;
-    Data *D = NULL;
+    T1 = CopyTree(T1_tmp);
+    T2 = CopyTree(T2_tmp);
 
-    elem = (int *)malloc(k * sizeof(int));
-    D = (Data *)malloc(s->m * sizeof(Data));
+    /* It generates a random tree. It is expected a random tree with boolean functions if properly defined when creating the search space. */
+    TR = GROW(s, s->min_depth, s->max_depth);
+    TR_cpy = CopyTree(TR);
 
-    /* It normalizes the fitness of each agent ***/
-    sum = 0;
-    for (i = 0; i < s->m; i++)
+    T3 = CreateNode("OR", getFUNCTIONid("OR"), FUNCTION); /* It creates the root */
+    T3->parent = NULL;
+
+    LeftTree = CreateNode("AND", getFUNCTIONid("AND"), FUNCTION); /* It creates the tree on the left */
+    T3->left = LeftTree;
+    LeftTree->parent = T3;
+    LeftTree->left = T1;
+    T1->parent = LeftTree;
+    LeftTree->right = TR;
+    TR->parent = LeftTree;
+    TR->left_son = 0;
+
+    RightTree = CreateNode("AND", getFUNCTIONid("AND"), FUNCTION); /* It creates the tree on the right */
+    T3->right = RightTree;
+    RightTree->parent = T3;
+    RightTree->left_son = 0;
+    NOT = CreateNode("NOT", getFUNCTIONid("NOT"), FUNCTION);
+    RightTree->left = NOT;
+    NOT->parent = RightTree;
+    RightTree->right = T2;
+    T2->parent = RightTree;
+    T2->left_son = 0;
+    NOT->left = TR_cpy;
+    TR_cpy->parent = NOT;
+
+    return T3;
+}
+
+/* It performs the Geometric Semantic Genetic Programming mutation operator for boolean functions
+Parameters:
+s: search space
+T: pointer to the tree */
+Node *SGMB(SearchSpace *s, Node *T_tmp)
+{
+    Node *TM = NULL, *T = NULL, *M = NULL, *NOT = NULL;
+    double r;
+    int i;
+
+    if (!s || !T_tmp)
     {
-        D[i].id = i;
-        D[i].val = 1 / s->tree_fit[i];
-        sum += D[i].val;
+        fprintf(stderr, "\nInput error @SGMB.\n");
+        return NULL;
     }
-    for (i = 0; i < s->m; i++)
-        D[i].val /= sum;
 
-    /* It sorts the population by ascending values of fitness */
-    qsort(D, s->m, sizeof(Data), SortDataByVal);
+    r = randinter(0, 1);
+    T = CopyTree(T_tmp);
 
-    /* It computes the accumulate normalized fitness */
-    accum = (double *)calloc(s->m, sizeof(double));
-    for (i = 0; i < s->m; i++)
+    M = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
+    if (s->is_binary_opt)
+    { /* the minterm is kept bit-packed */
+        free(M->val);
+        M->val = NULL;
+        M->bval = (uint64_t *)malloc(getBinaryWords(s->n) * sizeof(uint64_t));
+        GenerateBinaryArray(M->bval, s->n, 0.5);
+    }
+    else
     {
-        for (j = i; j >= 0; j--)
-            accum[i] += D[j].val;
+        for (i = 0; i < s->n; i++)
+            M->val[i] = round(GenerateUniformRandomNumber(s->LB[0], s->UB[0])); /* Creating a random minterm */
     }
 
-    for (j = 0; j < k; j++)
+    if (r <= 0.5)
     {
-        /* It picks up the selected individual */
-        prob = GenerateUniformRandomNumber(0, 1);
-        i = 0;
-        while ((accum[i] < prob) && (i < s->m))
-            i++;
-        if (i)
-            elem[j] = D[i - 1].id;
-        else
-            elem[j] = D[i].id;
-        elem[j] = D[i].id;
+        TM = CreateNode("OR", getFUNCTIONid("OR"), FUNCTION);
+        TM->parent = NULL;
+        TM->left = T;
+        T->parent = TM;
+        TM->right = M;
+        M->parent = TM;
+        M->left_son = 0;
+    }
+    else
+    {
+        TM = CreateNode("AND", getFUNCTIONid("AND"), FUNCTION);
+        TM->parent = NULL;
+        TM->left = T;
+        T->parent = TM;
+        NOT = CreateNode("NOT", getFUNCTIONid("NOT"), FUNCTION);
+        TM->right = NOT;
+        NOT->parent = TM;
+        NOT->left_son = 0;
+        NOT->left = M;
+        M->parent = NOT;
     }
 
-    free(D);
-    free(accum);
-
-    return elem;
+    return TM;
 }
+/***********************/
 
-int *RouletteSelectionGA(SearchSpace *s, int k)
+/* It performs the Geometric Semantic Genetic Programming crossover operator for real-valued functions
+Parameters:
+s: search space
+T1: pointer to the first tree
+T2: pointer to the second tree */
+Node *SGXE(SearchSpace *s, Node *T1_tmp, Node *T2_tmp)
 {
-    if (!s)
-    {
-        fprintf(stderr, "\nSearch space not allocated @RouletteSelectionGA.\n");
-        return NULL;
-    }
+    Node *T3 = NULL, *TR = NULL, *LeftTree = NULL;
+    Node *RightTree = NULL, *T1 = NULL, *T2 = NULL, *NOT_TR = NULL;
+    int i;
 
-    if (k < 1)
+    if (!s || !T1_tmp || !T2_tmp)
     {
-        fprintf(stderr, "\nInvalid input @RouletteSelectionGA.\n");
+        fprintf(stderr, "\nInput error @SGXE.\n");
         return NULL;
     }
 
-    int *elem = NULL, i, j;
-    double min, sum, *accum = NULL, prob;
-    Data *D = NULL;
-
-    elem = (int *)malloc(k * sizeof(int));
-    D = (Data *)malloc(s->m * sizeof(Data));
-
-    /* It normalizes the fitness of each agent ***/
-    sum = 0;
-    min = DBL_MAX;
+    T1 = CopyTree(T1_tmp);
+    T2 = CopyTree(T2_tmp);
 
-    for(i = 0; i < s->m; i++)
-        min = s->a[i]->fit < min ? s->a[i]->fit : min;
+    /* It generates an array with random values within [0,1] */
+    TR = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
+    for (i = 0; i < s->n; i++)
+        TR->val[i] = GenerateUniformRandomNumber(0, 1); /* Creating an array composed of random numbers */
 
-    for (i = 0; i < s->m; i++) {
-        D[i].id = i;
-        D[i].val = s->a[i]->fit + min != 0 ? ((-2)*min) : 0;
-        D[i].val = 1 / D[i].val;
-        sum += D[i].val;
-    }
-    for (i = 0; i < s->m; i++)
-        D[i].val /= sum;
+    T3 = CreateNode("SUM", getFUNCTIONid("SUM"), FUNCTION); /* It creates the root */
+    T3->parent = NULL;
 
-    /* It sorts the population by ascending values of fitness */
-    qsort(D, s->m, sizeof(Data), SortDataByVal);
+    LeftTree = CreateNode("MUL", getFUNCTIONid("MUL"), FUNCTION); /* It creates the tree on the left */
+    T3->left = LeftTree;
+    LeftTree->parent = T3;
+    LeftTree->left = T1;
+    T1->parent = LeftTree;
+    LeftTree->right = TR;
+    TR->parent = LeftTree;
+    TR->left_son = 0;
 
-    /* It computes the accumulate normalized fitness */
-    accum = (double *)calloc(s->m, sizeof(double));
-    for (i = 0; i < s->m; i++)
-    {
-        for (j = i; j >= 0; j--)
-            accum[i] += D[j].val;
-    }
+    RightTree = CreateNode("MUL", getFUNCTIONid("MUL"), FUNCTION); /* It creates the tree on the right */
+    T3->right = RightTree;
+    RightTree->parent = T3;
+    RightTree->left_son = 0;
 
-    for (j = 0; j < k; j++)
-    {
-        /* It picks up the selected individual */
-        prob = GenerateUniformRandomNumber(0, 1);
-        i = 0;
-        while ((accum[i] < prob) && (i < s->m))
-            i++;
-        if (i)
-            elem[j] = D[i - 1].id;
-        else
-            elem[j] = D[i].id;
-        elem[j] = D[i].id;
-    }
+    NOT_TR = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
+    for (i = 0; i < s->n; i++)
+        NOT_TR->val[i] = 1 - TR->val[i]; /* Creating 1-TR */
 
-    free(D);
-    free(accum);
+    RightTree->left = NOT_TR;
+    NOT_TR->parent = RightTree;
+    RightTree->right = T2;
+    T2->parent = RightTree;
+    T2->left_son = 0;
 
-    return elem;
+    return T3;
 }
-/**************************/
 
-/* Tree-related functions */
-/* It creates a tree node
+/* It performs the Geometric Semantic Genetic Programming mutation operator for real-valued functions
 Parameters:
-value: content of the node
-node_id: identifier of the node id, i.e. its position in the array of terminals, functions or constants
-status: TERMINAL|FUNCTION|CONSTANT|NEW_TERMINAL
-n_decision_variables: only when status = NEW_TERMINAL */
-Node *CreateNode(char *value, int node_id, char status, ...)
+s: search space
+T1: pointer to the first tree
+T2: pointer to the second tree */
+Node *SGME(SearchSpace *s, Node *T1_tmp, Node *T2_tmp)
 {
-    Node *tmp = NULL;
-    tmp = (Node *)malloc(sizeof(Node));
-    va_list arg;
-    int n_decision_variables;
+    Node *T3 = NULL, *TR = NULL, *LeftTree = NULL;
+    Node *RightTree = NULL, *T1 = NULL, *T2 = NULL, *NOT_TR = NULL;
+    int i, j;
 
-    if (!value)
+    if (!s || !T1_tmp || !T2_tmp)
     {
-        fprintf(stderr, "\nInvalid input @CreateNode.\n");
+        fprintf(stderr, "\nInput error @SGME.\n");
         return NULL;
     }
 
-    va_start(arg, status);
-    n_decision_variables = va_arg(arg, int);
+    T1 = CopyTree(T1_tmp);
+    T2 = CopyTree(T2_tmp);
 
-    tmp->id = node_id;
-    tmp->left = tmp->right = tmp->parent = NULL;
-    tmp->status = status;
-    tmp->left_son = 1; /* by default, every node is a left node */
-    tmp->elem = (char *)malloc((strlen(value) + 1) * sizeof(char));
-    strcpy(tmp->elem, value);
+    /* It generates an array with random values within [0,1] */
+    TR = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
+    for (i = 0; i < s->n; i++)
+        TR->val[i] = GenerateUniformRandomNumber(0, 1); /* Creating an array composed of random numbers */
 
-    tmp->val = NULL;
-    if (status == NEW_TERMINAL)
-        tmp->val = (double *)malloc(n_decision_variables * sizeof(double));
+    /* Now we choose a random number within [0,2] in order to pick some
+    function bounded within [0,1] at random */
+    j = round(GenerateUniformRandomNumber(0, 2));
+    switch (j)
+    {
+    case 0:
+        for (i = 0; i < s->n; i++)
+            TR->val[i] = exp(TR->val[i]);
+        break;
+    case 1:
+        for (i = 0; i < s->n; i++)
+            TR->val[i] = fabs(sin(TR->val[i]));
+        break;
+    case 2:
+        for (i = 0; i < s->n; i++)
+            TR->val[i] = cos(sin(TR->val[i]));
+        break;
+    }
 
-    va_end(arg);
+    T3 = CreateNode("SUM", getFUNCTIONid("SUM"), FUNCTION); /* It creates the root */
+    T3->parent = NULL;
 
-    return tmp;
+    LeftTree = CreateNode("MUL", getFUNCTIONid("MUL"), FUNCTION); /* It creates the tree on the left */
+    T3->left = LeftTree;
+    LeftTree->parent = T3;
+    LeftTree->left = T1;
+    T1->parent = LeftTree;
+    LeftTree->right = TR;
+    TR->parent = LeftTree;
+    TR->left_son = 0;
+
+    RightTree = CreateNode("MUL", getFUNCTIONid("MUL"), FUNCTION); /* It creates the tree on the right */
+    T3->right = RightTree;
+    RightTree->parent = T3;
+    RightTree->left_son = 0;
+
+    NOT_TR = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
+    for (i = 0; i < s->n; i++)
+        NOT_TR->val[i] = 1 - TR->val[i]; /* Creating 1-TR */
+
+    RightTree->left = NOT_TR;
+    NOT_TR->parent = RightTree;
+    RightTree->right = T2;
+    T2->parent = RightTree;
+    T2->left_son = 0;
+
+    return T3;
 }
+/***********************/
 
-/* It creates a random tree based on the GROW algorithm described in "Two Fast Tree-Creation Algorithms for Genetic Programming", S. Lukw, IEEE Transactions on Evolutionary Computation, 2000.
+/* Linear tree-related functions */
+/* It creates an empty linear tree
 Parameters:
-s: search space
-dmin: minimum depth
-dmax: maximum depth */
-Node *GROW(SearchSpace *s, int min_depth, int max_depth)
+capacity: initial number of allocated nodes (the tree grows on demand) */
+LinearTree *CreateLinearTree(int capacity)
 {
-    int i, aux, const_id;
-    Node *tmp = NULL, *node = NULL;
+    LinearTree *T = NULL;
 
-    if (!s)
-    {
-        fprintf(stderr, "\nSearch space not allocated @GROW.\n");
-        return NULL;
-    }
+    if (capacity < 1)
+        capacity = 1;
 
-    if (min_depth == max_depth)
-    {
-        aux = round(GenerateUniformRandomNumber(0, s->n_terminals - 1));
-        if (!strcmp(s->terminal[aux], "CONST"))
-        {
-            const_id = round(GenerateUniformRandomNumber(0, s->n_constants - 1));
-            return CreateNode(s->terminal[aux], const_id, CONSTANT);
-        }
-        return CreateNode(s->terminal[aux], aux, TERMINAL);
-    }
-    else
-    {
-        aux = round(GenerateUniformRandomNumber(0, s->n_functions + s->n_terminals - 1));
-        if (aux >= s->n_functions)
-        { /* If aux is a terminal node */
-            aux = aux - s->n_functions;
-            if (!strcmp(s->terminal[aux], "CONST"))
-            {
-                const_id = round(GenerateUniformRandomNumber(0, s->n_constants - 1));
-                tmp = CreateNode(s->terminal[aux], const_id, CONSTANT);
-            }
-            else
-                tmp = CreateNode(s->terminal[aux], aux, TERMINAL);
-            return tmp;
-        }
-        else
-        { /* The new node is function one */
-            node = CreateNode(s->function[aux], aux, FUNCTION);
-            for (i = 0; i < N_ARGS_FUNCTION[getFUNCTIONid(s->function[aux])]; i++)
-            {
-                tmp = GROW(s, min_depth + 1, max_depth);
-                if (!i)
-                    node->left = tmp;
-                else
-                {
-                    node->right = tmp;
-                    tmp->left_son = 0;
-                }
-                tmp->parent = node;
-            }
-            return node;
-        }
-    }
+    T = (LinearTree *)malloc(sizeof(LinearTree));
+    T->size = 0;
+    T->capacity = capacity;
+    T->node = (LinearNode *)malloc(capacity * sizeof(LinearNode));
+
+    return T;
 }
 
-/* It deallocates a tree
+/* It deallocates a linear tree
 Parameters:
-T: pointer to the tree */
-void DestroyTree(Node **T)
+T: address of the linear tree */
+void DestroyLinearTree(LinearTree **T)
 {
     if (*T)
     {
-        DestroyTree(&(*T)->left);
-        DestroyTree(&(*T)->right);
-        free((*T)->elem);
-        if ((*T)->status == NEW_TERMINAL)
-            free((*T)->val);
+        free((*T)->node);
         free(*T);
         *T = NULL;
     }
 }
 
-/* It stores a tree in a text file (prefix mode)
+/* It makes room for at least capacity nodes, keeping the current ones
 Parameters:
-s: search space
-T: pointer to the tree
-fileName: output file name */
-void PrintTree2File(SearchSpace *s, Node *T, char *fileName)
+T: linear tree
+capacity: required number of nodes */
+static void ReserveLinearTree(LinearTree *T, int capacity)
 {
-    FILE *fp = NULL;
-
-    if (!T)
-    {
-        fprintf(stderr, "\nTree not allocated @PrintTree2File.\n");
-        exit(-1);
-    }
+    if (capacity <= T->capacity)
+        return;
 
-    fp = fopen(fileName, "a");
-    PreFixPrintTree4File(s, T, fp);
-    fprintf(fp, "\n");
-    fclose(fp);
+    if (capacity < 2 * T->capacity) /* it grows geometrically, so the trees of a population stop reallocating after a few generations */
+        capacity = 2 * T->capacity;
+    T->node = (LinearNode *)realloc(T->node, capacity * sizeof(LinearNode));
+    T->capacity = capacity;
 }
 
-/* It performs a prefix search in tree and saves the nodes in a text file
+/* It copies a linear tree into another one
 Parameters:
-s: search space
-T: pointer to the tree
-fileName: output file name */
-void PreFixPrintTree4File(SearchSpace *s, Node *T, FILE *fp)
+dst: destination linear tree
+src: source linear tree */
+void CopyLinearTree(LinearTree *dst, LinearTree *src)
 {
-    int j;
-    if (T)
+    if (!dst || !src)
     {
-        if (T->status != TERMINAL)
-            fprintf(fp, "(");
-        if (T->status == CONSTANT)
-        {
-            for (j = 0; j < s->n - 1; j++)
-                fprintf(fp, "%lf,", s->constant[j][T->id]);
-            fprintf(fp, "%lf", s->constant[j][T->id]);
-        }
-        else
-            fprintf(fp, "%s ", T->elem);
-        PreFixPrintTree4File(s, T->left, fp);
-        PreFixPrintTree4File(s, T->right, fp);
-        if (T->status != TERMINAL)
-            fprintf(fp, ")");
+        fprintf(stderr, "\nInvalid input parameters @CopyLinearTree.\n");
+        exit(-1);
     }
+
+    ReserveLinearTree(dst, src->size);
+    memcpy(dst->node, src->node, src->size * sizeof(LinearNode));
+    dst->size = src->size;
 }
 
-/* It runs a given tree and outputs its solution array
+/* It appends a random subtree to a linear tree. It draws the same random numbers as GROW does.
 Parameters:
 s: search space
-T: current tree */
-double *RunTree(SearchSpace *s, Node *T)
+T: linear tree
+parent: position of the parent of the new subtree (-1 for the root)
+min_depth: minimum depth
+max_depth: maximum depth */
+static void GrowLinearSubtree(SearchSpace *s, LinearTree *T, int parent, int min_depth, int max_depth)
 {
-    double *x = NULL, *y = NULL, *out = NULL;
-    int i;
+    int i, aux, pos = T->size;
 
-    if (T)
-    {
-        x = RunTree(s, T->left);  /* It runs over the subtree on the left */
-        y = RunTree(s, T->right); /* It runs over the subtree on the right */
+    ReserveLinearTree(T, pos + 1);
+    T->size++;
+    T->node[pos].parent = parent;
+    T->node[pos].op = -1;
 
-        if (T->status == TERMINAL || T->status == CONSTANT || T->status == NEW_TERMINAL)
+    if (min_depth == max_depth)
+        aux = s->n_functions + round(GenerateUniformRandomNumber(0, s->n_terminals - 1)); /* only terminal nodes are allowed */
+    else
+        aux = round(GenerateUniformRandomNumber(0, s->n_functions + s->n_terminals - 1));
+
+    if (aux >= s->n_functions)
+    { /* If aux is a terminal node */
+        aux = aux - s->n_functions;
+        if (!strcmp(s->terminal[aux], "CONST"))
         {
-            out = (double *)calloc(s->n, sizeof(double));
-            if (T->status == CONSTANT)
-            {
-                for (i = 0; i < s->n; i++)
-                    out[i] = s->constant[i][T->id];
-            }
-            else
-            {
-                if (T->status == NEW_TERMINAL)
-                {
-                    for (i = 0; i < s->n; i++)
-                        out[i] = T->val[i];
-                }
-                else
-                {
-                    for (i = 0; i < s->n; i++)
-                        out[i] = s->a[T->id]->x[i];
-                }
-            }
-            return out;
+            T->node[pos].status = CONSTANT;
+            T->node[pos].id = round(GenerateUniformRandomNumber(0, s->n_constants - 1));
         }
         else
         {
-            if (!strcmp(T->elem, "SUM"))
-                out = f_SUM_(x, y, s->n);
-            else if (!strcmp(T->elem, "SUB"))
-                out = f_SUB_(x, y, s->n);
-            else if (!strcmp(T->elem, "MUL"))
-                out = f_MUL_(x, y, s->n);
-            else if (!strcmp(T->elem, "DIV"))
-                out = f_DIV_(x, y, s->n);
-            else if (!strcmp(T->elem, "EXP"))
-            {
-                if (x)
-                    out = f_EXP_(x, s->n);
-                else
-                    out = f_EXP_(y, s->n);
-            }
-            else if (!strcmp(T->elem, "SQRT"))
-            {
-                if (x)
-                    out = f_SQRT_(x, s->n);
-                else
-                    out = f_SQRT_(y, s->n);
-            }
-            else if (!strcmp(T->elem, "LOG"))
-            {
-                if (x)
-                    out = f_LOG_(x, s->n);
-                else
-                    out = f_LOG_(y, s->n);
-            }
-            else if (!strcmp(T->elem, "AND"))
-                out = f_AND_(x, y, s->n);
-            else if (!strcmp(T->elem, "OR"))
-                out = f_OR_(x, y, s->n);
-            else if (!strcmp(T->elem, "XOR"))
-                out = f_XOR_(x, y, s->n);
-            else if (!strcmp(T->elem, "NOT"))
-            {
-                if (x)
-                    out = f_NOT_(x, s->n);
-                else
-                    out = f_NOT_(y, s->n);
-            }
-            /* it deallocates the sons of the current one, since they have been used already */
-            if (x)
-                free(x);
-            if (y)
-                free(y);
-            return out;
+            T->node[pos].status = TERMINAL;
+            T->node[pos].id = aux;
         }
     }
-    else
-        return NULL;
+    else
+    { /* The new node is function one */
+        T->node[pos].status = FUNCTION;
+        T->node[pos].id = aux;
+        T->node[pos].op = getFUNCTIONid(s->function[aux]);
+        for (i = 0; i < N_ARGS_FUNCTION[T->node[pos].op]; i++)
+            GrowLinearSubtree(s, T, pos, min_depth + 1, max_depth);
+    }
+
+    T->node[pos].size = T->size - pos;
+}
+
+/* It creates a random linear tree based on the GROW algorithm (see GROW). The previous content of the tree is discarded.
+Parameters:
+s: search space
+T: linear tree
+min_depth: minimum depth
+max_depth: maximum depth */
+void GrowLinearTree(SearchSpace *s, LinearTree *T, int min_depth, int max_depth)
+{
+    if (!s || !T)
+    {
+        fprintf(stderr, "\nSearch space and/or linear tree not allocated @GrowLinearTree.\n");
+        exit(-1);
+    }
+
+    T->size = 0;
+    GrowLinearSubtree(s, T, -1, min_depth, max_depth);
 }
 
-/* It copies a given tree
+/* It appends a tree to a linear tree using a prefix travel
 Parameters:
-T: tree */
-Node *CopyTree(Node *T)
+T: pointer to the tree
+L: linear tree
+parent: position of the parent of the tree (-1 for the root) */
+static void PreFixTravel4Linear(Node *T, LinearTree *L, int parent)
 {
-    Node *root = NULL;
+    int pos = L->size;
 
-    if (!T)
+    if (T->status == NEW_TERMINAL)
     {
-        fprintf(stderr, "\nThere is no tree allocated @CopyTree.\n");
-        return NULL;
+        fprintf(stderr, "\nGeometric semantic nodes cannot be stored in a linear tree @Tree2LinearTree.\n");
+        exit(-1);
     }
-    else
-    {
-        root = CreateNode(T->elem, T->id, T->status);
-        root->left_son = T->left_son;
-        PreFixTravel4Copy(T->left, root);
-        PreFixTravel4Copy(T->right, root);
 
-        return root;
-    }
+    ReserveLinearTree(L, pos + 1);
+    L->size++;
+    L->node[pos].status = T->status;
+    L->node[pos].id = T->id;
+    L->node[pos].op = (T->status == FUNCTION) ? getFUNCTIONid(T->elem) : -1;
+    L->node[pos].parent = parent;
+
+    if (T->left)
+        PreFixTravel4Linear(T->left, L, pos);
+    if (T->right)
+        PreFixTravel4Linear(T->right, L, pos);
+
+    L->node[pos].size = L->size - pos;
 }
 
-/* It performs a prefix travel on a tree
+/* It converts a tree into a linear tree
 Parameters:
-T: pointer to the subtree on the left
-Parent: pointer to the subtree on the right */
-void PreFixTravel4Copy(Node *T, Node *Parent)
+T: pointer to the tree
+L: linear tree (its previous content is discarded) */
+void Tree2LinearTree(Node *T, LinearTree *L)
 {
-    Node *aux = NULL;
-    if (T)
+    if (!T || !L)
     {
-        aux = CreateNode(T->elem, T->id, T->status);
-        aux->left_son = T->left_son;
-        aux->left = NULL;
-        aux->right = NULL;
-        if (T->left_son)
-            Parent->left = aux;
-        else
-            Parent->right = aux;
-        aux->parent = Parent;
-
-        PreFixTravel4Copy(T->left, aux);
-        PreFixTravel4Copy(T->right, aux);
+        fprintf(stderr, "\nTree and/or linear tree not allocated @Tree2LinearTree.\n");
+        exit(-1);
     }
+
+    L->size = 0;
+    PreFixTravel4Linear(T, L, -1);
 }
 
-/* It returns the size of a tree (number of nodes)
+/* It converts the subtree rooted at a given node of a linear tree into a tree
 Parameters:
-T: pointer to the tree */
-int getSizeTree(Node *T)
+s: search space
+L: linear tree
+pos: position of the root of the subtree */
+static Node *LinearSubtree2Tree(SearchSpace *s, LinearTree *L, int pos)
 {
-    if (T)
-        return 1 + getSizeTree(T->left) + getSizeTree(T->right);
+    Node *T = NULL;
+    int child = pos + 1;
+
+    if (L->node[pos].status == FUNCTION)
+        T = CreateNode(s->function[L->node[pos].id], L->node[pos].id, FUNCTION);
+    else if (L->node[pos].status == CONSTANT)
+        T = CreateNode("CONST", L->node[pos].id, CONSTANT);
     else
-        return 0;
+        T = CreateNode(s->terminal[L->node[pos].id], L->node[pos].id, TERMINAL);
+
+    if (child < pos + L->node[pos].size)
+    { /* the first child is the subtree on the left */
+        T->left = LinearSubtree2Tree(s, L, child);
+        T->left->parent = T;
+        child += L->node[child].size;
+    }
+    if (child < pos + L->node[pos].size)
+    { /* the second child is the subtree on the right */
+        T->right = LinearSubtree2Tree(s, L, child);
+        T->right->parent = T;
+        T->right->left_son = 0;
+    }
+
+    return T;
 }
 
-/* It performs the mutation of a tree T
-Paremeters:
+/* It converts a linear tree into a tree, e.g., to be saved by PrintTree2File
+Parameters:
 s: search space
-T: pointer to the node to be mutated
-p: probability of mutation at a function node */
-Node *Mutation(SearchSpace *s, Node *T, float p)
+L: linear tree */
+Node *LinearTree2Tree(SearchSpace *s, LinearTree *L)
 {
-    if (!s || !T)
+    if (!s || !L || !L->size)
     {
-        fprintf(stderr, "\nThere is no tree or search space allocated @Mutation.\n");
+        fprintf(stderr, "\nSearch space and/or linear tree not allocated @LinearTree2Tree.\n");
         return NULL;
     }
 
-    Node *NewTree = NULL, *tmp = NULL, *aux = NULL, *MutatedTree = NULL;
-    int mutation_point, size_tree = getSizeTree(T), ctr = 0;
-    double r;
-    char left_son;
-
-    MutatedTree = CopyTree(T);
-    mutation_point = round(GenerateUniformRandomNumber(2, size_tree)); /* Mutation point cannot be the root */
+    return LinearSubtree2Tree(s, L, 0);
+}
 
-    r = GenerateUniformRandomNumber(0, 1);
-    if (p > r)
-        NewTree = PreFixPositioningTree(MutatedTree, mutation_point, &left_son, FUNCTION, &ctr); /* the mutation point is a function node */
-    else
-        NewTree = PreFixPositioningTree(MutatedTree, mutation_point, &left_son, TERMINAL, &ctr); /* the mutation point is a terminal node */
+/* It creates a subtree cache
+Parameters:
+budget: memory budget (in bytes)
+width: number of values of each output (s->n for GP, s->n * s->tensor_dim for TGP) */
+TreeCache *CreateTreeCache(long int budget, int width)
+{
+    TreeCache *cache = NULL;
+    int capacity;
 
-    /* if the mutation point's parent is not a root (this may happen when the mutation point is a function, \
-     and PreFixPositioningTree stops at a terminal node whose father is a root */
-    if (NewTree)
+    if (width < 1)
     {
-        aux = GROW(s, s->min_depth, s->max_depth); /* It creates the new subtree */
+        fprintf(stderr, "\nInvalid input parameters @CreateTreeCache.\n");
+        return NULL;
+    }
 
-        /* It deletes the old subtree */
-        if (left_son)
-            tmp = NewTree->left;
-        else
-            tmp = NewTree->right;
-        DestroyTree(&tmp);
+    /* every output takes its values plus four slots of the hash table, which also counts the subtrees that are not shared */
+    capacity = budget / (width * sizeof(double) + 4 * (4 * sizeof(int) + sizeof(unsigned long long) + sizeof(LinearNode *)));
+    if (capacity < 1)
+        return NULL;
 
-        /* it connects the new subtree to the mutated tree */
-        if (left_son)
-        {
-            NewTree->left = aux;
-            aux->left_son = 1;
-        }
-        else
+    cache = (TreeCache *)malloc(sizeof(TreeCache));
+    cache->budget = budget;
+    cache->capacity = capacity;
+    cache->size = 0;
+    cache->width = width;
+    for (cache->n_slots = 4; cache->n_slots < 4 * capacity; cache->n_slots *= 2)
+        ;
+    cache->used = 0;
+    cache->generation = 1;
+    cache->stamp = (int *)calloc(cache->n_slots, sizeof(int));
+    cache->key = (unsigned long long *)malloc(cache->n_slots * sizeof(unsigned long long));
+    cache->subtree = (int *)malloc(cache->n_slots * sizeof(int));
+    cache->origin = (const LinearNode **)malloc(cache->n_slots * sizeof(LinearNode *));
+    cache->count = (int *)malloc(cache->n_slots * sizeof(int));
+    cache->entry = (int *)malloc(cache->n_slots * sizeof(int));
+    cache->value = (double *)malloc((size_t)capacity * width * sizeof(double));
+    cache->scratch_size = 0;
+    cache->hash = NULL;
+    cache->slot = NULL;
+    cache->plan = NULL;
+    cache->hits = cache->misses = 0;
+
+    return cache;
+}
+
+/* It deallocates a subtree cache
+Parameters:
+cache: address of the subtree cache */
+void DestroyTreeCache(TreeCache **cache)
+{
+    if (*cache)
+    {
+        free((*cache)->stamp);
+        free((*cache)->key);
+        free((*cache)->subtree);
+        free((*cache)->origin);
+        free((*cache)->count);
+        free((*cache)->entry);
+        free((*cache)->value);
+        if ((*cache)->hash)
         {
-            NewTree->right = aux;
-            aux->left_son = 0;
+            free((*cache)->hash);
+            free((*cache)->slot);
+            free((*cache)->plan);
         }
-        aux->parent = NewTree;
+        free(*cache);
+        *cache = NULL;
     }
-    else
+}
+
+/* It discards all subtrees (counts and outputs) of a subtree cache in constant time, since the slots of older generations are
+considered empty
+Parameters:
+cache: subtree cache (nothing is done if it is NULL) */
+void ClearTreeCache(TreeCache *cache)
+{
+    if (!cache)
+        return;
+
+    cache->generation++;
+    cache->used = 0;
+    cache->size = 0;
+}
+
+/* It scrambles the bits of a 64-bit integer (finalizer of SplitMix64)
+Parameters:
+h: input value */
+static unsigned long long MixHash(unsigned long long h)
+{
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+
+    return h;
+}
+
+/* It computes the structural hash of every subtree of a linear tree and stores it in the working memory of a subtree cache.
+Nodes are visited backwards, so the hashes of the children are ready when their parent is reached.
+Parameters:
+cache: subtree cache
+T: linear tree */
+static void HashLinearTree(TreeCache *cache, LinearTree *T)
+{
+    int i, child;
+    unsigned long long *hash = NULL;
+    const LinearNode *node = NULL;
+
+    if (cache->scratch_size < T->size)
     {
-        DestroyTree(&MutatedTree);
-        MutatedTree = GROW(s, s->min_depth, s->max_depth);
+        cache->scratch_size = 2 * T->size;
+        cache->hash = (unsigned long long *)realloc(cache->hash, cache->scratch_size * sizeof(unsigned long long));
+        cache->slot = (int *)realloc(cache->slot, cache->scratch_size * sizeof(int));
+        cache->plan = (int *)realloc(cache->plan, cache->scratch_size * sizeof(int));
     }
 
-    return MutatedTree;
+    hash = cache->hash;
+    for (i = T->size - 1; i >= 0; i--)
+    {
+        node = &T->node[i];
+        hash[i] = MixHash(((unsigned long long)node->status << 32) ^ (unsigned int)((node->status == FUNCTION) ? node->op : node->id));
+        for (child = i + 1; child < i + node->size; child += T->node[child].size) /* the order of the children matters */
+            hash[i] = MixHash(hash[i] ^ hash[child]);
+    }
 }
 
-/* It performs the crossover between father and mother trees
+/* It checks whether two subtrees of linear trees are the same, node by node
 Parameters:
-Father: pointer to the father tree
-Mother: pointer to the mother tree
-p: probability of mutation on a function node */
-Node **Crossover(Node *Father, Node *Mother, float p)
+a: root of the first subtree
+b: root of the second subtree */
+static char SameSubtree(const LinearNode *a, const LinearNode *b)
 {
-    Node **offspring = NULL, *aux_father = NULL, *aux_mother = NULL, *tmp = NULL;
-    int ctr = 0, crossover_point, size_tree;
-    double r;
-    char left_son_father, left_son_mother;
+    int i;
 
-    if (!Father || !Mother)
+    for (i = 0; i < a->size; i++)
     {
-        fprintf(stderr, "\nInvalid input data @Crossover.\n");
-        return NULL;
+        if ((a[i].status != b[i].status) || (a[i].size != b[i].size))
+            return 0;
+        if ((a[i].status == FUNCTION) ? (a[i].op != b[i].op) : (a[i].id != b[i].id))
+            return 0;
     }
 
-    offspring = (Node **)malloc(2 * sizeof(Node *));
+    return 1;
+}
 
-    /* It generates the offsprings */
-    size_tree = getSizeTree(Father);
-    crossover_point = round(GenerateUniformRandomNumber(2, size_tree)); /* Crossover point cannot be the root */
-    offspring[0] = CopyTree(Father);
-    r = GenerateUniformRandomNumber(0, 1);
-    if (p >= r)
-        aux_father = PreFixPositioningTree(offspring[0], crossover_point, &left_son_father, FUNCTION, &ctr); /* the mutation point is a function node */
-    else
-        aux_father = PreFixPositioningTree(offspring[0], crossover_point, &left_son_father, TERMINAL, &ctr); /* the mutation point is a terminal node */
+/* It returns the slot of a subtree in a subtree cache, or -1 if it is not there
+Parameters:
+cache: subtree cache
+key: structural hash of the subtree
+root: root of the subtree within its linear tree
+insert: if 1, the subtree is added to the cache when it is not there (unless the hash table is half full) */
+static int FindTreeCache(TreeCache *cache, unsigned long long key, const LinearNode *root, char insert)
+{
+    int slot = key & (cache->n_slots - 1);
 
-    size_tree = getSizeTree(Mother);
-    crossover_point = round(GenerateUniformRandomNumber(2, size_tree)); /* Crossover point cannot be the root */
-    offspring[1] = CopyTree(Mother);
-    ctr = 0;
-    r = GenerateUniformRandomNumber(0, 1);
-    if (p >= r)
-        aux_mother = PreFixPositioningTree(offspring[1], crossover_point, &left_son_mother, FUNCTION, &ctr); /* the mutation point is a function node */
-    else
-        aux_mother = PreFixPositioningTree(offspring[1], crossover_point, &left_son_mother, TERMINAL, &ctr); /* the mutation point is a terminal node */
+    while (cache->stamp[slot] == cache->generation)
+    {
+        if ((cache->key[slot] == key) && (cache->subtree[slot] == root->size) && SameSubtree(cache->origin[slot], root))
+            return slot;
+        slot = (slot + 1) & (cache->n_slots - 1);
+    }
 
-    /* If the crossover points have been properly found */
-    if ((aux_father) && (aux_mother))
+    if (!insert || (2 * cache->used >= cache->n_slots))
+        return -1;
+
+    cache->stamp[slot] = cache->generation;
+    cache->key[slot] = key;
+    cache->subtree[slot] = root->size;
+    cache->origin[slot] = root;
+    cache->count[slot] = 0;
+    cache->entry[slot] = -1;
+    cache->used++;
+
+    return slot;
+}
+
+/* It counts the subtrees of a linear tree in a subtree cache. Only the subtrees counted more than once since the cache
+has been cleared are stored by RunLinearTree.
+Parameters:
+cache: subtree cache
+T: linear tree */
+void CensusTreeCache(TreeCache *cache, LinearTree *T)
+{
+    int i, slot;
+
+    if (!cache || !T)
+        return;
+
+    HashLinearTree(cache, T);
+    for (i = 0; i < T->size; i++)
+        if ((T->node[i].status == FUNCTION) && ((slot = FindTreeCache(cache, cache->hash[i], &T->node[i], 1)) >= 0))
+            cache->count[slot]++;
+}
+
+/* It runs a given linear tree and outputs its solution array. The nodes are visited backwards, so the arguments of each
+function node are on the top of a stack when it is reached (the first argument on the very top). If a subtree cache is given,
+the shared subtrees already computed are not visited, and the outputs of the other shared subtrees are stored in it (see CensusTreeCache).
+Parameters:
+s: search space
+opt_id: _GP_ or _TGP_ (in this case, the output is a (n x tensor_dim) tensor stored row by row)
+T: linear tree
+out: output array
+stack: working memory with room for T->size outputs (it is allocated here if NULL)
+cache: subtree cache (NULL if it is not used) */
+void RunLinearTree(SearchSpace *s, int opt_id, LinearTree *T, double *out, double *stack, TreeCache *cache)
+{
+    int i, j, k, p, w, e, n_plan, sp = 0;
+    double *x = NULL, *y = NULL, *buffer = stack;
+    const LinearNode *node = NULL;
+
+    if (!s || !T || !T->size || !out)
     {
-        /* It performs the crossover for offspring #1 */
-        if (left_son_father)
+        fprintf(stderr, "\nInvalid input parameters @RunLinearTree.\n");
+        exit(-1);
+    }
+
+    w = (opt_id == _TGP_) ? s->n * s->tensor_dim : s->n;
+    if (!buffer)
+        buffer = (double *)malloc(T->size * w * sizeof(double));
+
+    n_plan = T->size;
+    if (cache)
+    {
+        if (cache->width != w)
         {
-            tmp = aux_father->left;
-            if (left_son_mother)
-            {
-                aux_father->left = aux_mother->left;
-                (aux_mother->left)->left_son = 1;
-            }
-            else
-            {
-                aux_father->left = aux_mother->right;
-                (aux_mother->right)->left_son = 1;
-            }
+            fprintf(stderr, "\nThe subtree cache does not match the output size @RunLinearTree.\n");
+            exit(-1);
         }
-        else
+        HashLinearTree(cache, T);
+
+        /* It lists the nodes to be executed: a cached subtree is replaced by its output (stored as -(position + 1)) */
+        for (i = 0, n_plan = 0; i < T->size;)
         {
-            tmp = aux_father->right;
-            if (left_son_mother)
+            e = -1;
+            cache->slot[i] = -1;
+            if ((T->node[i].status == FUNCTION) && ((e = FindTreeCache(cache, cache->hash[i], &T->node[i], 0)) >= 0) && (cache->count[e] < 2))
+                e = -1; /* the subtree is not shared */
+
+            if ((e >= 0) && (cache->entry[e] >= 0))
             {
-                aux_father->right = aux_mother->left;
-                (aux_mother->left)->left_son = 0;
+                cache->plan[n_plan++] = -(cache->entry[e] + 1);
+                cache->hits++;
+                i += T->node[i].size;
             }
             else
             {
-                aux_father->right = aux_mother->right;
-                (aux_mother->right)->left_son = 0;
+                cache->slot[i] = e;
+                cache->plan[n_plan++] = i++;
             }
         }
-        aux_mother->parent = aux_father;
-
-        /* it performs the crossover for offspring #2 */
-        if (left_son_mother)
-        {
-            aux_mother->left = tmp;
-            tmp->left_son = 1;
-        }
-        else
-        {
-            aux_mother->right = tmp;
-            tmp->left_son = 0;
-        }
-        tmp->parent = aux_mother;
     }
 
-    return offspring;
-}
-
-/* It returns the parent of the pos-th node using a prefix travel
-Parameters:
-T: pointer to the tree
-pos: position of the node to be retrieved
-left_son: flag to identify whether the pos-th node is a left-son or not
-status: status of the node (FUNCTION|TERMINAL)
-ctr: pointer to the integer used to count nodes through the previx travel */
-Node *PreFixPositioningTree(Node *T, int pos, char *left_son, int status, int *ctr)
-{
-    Node *Aux = NULL;
-
-    if (T)
+    for (p = n_plan - 1; p >= 0; p--)
     {
-        (*ctr)++;
-        if (*ctr == pos)
-        {
-            *left_son = T->left_son;
-            *ctr = 0;
-
-            if (status == TERMINAL)
-                return T->parent;
-
-            /* If the node is a terminal and status = FUNCTION, thus the breakpoint will be its father (if this last is not a root),
-             which is certainly a function node */
-            else if ((T->parent)->parent)
+        i = cache ? cache->plan[p] : p;
+        if (i < 0)
+        { /* the output of a cached subtree is pushed onto the stack */
+            memcpy(buffer + sp * w, cache->value + (size_t)(-i - 1) * w, w * sizeof(double));
+            sp++;
+            continue;
+        }
+
+        node = &T->node[i];
+        if (node->status == FUNCTION)
+        {
+            x = buffer + (sp - 1) * w; /* first argument */
+            if (N_ARGS_FUNCTION[node->op] == 2)
             {
-                *left_son = (T->parent)->left_son;
-                return (T->parent)->parent;
+                y = x - w; /* second argument, which is replaced by the output */
+                sp--;
+                switch (node->op)
+                {
+                case _SUM_:
+                case _TSUM_:
+                    for (j = 0; j < w; j++)
+                        y[j] = x[j] + y[j];
+                    break;
+                case _SUB_:
+                case _TSUB_:
+                    for (j = 0; j < w; j++)
+                        y[j] = x[j] - y[j];
+                    break;
+                case _MUL_:
+                case _TMUL_:
+                    for (j = 0; j < w; j++)
+                        y[j] = x[j] * y[j];
+                    break;
+                case _DIV_:
+                    for (j = 0; j < w; j++)
+                        y[j] = x[j] / (y[j] + 0.00001); /* It avoids division by 0 */
+                    break;
+                case _TDIV_:
+                    for (j = 0; j < w; j++)
+                        y[j] = y[j] ? x[j] / y[j] : 0.0;
+                    break;
+                case _AND_:
+                    for (j = 0; j < w; j++)
+                        y[j] = (double)((int)x[j] & (int)y[j]);
+                    break;
+                case _OR_:
+                    for (j = 0; j < w; j++)
+                        y[j] = (double)((int)x[j] | (int)y[j]);
+                    break;
+                case _XOR_:
+                    for (j = 0; j < w; j++)
+                        y[j] = (double)((int)x[j] ^ (int)y[j]);
+                    break;
+                }
             }
             else
-                return NULL;
+            {
+                switch (node->op)
+                {
+                case _EXP_:
+                    for (j = 0; j < w; j++)
+                        x[j] = exp(x[j]);
+                    break;
+                case _SQRT_:
+                    for (j = 0; j < w; j++)
+                        x[j] = sqrt(fabs(x[j]));
+                    break;
+                case _LOG_:
+                    for (j = 0; j < w; j++)
+                        x[j] = log(x[j] + 0.00001);
+                    break;
+                case _ABS_:
+                    for (j = 0; j < w; j++)
+                        x[j] = fabs(x[j]);
+                    break;
+                case _NOT_:
+                    for (j = 0; j < w; j++)
+                        x[j] = (double)~(int)x[j];
+                    break;
+                }
+            }
+
+            if (cache && (cache->slot[i] >= 0) && (cache->size < cache->capacity))
+            { /* It stores the output of a shared subtree */
+                cache->entry[cache->slot[i]] = cache->size;
+                memcpy(cache->value + (size_t)cache->size * w, buffer + (sp - 1) * w, w * sizeof(double));
+                cache->size++;
+                cache->misses++;
+            }
         }
         else
-        {
-            Aux = PreFixPositioningTree(T->left, pos, left_son, status, ctr);
-            if (Aux)
-                return Aux;
-            else
+        { /* terminal and constant nodes are pushed onto the stack */
+            x = buffer + sp * w;
+            sp++;
+            if (opt_id == _TGP_)
             {
-                Aux = PreFixPositioningTree(T->right, pos, left_son, status, ctr);
-                if (Aux)
-                    return Aux;
-                else
-                    return NULL;
+                for (j = 0; j < s->n; j++)
+                    for (k = 0; k < s->tensor_dim; k++)
+                        x[j * s->tensor_dim + k] = (node->status == CONSTANT) ? s->t_constant[node->id][j][k] : s->a[node->id]->t[j][k];
+            }
+            else if (node->status == CONSTANT)
+            {
+                for (j = 0; j < s->n; j++)
+                    x[j] = s->constant[j][node->id];
             }
+            else
+                memcpy(x, s->a[node->id]->x, s->n * sizeof(double));
         }
     }
-    else
-        return NULL;
+
+    memcpy(out, buffer, w * sizeof(double));
+
+    if (!stack)
+        free(buffer);
 }
 
-/* It performs the Geometric Semantic Genetic Programming crossover operator for boolean functions
+/* It fixes a linear tree whose subtree at position cut has changed its size, i.e., it updates the sizes of the
+ancestors of cut and the parents of the nodes after the new subtree
 Parameters:
-s: search space
-T1: pointer to the first tree
-T2: pointer to the second tree */
-Node *SGXB(SearchSpace *s, Node *T1_tmp, Node *T2_tmp)
+T: linear tree
+cut: position of the new subtree
+delta: number of nodes of the new subtree minus the number of nodes of the old one */
+static void FixLinearTree(LinearTree *T, int cut, int delta)
 {
-    Node *T3 = NULL, *TR = NULL, *TR_cpy = NULL, *LeftTree = NULL;
-    Node *RightTree = NULL, *T1 = NULL, *T2 = NULL, *NOT = NULL;
+    int i;
 
-    if (!s || !T1_tmp || !T2_tmp)
-    {
-        fprintf(stderr, "\nInput error @SGXB.\n");
-        return NULL;
-    }
+    if (!delta)
+        return;
 
-    T1 = CopyTree(T1_tmp);
-    T2 = CopyTree(T2_tmp);
+    for (i = cut + T->node[cut].size; i < T->size; i++)
+        if (T->node[i].parent >= cut) /* the ancestors of cut did not move */
+            T->node[i].parent += delta;
 
-    /* It generates a random tree. It is expected a random tree with boolean functions if properly defined when creating the search space. */
-    TR = GROW(s, s->min_depth, s->max_depth);
-    TR_cpy = CopyTree(TR);
+    for (i = T->node[cut].parent; i >= 0; i = T->node[i].parent)
+        T->node[i].size += delta;
+}
 
-    T3 = CreateNode("OR", getFUNCTIONid("OR"), FUNCTION); /* It creates the root */
-    T3->parent = NULL;
+/* It replaces the subtree rooted at position cut of T by the subtree rooted at position from of S, storing the result in out
+Parameters:
+out: output linear tree (it must differ from T and S)
+T: linear tree that receives the subtree
+cut: position of the subtree to be replaced
+S: linear tree that gives the subtree
+from: position of the subtree to be inserted */
+static void SpliceLinearTree(LinearTree *out, LinearTree *T, int cut, LinearTree *S, int from)
+{
+    int i, end = cut + T->node[cut].size, len = S->node[from].size, tail = T->size - end;
 
-    LeftTree = CreateNode("AND", getFUNCTIONid("AND"), FUNCTION); /* It creates the tree on the left */
-    T3->left = LeftTree;
-    LeftTree->parent = T3;
-    LeftTree->left = T1;
-    T1->parent = LeftTree;
-    LeftTree->right = TR;
-    TR->parent = LeftTree;
-    TR->left_son = 0;
+    ReserveLinearTree(out, cut + len + tail);
+    memcpy(out->node, T->node, cut * sizeof(LinearNode));
+    memcpy(out->node + cut, S->node + from, len * sizeof(LinearNode));
+    memcpy(out->node + cut + len, T->node + end, tail * sizeof(LinearNode));
+    out->size = cut + len + tail;
 
-    RightTree = CreateNode("AND", getFUNCTIONid("AND"), FUNCTION); /* It creates the tree on the right */
-    T3->right = RightTree;
-    RightTree->parent = T3;
-    RightTree->left_son = 0;
-    NOT = CreateNode("NOT", getFUNCTIONid("NOT"), FUNCTION);
-    RightTree->left = NOT;
-    NOT->parent = RightTree;
-    RightTree->right = T2;
-    T2->parent = RightTree;
-    T2->left_son = 0;
-    NOT->left = TR_cpy;
-    TR_cpy->parent = NOT;
+    out->node[cut].parent = T->node[cut].parent;
+    for (i = cut + 1; i < cut + len; i++)
+        out->node[i].parent += cut - from;
 
-    return T3;
+    FixLinearTree(out, cut, len - T->node[cut].size);
 }
 
-/* It performs the Geometric Semantic Genetic Programming mutation operator for boolean functions
-Parameters:
+/* It performs the mutation of a linear tree (see Mutation). The mutated tree is stored in out.
+Paremeters:
 s: search space
-T: pointer to the tree */
-Node *SGMB(SearchSpace *s, Node *T_tmp)
+T: linear tree to be mutated (it must have at least two nodes)
+out: output linear tree (it must differ from T)
+p: probability of mutation at a function node */
+void LinearMutation(SearchSpace *s, LinearTree *T, LinearTree *out, float p)
 {
-    Node *TM = NULL, *T = NULL, *M = NULL, *NOT = NULL;
+    int cut, end;
     double r;
-    int i;
 
-    if (!s || !T_tmp)
+    if (!s || !T || !out || (T == out) || (T->size < 2))
     {
-        fprintf(stderr, "\nInput error @SGMB.\n");
-        return NULL;
+        fprintf(stderr, "\nInvalid input parameters @LinearMutation.\n");
+        exit(-1);
     }
 
-    r = randinter(0, 1);
-    T = CopyTree(T_tmp);
+    cut = round(GenerateUniformRandomNumber(2, T->size)) - 1; /* Mutation point cannot be the root */
 
-    M = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
-    for (i = 0; i < s->n; i++)
-        M->val[i] = round(GenerateUniformRandomNumber(s->LB[0], s->UB[0])); /* Creating a random minterm */
+    r = GenerateUniformRandomNumber(0, 1);
+    if (p > r) /* the mutation point is a function node, i.e., the parent of the chosen one */
+        cut = T->node[cut].parent;
 
-    if (r <= 0.5)
-    {
-        TM = CreateNode("OR", getFUNCTIONid("OR"), FUNCTION);
-        TM->parent = NULL;
-        TM->left = T;
-        T->parent = TM;
-        TM->right = M;
-        M->parent = TM;
-        M->left_son = 0;
-    }
-    else
-    {
-        TM = CreateNode("AND", getFUNCTIONid("AND"), FUNCTION);
-        TM->parent = NULL;
-        TM->left = T;
-        T->parent = TM;
-        NOT = CreateNode("NOT", getFUNCTIONid("NOT"), FUNCTION);
-        TM->right = NOT;
-        NOT->parent = TM;
-        NOT->left_son = 0;
-        NOT->left = M;
-        M->parent = NOT;
+    if (!cut)
+    { /* the mutation point is the root */
+        GrowLinearTree(s, out, s->min_depth, s->max_depth);
+        return;
     }
 
-    return TM;
+    /* It keeps the nodes before the mutation point, grows the new subtree right after them, and appends the nodes after the old subtree */
+    end = cut + T->node[cut].size;
+    ReserveLinearTree(out, cut);
+    memcpy(out->node, T->node, cut * sizeof(LinearNode));
+    out->size = cut;
+    GrowLinearSubtree(s, out, T->node[cut].parent, s->min_depth, s->max_depth);
+
+    ReserveLinearTree(out, out->size + T->size - end);
+    memcpy(out->node + out->size, T->node + end, (T->size - end) * sizeof(LinearNode));
+    out->size += T->size - end;
+
+    FixLinearTree(out, cut, out->node[cut].size - T->node[cut].size);
 }
-/***********************/
 
-/* It performs the Geometric Semantic Genetic Programming crossover operator for real-valued functions
+/* It performs the crossover between father and mother linear trees (see Crossover)
 Parameters:
-s: search space
-T1: pointer to the first tree
-T2: pointer to the second tree */
-Node *SGXE(SearchSpace *s, Node *T1_tmp, Node *T2_tmp)
+Father: father linear tree (it must have at least two nodes)
+Mother: mother linear tree (it must have at least two nodes)
+Son: output linear tree with the father's nodes and the mother's subtree
+Daughter: output linear tree with the mother's nodes and the father's subtree (it can be NULL)
+p: probability of crossover on a function node */
+void LinearCrossover(LinearTree *Father, LinearTree *Mother, LinearTree *Son, LinearTree *Daughter, float p)
 {
-    Node *T3 = NULL, *TR = NULL, *LeftTree = NULL;
-    Node *RightTree = NULL, *T1 = NULL, *T2 = NULL, *NOT_TR = NULL;
-    int i;
+    int father_point, mother_point;
+    double r;
 
-    if (!s || !T1_tmp || !T2_tmp)
+    if (!Father || !Mother || !Son || (Father->size < 2) || (Mother->size < 2) || (Son == Father) || (Son == Mother) ||
+        (Daughter == Father) || (Daughter == Mother))
     {
-        fprintf(stderr, "\nInput error @SGXE.\n");
-        return NULL;
+        fprintf(stderr, "\nInvalid input data @LinearCrossover.\n");
+        exit(-1);
     }
 
-    T1 = CopyTree(T1_tmp);
-    T2 = CopyTree(T2_tmp);
+    father_point = round(GenerateUniformRandomNumber(2, Father->size)) - 1; /* Crossover point cannot be the root */
+    r = GenerateUniformRandomNumber(0, 1);
+    if (p >= r) /* the crossover point is a function node, i.e., the parent of the chosen one */
+        father_point = Father->node[father_point].parent;
 
-    /* It generates an array with random values within [0,1] */
-    TR = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
-    for (i = 0; i < s->n; i++)
-        TR->val[i] = GenerateUniformRandomNumber(0, 1); /* Creating an array composed of random numbers */
+    mother_point = round(GenerateUniformRandomNumber(2, Mother->size)) - 1;
+    r = GenerateUniformRandomNumber(0, 1);
+    if (p >= r)
+        mother_point = Mother->node[mother_point].parent;
 
-    T3 = CreateNode("SUM", getFUNCTIONid("SUM"), FUNCTION); /* It creates the root */
-    T3->parent = NULL;
+    if (father_point && mother_point)
+    { /* If the crossover points have been properly found */
+        SpliceLinearTree(Son, Father, father_point, Mother, mother_point);
+        if (Daughter)
+            SpliceLinearTree(Daughter, Mother, mother_point, Father, father_point);
+    }
+    else
+    {
+        CopyLinearTree(Son, Father);
+        if (Daughter)
+            CopyLinearTree(Daughter, Mother);
+    }
+}
 
-    LeftTree = CreateNode("MUL", getFUNCTIONid("MUL"), FUNCTION); /* It creates the tree on the left */
-    T3->left = LeftTree;
-    LeftTree->parent = T3;
-    LeftTree->left = T1;
-    T1->parent = LeftTree;
-    LeftTree->right = TR;
-    TR->parent = LeftTree;
-    TR->left_son = 0;
+/* It returns the depth of a linear tree (see getTreeDepth). Only the leaves need to be checked, and their ancestors are
+found through the parents.
+Parameters:
+T: linear tree */
+int getLinearTreeDepth(LinearTree *T)
+{
+    int i, depth, max_depth = 0, parent;
 
-    RightTree = CreateNode("MUL", getFUNCTIONid("MUL"), FUNCTION); /* It creates the tree on the right */
-    T3->right = RightTree;
-    RightTree->parent = T3;
-    RightTree->left_son = 0;
+    if (!T)
+        return 0;
 
-    NOT_TR = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
-    for (i = 0; i < s->n; i++)
-        NOT_TR->val[i] = 1 - TR->val[i]; /* Creating 1-TR */
+    for (i = 0; i < T->size; i++)
+    {
+        if (T->node[i].size > 1)
+            continue;
 
-    RightTree->left = NOT_TR;
-    NOT_TR->parent = RightTree;
-    RightTree->right = T2;
-    T2->parent = RightTree;
-    T2->left_son = 0;
+        for (depth = 1, parent = T->node[i].parent; parent >= 0; parent = T->node[parent].parent)
+            depth++;
+        if (depth > max_depth)
+            max_depth = depth;
+    }
 
-    return T3;
+    return max_depth;
 }
 
-/* It performs the Geometric Semantic Genetic Programming mutation operator for real-valued functions
+/* It checks whether a linear tree respects the depth and size limits of a search space (see IsTreeWithinLimits)
 Parameters:
 s: search space
-T1: pointer to the first tree
-T2: pointer to the second tree */
-Node *SGME(SearchSpace *s, Node *T1_tmp, Node *T2_tmp)
+T: linear tree */
+char IsLinearTreeWithinLimits(SearchSpace *s, LinearTree *T)
 {
-    Node *T3 = NULL, *TR = NULL, *LeftTree = NULL;
-    Node *RightTree = NULL, *T1 = NULL, *T2 = NULL, *NOT_TR = NULL;
-    int i, j;
-
-    if (!s || !T1_tmp || !T2_tmp)
+    if (!s || !T)
     {
-        fprintf(stderr, "\nInput error @SGME.\n");
-        return NULL;
+        fprintf(stderr, "\nInvalid input parameters @IsLinearTreeWithinLimits.\n");
+        return 0;
     }
 
-    T1 = CopyTree(T1_tmp);
-    T2 = CopyTree(T2_tmp);
+    if ((s->max_tree_size > 0) && (T->size > s->max_tree_size))
+        return 0;
 
-    /* It generates an array with random values within [0,1] */
-    TR = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
-    for (i = 0; i < s->n; i++)
-        TR->val[i] = GenerateUniformRandomNumber(0, 1); /* Creating an array composed of random numbers */
+    if ((s->max_tree_depth > 0) && (getLinearTreeDepth(T) > s->max_tree_depth))
+        return 0;
 
-    /* Now we choose a random number within [0,2] in order to pick some
-    function bounded within [0,1] at random */
-    j = round(GenerateUniformRandomNumber(0, 2));
-    switch (j)
+    return 1;
+}
+
+/* It evaluates the linear trees of a GP/TGP search space (see EvaluateSearchSpace), i.e., it sets the best fitness value of
+each tree, as well as the global best fitness value and agent. The trees are evaluated in parallel if s->n_threads > 1, so the
+fitness function must be thread-safe in that case.
+Parameters:
+s: search space
+opt_id: _GP_ or _TGP_
+T: linear trees (s->m trees)
+EvaluateFun: pointer to the function used to evaluate the trees
+arg: list of additional arguments */
+void EvaluateLinearForest(SearchSpace *s, int opt_id, LinearTree **T, prtFun Evaluate, va_list arg)
+{
+    if (!s || !T || ((opt_id != _GP_) && (opt_id != _TGP_)))
     {
-    case 0:
-        for (i = 0; i < s->n; i++)
-            TR->val[i] = exp(TR->val[i]);
-        break;
-    case 1:
-        for (i = 0; i < s->n; i++)
-            TR->val[i] = fabs(sin(TR->val[i]));
-        break;
-    case 2:
-        for (i = 0; i < s->n; i++)
-            TR->val[i] = cos(sin(TR->val[i]));
-        break;
+        fprintf(stderr, "\nInvalid input parameters @EvaluateLinearForest.\n");
+        exit(-1);
     }
 
-    T3 = CreateNode("SUM", getFUNCTIONid("SUM"), FUNCTION); /* It creates the root */
-    T3->parent = NULL;
-
-    LeftTree = CreateNode("MUL", getFUNCTIONid("MUL"), FUNCTION); /* It creates the tree on the left */
-    T3->left = LeftTree;
-    LeftTree->parent = T3;
-    LeftTree->left = T1;
-    T1->parent = LeftTree;
-    LeftTree->right = TR;
-    TR->parent = LeftTree;
-    TR->left_son = 0;
-
-    RightTree = CreateNode("MUL", getFUNCTIONid("MUL"), FUNCTION); /* It creates the tree on the right */
-    T3->right = RightTree;
-    RightTree->parent = T3;
-    RightTree->left_son = 0;
-
-    NOT_TR = CreateNode("TMP", 0, NEW_TERMINAL, s->n);
-    for (i = 0; i < s->n; i++)
-        NOT_TR->val[i] = 1 - TR->val[i]; /* Creating 1-TR */
-
-    RightTree->left = NOT_TR;
-    NOT_TR->parent = RightTree;
-    RightTree->right = T2;
-    T2->parent = RightTree;
-    T2->left_son = 0;
-
-    return T3;
+    EvaluateForest(s, opt_id, T, Evaluate, arg);
 }
+/***********************/
 
 /* Tensor-related functions */
 /* It allocates a new tensor
@@ -2686,7 +6250,8 @@ void DestroyTensor(double ***t, int n){
     free(tmp);
 }
 
-/* It initializes an allocated search space with tensors
+/* It initializes an allocated search space with tensors. The tensor dimension is recorded in s->tensor_dim, so
+ResetSearchSpace initializes the tensors again.
 Parameters:
 s: search space
 tensor_id: identifier of the tensor space dimension */
@@ -2698,6 +6263,8 @@ void InitializeTensorSearchSpace(SearchSpace *s, int tensor_id){
 
     int i, j, k;
 
+    s->tensor_dim = tensor_id;
+
     for (i = 0; i < s->m; i++){
         for (j = 0; j < s->n; j++){
             for (k = 0; k < tensor_id; k++)
@@ -2896,7 +6463,8 @@ void EvaluateTensorSearchSpace(SearchSpace *s, int opt_id, int tensor_id, prtFun
     }
 
     int i, j, k;
-    double f, *tmp = NULL;
+    double f, cv, worst = -DBL_MAX, *tmp = NULL; /* worst: worst fitness value evaluated in this pass */
+    char *selected = NULL;
     Agent *individual = NULL;
     va_list argtmp;
 
@@ -2910,16 +6478,26 @@ void EvaluateTensorSearchSpace(SearchSpace *s, int opt_id, int tensor_id, prtFun
     case _BHA_:
     case _ABC_:
     case _HS_:
+        selected = ScreenSearchSpace(s); /* NULL if all agents must be evaluated */
         for (i = 0; i < s->m; i++)
         {
-            f = Evaluate(s->a[i], arg); /* It executes the fitness function for agent i */
+            if (selected && !selected[i]) /* agents screened out by the surrogate model are handled after the others (see FitScreenedAgents) */
+                continue;
+
+            cv = s->a[i]->cv;
+            f = EvaluateFitness(s, s->a[i], Evaluate, arg); /* It executes the fitness function for agent i */
 
-            if (f < s->a[i]->fit) /* It updates the fitness value */
+            if (IsBetterSolution(f, s->a[i]->cv, s->a[i]->fit, cv)) /* It updates the fitness value */
                 s->a[i]->fit = f;
+            else
+                s->a[i]->cv = cv;
+            if (s->a[i]->fit > worst)
+                worst = s->a[i]->fit;
 
-            if (s->a[i]->fit < s->gfit)
+            if (IsBetterSolution(s->a[i]->fit, s->a[i]->cv, s->gfit, s->gcv))
             { /* It updates the global best value and position */
                 s->gfit = s->a[i]->fit;
+                s->gcv = s->a[i]->cv;
                 for (j = 0; j < s->n; j++)
                 {
                     s->g[j] = s->a[i]->x[j];
@@ -2930,23 +6508,32 @@ void EvaluateTensorSearchSpace(SearchSpace *s, int opt_id, int tensor_id, prtFun
 
             va_copy(arg, argtmp);
         }
+        FitScreenedAgents(s, selected, worst);
         break;
     case _PSO_:
+        selected = ScreenSearchSpace(s);
         for (i = 0; i < s->m; i++)
         {
-            f = Evaluate(s->a[i], arg); /* It executes the fitness function for agent i */
+            if (selected && !selected[i]) /* agents screened out by the surrogate model keep their local best */
+                continue;
+
+            cv = s->a[i]->cv;
+            f = EvaluateFitness(s, s->a[i], Evaluate, arg); /* It executes the fitness function for agent i */
 
-            if (f < s->a[i]->fit)
+            if (IsBetterSolution(f, s->a[i]->cv, s->a[i]->fit, cv))
             { /* It updates the local best value and position */
                 s->a[i]->fit = f;
                 for (j = 0; j < s->n; j++)
                     for (k = 0; k < tensor_id; k++)
                         s->a[i]->t_xl[j][k] = s->a[i]->t[j][k];
             }
+            else
+                s->a[i]->cv = cv; /* the constraint violation refers to the local best */
 
-            if (s->a[i]->fit < s->gfit)
+            if (IsBetterSolution(s->a[i]->fit, s->a[i]->cv, s->gfit, s->gcv))
             { /* It updates the global best value and position */
                 s->gfit = s->a[i]->fit;
+                s->gcv = s->a[i]->cv;
                 for (j = 0; j < s->n; j++)
                 {
                     s->g[j] = s->a[i]->x[j];
@@ -2958,15 +6545,22 @@ void EvaluateTensorSearchSpace(SearchSpace *s, int opt_id, int tensor_id, prtFun
         }
         break;
     case _FA_:
+        selected = ScreenSearchSpace(s);
         for (i = 0; i < s->m; i++)
         {
-            f = Evaluate(s->a[i], arg); /* It executes the fitness function for agent i */
+            if (selected && !selected[i]) /* the brightness of agents screened out by the surrogate model is set afterwards (see FitScreenedAgents) */
+                continue;
+
+            f = EvaluateFitness(s, s->a[i], Evaluate, arg); /* It executes the fitness function for agent i */
 
             s->a[i]->fit = f; /* It updates the fitness value of actual agent i */
+            if (f > worst)
+                worst = f;
 
-            if (s->a[i]->fit < s->gfit)
+            if (IsBetterSolution(s->a[i]->fit, s->a[i]->cv, s->gfit, s->gcv))
             { /* It updates the global best value and position */
                 s->gfit = s->a[i]->fit;
+                s->gcv = s->a[i]->cv;
                 for (j = 0; j < s->n; j++)
                 {
                     s->g[j] = s->a[i]->x[j];
@@ -2977,6 +6571,7 @@ void EvaluateTensorSearchSpace(SearchSpace *s, int opt_id, int tensor_id, prtFun
 
             va_copy(arg, argtmp);
         }
+        FitScreenedAgents(s, selected, worst);
         break;
     default:
         fprintf(stderr, "\n Invalid optimization identifier @EvaluateTensorSearchSpace.\n");
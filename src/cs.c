@@ -46,9 +46,12 @@ void runCS(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _CS_, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    L = (double *)malloc(s->n * sizeof(double)); /* buffer of Levy steps, reused at each iteration */
+
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -58,17 +61,16 @@ void runCS(SearchSpace *s, prtFun Evaluate, ...)
         tmp = CopyAgent(s->a[nest_i], _CS_, _NOTENSOR_);
 
         /* Equation 1 */
-        L = GenerateLevyDistribution(s->n, s->beta);
+        GenerateLevyDistributionArray(L, s->n, s->beta);
         for (k = 0; k < s->n; k++)
             tmp->x[k] += s->alpha * L[k];
-        free(L);
         /**************/
 
         CheckAgentLimits(s, tmp);
 
         nest_j = round(GenerateUniformRandomNumber(0, s->m - 1));
 
-        fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent i */
+        fitValue = EvaluateCandidate(s, tmp, s->a[nest_j]->fit, Evaluate, arg); /* It executes the fitness function for agent i, unless the surrogate model discards it */
         if (fitValue < s->a[nest_j]->fit)
         { /* We accept the new solution */
             DestroyAgent(&(s->a[nest_j]), _CS_);
@@ -97,7 +99,7 @@ void runCS(SearchSpace *s, prtFun Evaluate, ...)
 
             CheckAgentLimits(s, tmp);
 
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent i */
+            fitValue = EvaluateCandidate(s, tmp, s->a[i]->fit, Evaluate, arg); /* It executes the fitness function for agent i, unless the surrogate model discards it */
             if (fitValue < s->a[i]->fit)
             { /* We accept the new solution */
                 DestroyAgent(&(s->a[i]), _CS_);
@@ -109,9 +111,18 @@ void runCS(SearchSpace *s, prtFun Evaluate, ...)
 
         qsort(s->a, s->m, sizeof(Agent **), SortAgent); /* Sorts all nests according to their fitness. First position gets the best nest. */
 
+        if (s->a[0]->fit < s->gfit)
+        { /* update the global best */
+            s->gfit = s->a[0]->fit;
+            for (k = 0; k < s->n; k++)
+                s->g[k] = s->a[0]->x[k];
+        }
+
         fprintf(stderr, "OK (minimum fitness value %lf)", s->a[0]->fit);
     }
 
+    free(L);
+
     va_end(arg);
 }
 
@@ -125,7 +136,7 @@ void runTensorCS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
 {
     va_list arg, argtmp;
     int t, i, j, k, nest_i, nest_j, loss;
-    double rand, **L = NULL, fitValue;
+    double rand, *L = NULL, fitValue;
     double **tmp_t = NULL;
     Agent *tmp = NULL;
 
@@ -138,9 +149,12 @@ void runTensorCS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _CS_, tensor_id, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    L = (double *)malloc(s->n * tensor_id * sizeof(double)); /* buffer of Levy steps (n x tensor_id), reused at each iteration */
+
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -151,15 +165,10 @@ void runTensorCS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         tmp_t = CopyTensor(s->a[nest_i]->t, s->n, tensor_id);
 
         /* Equation 1 */
-        L = (double **)calloc(s->n, sizeof(double *));
-        for (j = 0; j < s->n; j++)
-            L[j] = GenerateLevyDistribution(tensor_id, s->beta);
+        GenerateLevyDistributionArray(L, s->n * tensor_id, s->beta);
         for (j = 0; j < s->n; j++)
             for (k = 0; k < tensor_id; k++)
-                tmp_t[j][k] += s->alpha * L[j][k];
-        for (j = 0; j < s->n; j++)
-            free(L[j]);
-        free(L);
+                tmp_t[j][k] += s->alpha * L[j * tensor_id + k];
         /**************/
 
         CheckTensorLimits(s, tmp_t, tensor_id);
@@ -168,7 +177,7 @@ void runTensorCS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
 
         nest_j = round(GenerateUniformRandomNumber(0, s->m - 1));
 
-        fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent i */
+        fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent i */
         if (fitValue < s->a[nest_j]->fit)
         { /* We accept the new solution */
             DestroyTensor(&s->a[nest_j]->t, s->n);
@@ -204,7 +213,7 @@ void runTensorCS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
             for (j = 0; j < s->n; j++)
                 tmp->x[j] = TensorSpan(s->LB[j], s->UB[j], tmp_t[j], tensor_id);
 
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent i */
+            fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent i */
             if (fitValue < s->a[i]->fit)
             { /* We accept the new solution */
                 DestroyTensor(&s->a[i]->t, s->n);
@@ -219,8 +228,17 @@ void runTensorCS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
 
         qsort(s->a, s->m, sizeof(Agent **), SortAgent); /* Sorts all nests according to their fitness. First position gets the best nest. */
 
+        if (s->a[0]->fit < s->gfit)
+        { /* update the global best */
+            s->gfit = s->a[0]->fit;
+            for (k = 0; k < s->n; k++)
+                s->g[k] = s->a[0]->x[k];
+        }
+
         fprintf(stderr, "OK (minimum fitness value %lf)", s->a[0]->fit);
     }
 
+    free(L);
+
     va_end(arg);
 }
@@ -40,7 +40,8 @@ void runFA(SearchSpace *s, prtFun Evaluate, ...)
 
     tmp = (Agent **)malloc(s->m * sizeof(Agent *));
 
-    for (t = 1; t <= s->iterations; t++)
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -109,7 +110,8 @@ void runTensorFA(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
     tmp = (Agent **)malloc(s->m * sizeof(Agent *));
     tmp_t = (double ***)malloc(s->m * sizeof(double **));
 
-    for (t = 1; t <= s->iterations; t++)
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
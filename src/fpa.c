@@ -16,7 +16,9 @@ limitations under the License.
 
 #include "fpa.h"
 
-/* It executes the Flower Pollination Algorithm for function minimization
+/* It executes the Flower Pollination Algorithm for function minimization. The random numbers of each iteration are drawn at once:
+a block with the pollination type, the step and the pair of flowers of every flower, and a block with the Levy steps of the flowers
+that perform large-scale pollination. Candidates are built in a single buffer, so no agent is allocated within the iterations.
 Parameters:
 s: search space
 Evaluate: pointer to the function used to evaluate particles
@@ -24,9 +26,9 @@ arg: list of additional arguments */
 void runFPA(SearchSpace *s, prtFun Evaluate, ...)
 {
     va_list arg, argtmp;
-    int t, i, j, flower_j, flower_k;
-    double prob, epsilon, *L = NULL, fitValue;
-    Agent *tmp = NULL, **tmp_flowers = NULL;
+    int t, i, j, flower_j, flower_k, n_global;
+    double epsilon, *L = NULL, *l = NULL, *rnd = NULL, *flowers = NULL, fitValue;
+    Agent *tmp = NULL;
 
     va_start(arg, Evaluate);
     va_copy(argtmp, arg);
@@ -37,53 +39,59 @@ void runFPA(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _FPA_, Evaluate, arg); /* Initial evaluation of the search space */
 
-    tmp_flowers = (Agent **)calloc(s->m, sizeof(Agent));
+    tmp = CreateAgent(s->n, _FPA_, _NOTENSOR_); /* candidate flower, reused by every flower */
+    rnd = (double *)malloc(4 * s->m * sizeof(double)); /* pollination type, step and pair of flowers of each flower */
+    L = (double *)malloc((size_t)s->m * s->n * sizeof(double)); /* Levy steps of the flowers that perform large-scale pollination */
+    flowers = (double *)malloc((size_t)s->m * s->n * sizeof(double)); /* positions of the flowers at the beginning of the iteration */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
+        GenerateUniformRandomArray(rnd, 4 * s->m, 0, 1);
+        for (i = 0, n_global = 0; i < s->m; i++)
+            n_global += (rnd[i] > s->p);
+        if (n_global)
+            GenerateLevyDistributionArray(L, n_global * s->n, s->beta);
+        l = L;
+
         for (i = 0; i < s->m; i++)
-            tmp_flowers[i] = CopyAgent(s->a[i], _FPA_, _NOTENSOR_);
+            memcpy(flowers + (size_t)i * s->n, s->a[i]->x, s->n * sizeof(double));
 
         /* for each flower */
         for (i = 0; i < s->m; i++)
         {
             va_copy(arg, argtmp);
-            tmp = CopyAgent(s->a[i], _FPA_, _NOTENSOR_);
 
-            prob = GenerateUniformRandomNumber(0, 1);
-            if (prob > s->p)
+            if (rnd[i] > s->p)
             { /* large-scale pollination */
-                L = GenerateLevyDistribution(s->n, s->beta);
-
                 /* Equation 1 */
                 for (j = 0; j < s->n; j++)
-                    tmp->x[j] = tmp->x[j] + L[j] * (s->g[j] - tmp->x[j]);
+                    tmp->x[j] = s->a[i]->x[j] + l[j] * (s->g[j] - s->a[i]->x[j]);
                 /**************/
-
-                free(L);
+                l += s->n;
             }
             else
             { /* local pollination */
-                epsilon = GenerateUniformRandomNumber(0, 1);
-                flower_j = GenerateUniformRandomNumber(0, s->m - 1);
-                flower_k = GenerateUniformRandomNumber(0, s->m - 1);
+                epsilon = rnd[s->m + i];
+                flower_j = (int)(rnd[2 * s->m + i] * (s->m - 1));
+                flower_k = (int)(rnd[3 * s->m + i] * (s->m - 1));
 
                 /* Equation 3 */
                 for (j = 0; j < s->n; j++)
-                    tmp->x[j] = tmp->x[j] + epsilon * (tmp_flowers[flower_j]->x[j] - tmp_flowers[flower_k]->x[j]);
+                    tmp->x[j] = s->a[i]->x[j] + epsilon * (flowers[(size_t)flower_j * s->n + j] - flowers[(size_t)flower_k * s->n + j]);
             }
             CheckAgentLimits(s, tmp);
 
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent i */
+            fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent i */
             if (fitValue < s->a[i]->fit)
             { /* We accept the new solution */
-                DestroyAgent(&(s->a[i]), _FPA_);
-                s->a[i] = CopyAgent(tmp, _FPA_, _NOTENSOR_);
+                memcpy(s->a[i]->x, tmp->x, s->n * sizeof(double));
                 s->a[i]->fit = fitValue;
+                s->a[i]->cv = tmp->cv;
             }
 
             if (fitValue < s->gfit)
@@ -92,16 +100,15 @@ void runFPA(SearchSpace *s, prtFun Evaluate, ...)
                 for (j = 0; j < s->n; j++)
                     s->g[j] = tmp->x[j];
             }
-            DestroyAgent(&tmp, _FPA_);
         }
 
-        for (i = 0; i < s->m; i++)
-            DestroyAgent(&tmp_flowers[i], _FPA_);
-
         fprintf(stderr, "OK (minimum fitness value %lf)", s->gfit);
     }
 
-    free(tmp_flowers);
+    DestroyAgent(&tmp, _FPA_);
+    free(rnd);
+    free(L);
+    free(flowers);
 
     va_end(arg);
 }
@@ -130,11 +137,12 @@ void runTensorFPA(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _FPA_, tensor_id, Evaluate, arg); /* Initial evaluation of the search space */
 
     tmp_tensors = (double ***)calloc(s->m, sizeof(double **));
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -179,7 +187,7 @@ void runTensorFPA(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
             for (j = 0; j < s->n; j++)
                 tmp->x[j] = TensorSpan(s->LB[j], s->UB[j], tmp_t[j], tensor_id);
 
-            fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent i */
+            fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent i */
             if (fitValue < s->a[i]->fit)
             { /* We accept the new solution */
                 DestroyTensor(&s->a[i]->t, s->n);
@@ -16,6 +16,14 @@ limitations under the License.
 
 #include "function.h"
 
+/* It computes the square of a number without going through pow()
+Parameters:
+x: input value */
+static double Square(double x)
+{
+    return x * x;
+}
+
 /* Benchmark functions */
 /* It computes the 1st Ackley's function
 Parameters:
@@ -43,11 +51,11 @@ double Ackley_First(Agent *a, va_list arg)
 
     for (i = 0; i < a->n; i++)
     {
-        sum_1 += pow(a->x[i], 2);
+        sum_1 += (a->x[i] * a->x[i]);
         sum_2 += cos(gamma * a->x[i]);
     }
 
-    sum = -alpha * exp(-beta * sqrt((1 / a->n) * sum_1)) - exp((1 / a->n) * sum_2) + alpha + exp(1);
+    sum = -alpha * exp(-beta * sqrt((1.0 / a->n) * sum_1)) - exp((1.0 / a->n) * sum_2) + alpha + exp(1);
 
     return sum;
 }
@@ -74,7 +82,7 @@ double Ackley_Second(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = -200 * exp(-0.02 * sqrt(pow(a->x[0], 2) + pow(a->x[1], 2)));
+    sum = -200 * exp(-0.02 * sqrt((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -101,7 +109,7 @@ double Ackley_Third(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 200 * exp(-0.02 * sqrt(pow(a->x[0], 2) + pow(a->x[1], 2))) + 5 * exp(cos(3 * a->x[0]) + sin(3 * a->x[1]));
+    sum = 200 * exp(-0.02 * sqrt((a->x[0] * a->x[0]) + (a->x[1] * a->x[1]))) + 5 * exp(cos(3 * a->x[0]) + sin(3 * a->x[1]));
 
     return sum;
 }
@@ -128,7 +136,7 @@ double Adjiman(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = cos(a->x[0]) * sin(a->x[1]) - a->x[0] / (pow(a->x[1], 2) + 1);
+    sum = cos(a->x[0]) * sin(a->x[1]) - a->x[0] / ((a->x[1] * a->x[1]) + 1);
 
     return sum;
 }
@@ -213,7 +221,7 @@ double Bartels_Conn(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = fabs(pow(a->x[0], 2) + pow(a->x[1], 2) + a->x[0] * a->x[1]) + fabs(sin(a->x[0])) + fabs(cos(a->x[1]));
+    sum = fabs((a->x[0] * a->x[0]) + (a->x[1] * a->x[1]) + a->x[0] * a->x[1]) + fabs(sin(a->x[0])) + fabs(cos(a->x[1]));
 
     return sum;
 }
@@ -240,7 +248,7 @@ double Beale(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(1.5 - a->x[0] + a->x[0] * a->x[1], 2) + pow(2.25 - a->x[0] + a->x[0] * pow(a->x[1], 2), 2) + pow(2.625 - a->x[0] + a->x[0] * pow(a->x[1], 3), 2);
+    sum = Square(1.5 - a->x[0] + a->x[0] * a->x[1]) + Square(2.25 - a->x[0] + a->x[0] * (a->x[1] * a->x[1])) + Square(2.625 - a->x[0] + a->x[0] * pow(a->x[1], 3));
 
     return sum;
 }
@@ -269,7 +277,7 @@ double Biggs_EXP2(Agent *a, va_list arg)
     }
 
     for (i = 1; i <= 10; i++)
-        sum += pow(exp(-0.1 * i * a->x[0]) - 5 * exp(-0.1 * i * a->x[1]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i)), 2);
+        sum += Square(exp(-0.1 * i * a->x[0]) - 5 * exp(-0.1 * i * a->x[1]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i)));
 
     return sum;
 }
@@ -298,7 +306,7 @@ double Biggs_EXP3(Agent *a, va_list arg)
     }
 
     for (i = 1; i <= 10; i++)
-        sum += pow(exp(-0.1 * i * a->x[0]) - a->x[2] * exp(-0.1 * i * a->x[1]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i)), 2);
+        sum += Square(exp(-0.1 * i * a->x[0]) - a->x[2] * exp(-0.1 * i * a->x[1]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i)));
 
     return sum;
 }
@@ -327,7 +335,7 @@ double Biggs_EXP4(Agent *a, va_list arg)
     }
 
     for (i = 1; i <= 10; i++)
-        sum += pow(a->x[2] * exp(-0.1 * i * a->x[0]) - a->x[3] * exp(-0.1 * i * a->x[1]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i)), 2);
+        sum += Square(a->x[2] * exp(-0.1 * i * a->x[0]) - a->x[3] * exp(-0.1 * i * a->x[1]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i)));
 
     return sum;
 }
@@ -356,7 +364,7 @@ double Biggs_EXP5(Agent *a, va_list arg)
     }
 
     for (i = 1; i <= 11; i++)
-        sum += pow(a->x[2] * exp(-0.1 * i * a->x[0]) - a->x[3] * exp(-0.1 * i * a->x[1]) + 3 * exp(-0.1 * i * a->x[4]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i) + 3 * exp(-4 * 0.1 * i)), 2);
+        sum += Square(a->x[2] * exp(-0.1 * i * a->x[0]) - a->x[3] * exp(-0.1 * i * a->x[1]) + 3 * exp(-0.1 * i * a->x[4]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i) + 3 * exp(-4 * 0.1 * i)));
 
     return sum;
 }
@@ -385,7 +393,7 @@ double Biggs_EXP6(Agent *a, va_list arg)
     }
 
     for (i = 1; i <= 13; i++)
-        sum += pow(a->x[2] * exp(-0.1 * i * a->x[0]) - a->x[3] * exp(-0.1 * i * a->x[1]) + a->x[5] * exp(-0.1 * i * a->x[4]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i) + 3 * exp(-4 * 0.1 * i)), 2);
+        sum += Square(a->x[2] * exp(-0.1 * i * a->x[0]) - a->x[3] * exp(-0.1 * i * a->x[1]) + a->x[5] * exp(-0.1 * i * a->x[4]) - (exp(-0.1 * i) - 5 * exp(10 * 0.1 * i) + 3 * exp(-4 * 0.1 * i)));
 
     return sum;
 }
@@ -412,7 +420,7 @@ double Bird(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = sin(a->x[0]) * exp(pow(1 - cos(a->x[1]), 2)) + cos(a->x[1]) * exp(pow(1 - sin(a->x[0]), 2)) + pow(a->x[0] - a->x[1], 2);
+    sum = sin(a->x[0]) * exp(Square(1 - cos(a->x[1]))) + cos(a->x[1]) * exp(Square(1 - sin(a->x[0]))) + Square(a->x[0] - a->x[1]);
 
     return sum;
 }
@@ -439,7 +447,7 @@ double Bohachevsky_First(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0], 2) + 2 * pow(a->x[1], 2) - 0.3 * cos(3 * M_PI * a->x[0]) - 0.4 * cos(4 * M_PI * a->x[1]) + 0.7;
+    sum = (a->x[0] * a->x[0]) + 2 * (a->x[1] * a->x[1]) - 0.3 * cos(3 * M_PI * a->x[0]) - 0.4 * cos(4 * M_PI * a->x[1]) + 0.7;
 
     return sum;
 }
@@ -466,7 +474,7 @@ double Bohachevsky_Second(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0], 2) + 2 * pow(a->x[1], 2) - (0.3 * cos(3 * M_PI * a->x[0])) * (0.4 * cos(4 * M_PI * a->x[1])) + 0.3;
+    sum = (a->x[0] * a->x[0]) + 2 * (a->x[1] * a->x[1]) - (0.3 * cos(3 * M_PI * a->x[0])) * (0.4 * cos(4 * M_PI * a->x[1])) + 0.3;
 
     return sum;
 }
@@ -493,7 +501,7 @@ double Bohachevsky_Third(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0], 2) + 2 * pow(a->x[1], 2) - 0.3 * cos(3 * M_PI * a->x[0] + 4 * M_PI * a->x[1]) + 0.3;
+    sum = (a->x[0] * a->x[0]) + 2 * (a->x[1] * a->x[1]) - 0.3 * cos(3 * M_PI * a->x[0] + 4 * M_PI * a->x[1]) + 0.3;
 
     return sum;
 }
@@ -520,7 +528,7 @@ double Booth(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0] + 2 * a->x[1] - 7, 2) + pow(2 * a->x[0] + a->x[1] - 5, 2);
+    sum = Square(a->x[0] + 2 * a->x[1] - 7) + Square(2 * a->x[0] + a->x[1] - 5);
 
     return sum;
 }
@@ -549,7 +557,7 @@ double Box_Betts(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += pow(exp(-0.1 * (i + 1) * a->x[0]) - exp(-0.1 * (i + 1) * a->x[1]) - exp(fabs(-0.1 * (i + 1) - exp(-(i + 1))) * a->x[2]), 2);
+        sum += Square(exp(-0.1 * (i + 1) * a->x[0]) - exp(-0.1 * (i + 1) * a->x[1]) - exp(fabs(-0.1 * (i + 1) - exp(-(i + 1))) * a->x[2]));
 
     return sum;
 }
@@ -576,7 +584,7 @@ double Brent(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0] + 10, 2) + pow(a->x[1] + 10, 2) + exp(-pow(a->x[0], 2) - pow(a->x[1], 2));
+    sum = Square(a->x[0] + 10) + Square(a->x[1] + 10) + exp(-(a->x[0] * a->x[0]) - (a->x[1] * a->x[1]));
 
     return sum;
 }
@@ -605,7 +613,7 @@ double Brown(Agent *a, va_list arg)
     }
 
     for (i = 0; i < (a->n - 1); i++)
-        sum += pow(pow(a->x[i], 2), (pow(a->x[i + 1], 2) + 1)) + pow(pow(a->x[i + 1], 2), (pow(a->x[i], 2) + 1));
+        sum += pow((a->x[i] * a->x[i]), ((a->x[i + 1] * a->x[i + 1]) + 1)) + pow((a->x[i + 1] * a->x[i + 1]), ((a->x[i] * a->x[i]) + 1));
 
     return sum;
 }
@@ -632,7 +640,7 @@ double Bukin_Second(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 100 * (a->x[1] - 0.01 * pow(a->x[0], 2) + 1) + 0.01 * pow(a->x[0] + 10, 2);
+    sum = 100 * (a->x[1] - 0.01 * (a->x[0] * a->x[0]) + 1) + 0.01 * Square(a->x[0] + 10);
 
     return sum;
 }
@@ -659,7 +667,7 @@ double Bukin_Forth(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 100 * pow(a->x[1], 2) + 0.01 * fabs(a->x[0] + 10);
+    sum = 100 * (a->x[1] * a->x[1]) + 0.01 * fabs(a->x[0] + 10);
 
     return sum;
 }
@@ -686,7 +694,7 @@ double Bukin_Sixth(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 100 * sqrt(fabs(a->x[1] - 0.01 * pow(a->x[0], 2))) + 0.01 * fabs(a->x[0] + 10);
+    sum = 100 * sqrt(fabs(a->x[1] - 0.01 * (a->x[0] * a->x[0]))) + 0.01 * fabs(a->x[0] + 10);
 
     return sum;
 }
@@ -713,7 +721,7 @@ double Three_HumpCamel(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 2 * pow(a->x[0], 2) - 1.05 * pow(a->x[0], 4) + pow(a->x[0], 6) / 6 + a->x[0] * a->x[1] + pow(a->x[1], 2);
+    sum = 2 * (a->x[0] * a->x[0]) - 1.05 * Square(Square(a->x[0])) + pow(a->x[0], 6) / 6 + a->x[0] * a->x[1] + (a->x[1] * a->x[1]);
 
     return sum;
 }
@@ -740,7 +748,7 @@ double Six_HumpCamel(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = (4 - 2.1 * pow(a->x[0], 2) + pow(a->x[0], 4) / 3) * pow(a->x[0], 2) + a->x[0] * a->x[1] + (4 * pow(a->x[1], 2) - 4) * pow(a->x[1], 2);
+    sum = (4 - 2.1 * (a->x[0] * a->x[0]) + Square(Square(a->x[0])) / 3) * (a->x[0] * a->x[0]) + a->x[0] * a->x[1] + (4 * (a->x[1] * a->x[1]) - 4) * (a->x[1] * a->x[1]);
 
     return sum;
 }
@@ -767,7 +775,7 @@ double Chen_Bird(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = -0.001 / (pow(0.001, 2) + pow(a->x[0] - 0.4 * a->x[1] - 0.1, 2)) - 0.001 / (pow(0.001, 2) + pow(2 * a->x[0] + a->x[1] - 1.5, 2));
+    sum = -0.001 / (Square(0.001) + Square(a->x[0] - 0.4 * a->x[1] - 0.1)) - 0.001 / (Square(0.001) + Square(2 * a->x[0] + a->x[1] - 1.5));
 
     return sum;
 }
@@ -794,7 +802,7 @@ double Chen_V(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = -0.001 / (pow(0.001, 2) + pow(pow(a->x[0], 2) + pow(a->x[1], 2) - 1, 2)) - 0.001 / (pow(0.001, 2) + pow(pow(a->x[0], 2) + pow(a->x[1], 2) - 0.5, 2)) - 0.001 / (pow(0.001, 2) + pow(pow(a->x[0], 2) + pow(a->x[1], 2), 2));
+    sum = -0.001 / (Square(0.001) + Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1]) - 1)) - 0.001 / (Square(0.001) + Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1]) - 0.5)) - 0.001 / (Square(0.001) + Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -821,7 +829,7 @@ double Chichinadze(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0], 2) - 12 * a->x[0] + 11 + 10 * cos(M_PI * a->x[0] / 2) + 8 * sin(5 * M_PI * a->x[0] / 2) - pow(1 / 5, 0.5) * exp(-0.5 * pow(a->x[1] - 0.5, 2));
+    sum = (a->x[0] * a->x[0]) - 12 * a->x[0] + 11 + 10 * cos(M_PI * a->x[0] / 2) + 8 * sin(5 * M_PI * a->x[0] / 2) - pow(1 / 5, 0.5) * exp(-0.5 * Square(a->x[1] - 0.5));
 
     return sum;
 }
@@ -850,7 +858,7 @@ double Chung_Reynolds(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += pow(a->x[i], 2);
+        sum += (a->x[i] * a->x[i]);
 
     sum *= sum;
 
@@ -879,7 +887,7 @@ double Colville(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 100 * pow(a->x[0] - pow(a->x[1], 2), 2) + pow(1 - a->x[0], 2) + 90 * pow(a->x[3] - pow(a->x[2], 2), 2) + pow(1 - a->x[2], 2) + 10.1 * (pow(a->x[1] - 1, 2) + pow(a->x[3] - 1, 2)) + 19.8 * (a->x[1] - 1) * (a->x[3] - 1);
+    sum = 100 * Square(a->x[0] - (a->x[1] * a->x[1])) + Square(1 - a->x[0]) + 90 * Square(a->x[3] - (a->x[2] * a->x[2])) + Square(1 - a->x[2]) + 10.1 * (Square(a->x[1] - 1) + Square(a->x[3] - 1)) + 19.8 * (a->x[1] - 1) * (a->x[3] - 1);
 
     return sum;
 }
@@ -906,7 +914,7 @@ double Cross_Tray(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = -0.0001 * pow((fabs(sin(a->x[0]) * sin(a->x[1]) * exp(fabs(100 - (sqrt(pow(a->x[0], 2) + pow(a->x[1], 2)) / M_PI)))) + 1), 0.1);
+    sum = -0.0001 * pow((fabs(sin(a->x[0]) * sin(a->x[1]) * exp(fabs(100 - (sqrt((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])) / M_PI)))) + 1), 0.1);
 
     return sum;
 }
@@ -962,7 +970,7 @@ double Cube(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 100 * pow(a->x[1] - pow(a->x[0], 3), 2) + pow(1 - a->x[0], 2);
+    sum = 100 * Square(a->x[1] - pow(a->x[0], 3)) + Square(1 - a->x[0]);
 
     return sum;
 }
@@ -989,7 +997,7 @@ double Damavandi(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = (1 - pow(fabs((sin(M_PI * (a->x[0] - 2)) * sin(M_PI * (a->x[1] - 2))) / (pow(M_PI, 2) * (a->x[0] - 2) * (a->x[1] - 2))), 5)) * (2 + pow(a->x[0] - 7, 2) + 2 * pow(a->x[1] - 7, 2));
+    sum = (1 - pow(fabs((sin(M_PI * (a->x[0] - 2)) * sin(M_PI * (a->x[1] - 2))) / (Square(M_PI) * (a->x[0] - 2) * (a->x[1] - 2))), 5)) * (2 + Square(a->x[0] - 7) + 2 * Square(a->x[1] - 7));
 
     return sum;
 }
@@ -1016,7 +1024,7 @@ double Deckkers_Aarts(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(10, 5) * pow(a->x[0], 2) + pow(a->x[1], 2) - pow(pow(a->x[0], 2) + pow(a->x[1], 2), 2) + pow(10, -5) * pow(pow(a->x[0], 2) + pow(a->x[1], 2), 4);
+    sum = pow(10, 5) * (a->x[0] * a->x[0]) + (a->x[1] * a->x[1]) - Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])) + pow(10, -5) * Square(Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -1030,7 +1038,7 @@ Domain: -10 <= x_i <= 10 */
 double Dixon_Price(Agent *a, va_list arg)
 {
     int i;
-    double sum = 0;
+    double sum = 0, tmp;
 
     if (!a)
     {
@@ -1044,10 +1052,13 @@ double Dixon_Price(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0] - 1, 2);
+    sum = (a->x[0] - 1) * (a->x[0] - 1);
 
     for (i = 1; i < a->n; i++)
-        sum += (i + 1) * pow((2 * pow(a->x[i], 2) - a->x[i - 1]), 2);
+    {
+        tmp = 2 * (a->x[i] * a->x[i]) - a->x[i - 1];
+        sum += (i + 1) * tmp * tmp;
+    }
 
     return sum;
 }
@@ -1074,7 +1085,7 @@ double Easom(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = -cos(a->x[0]) * cos(a->x[1]) * exp(-pow(a->x[0] - M_PI, 2) - pow(a->x[1] - M_PI, 2));
+    sum = -cos(a->x[0]) * cos(a->x[1]) * exp(-Square(a->x[0] - M_PI) - Square(a->x[1] - M_PI));
 
     return sum;
 }
@@ -1101,7 +1112,7 @@ double ElAttar_VidyasagarDutta(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(pow(a->x[0], 2) + a->x[1] - 10, 2) + pow(a->x[0] + pow(a->x[1], 2) - 7, 2) + pow(pow(a->x[0], 2) + pow(a->x[1], 3) - 1, 2);
+    sum = Square((a->x[0] * a->x[0]) + a->x[1] - 10) + Square(a->x[0] + (a->x[1] * a->x[1]) - 7) + Square((a->x[0] * a->x[0]) + pow(a->x[1], 3) - 1);
 
     return sum;
 }
@@ -1128,7 +1139,7 @@ double Eggcrate(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0], 2) + pow(a->x[1], 2) + 25 * (pow(sin(a->x[0]), 2) + pow(sin(a->x[1]), 2));
+    sum = (a->x[0] * a->x[0]) + (a->x[1] * a->x[1]) + 25 * (Square(sin(a->x[0])) + Square(sin(a->x[1])));
 
     return sum;
 }
@@ -1186,7 +1197,7 @@ double Exponential(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        partial_sum += pow(a->x[i], 2);
+        partial_sum += (a->x[i] * a->x[i]);
 
     sum = -exp(-0.5 * partial_sum);
 
@@ -1217,7 +1228,7 @@ double EXP_2(Agent *a, va_list arg)
     }
 
     for (i = 0; i < 10; i++)
-        sum += pow(exp(-i * a->x[0] / 10) - 5 * exp(-i * a->x[1] / 10) - exp(-i / 10) + 5 * exp(-i), 2);
+        sum += Square(exp(-i * a->x[0] / 10) - 5 * exp(-i * a->x[1] / 10) - exp(-i / 10) + 5 * exp(-i));
 
     return sum;
 }
@@ -1245,7 +1256,7 @@ double Freudenstein_Roth(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0] - 13 + ((5 - a->x[1]) * a->x[1] - 2) * a->x[1], 2) + pow(a->x[0] - 29 + ((a->x[1] + 1) * a->x[1] - 14) * a->x[1], 2);
+    sum = Square(a->x[0] - 13 + ((5 - a->x[1]) * a->x[1] - 2) * a->x[1]) + Square(a->x[0] - 29 + ((a->x[1] + 1) * a->x[1] - 14) * a->x[1]);
 
     return sum;
 }
@@ -1274,7 +1285,7 @@ double Giunta(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += sin(16 / 15 * a->x[i] - 1) + pow(sin(16 / 15 * a->x[i] - 1), 2) + (1 / 50) * sin(4 * (16 / 15 * a->x[i] - 1));
+        sum += sin(16 / 15 * a->x[i] - 1) + Square(sin(16 / 15 * a->x[i] - 1)) + (1 / 50) * sin(4 * (16 / 15 * a->x[i] - 1));
 
     sum = 0.6 + sum;
 
@@ -1303,7 +1314,7 @@ double Goldstein_Price(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = (1 + pow(a->x[0] + a->x[1] + 1, 2) * (19 - 14 * a->x[0] + 3 * pow(a->x[1], 2) - 14 * a->x[1] + 6 * a->x[0] * a->x[1] + 3 * pow(a->x[1], 2))) * (30 + pow(2 * a->x[0] - 3 * a->x[1], 2) * (18 - 32 * a->x[0] + 12 * pow(a->x[0], 2) + 48 * a->x[1] - 36 * a->x[0] * a->x[1] + 27 * pow(a->x[1], 2)));
+    sum = (1 + Square(a->x[0] + a->x[1] + 1) * (19 - 14 * a->x[0] + 3 * (a->x[1] * a->x[1]) - 14 * a->x[1] + 6 * a->x[0] * a->x[1] + 3 * (a->x[1] * a->x[1]))) * (30 + Square(2 * a->x[0] - 3 * a->x[1]) * (18 - 32 * a->x[0] + 12 * (a->x[0] * a->x[0]) + 48 * a->x[1] - 36 * a->x[0] * a->x[1] + 27 * (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -1334,7 +1345,7 @@ double Griewank(Agent *a, va_list arg)
     for (i = 0; i < a->n; i++)
     {
         partial_sum *= cos(a->x[i] / sqrt(i + 1)) + 1;
-        sum += pow(a->x[i], 2) / 4000;
+        sum += (a->x[i] * a->x[i]) / 4000;
     }
 
     sum = sum - partial_sum;
@@ -1368,7 +1379,7 @@ double Gulf_Research(Agent *a, va_list arg)
     for (i = 1; i < 100; i++)
     {
         u = 25 + pow((-50 * log(0.01 * i)), 1 / 1.5);
-        sum += pow(exp(-pow(u - a->x[1], a->x[2]) / a->x[0]) - 0.01 * i, 2);
+        sum += Square(exp(-pow(u - a->x[1], a->x[2]) / a->x[0]) - 0.01 * i);
     }
 
     return sum;
@@ -1401,7 +1412,7 @@ double Helical_Valley(Agent *a, va_list arg)
     else
         theta = (1 / 2 * M_PI) * pow(tan(a->x[0] / a->x[1] + 0.5), -1);
 
-    sum = 100 * (pow(a->x[1] - 10 * theta, 2) + sqrt(pow(a->x[0], 2) + pow(a->x[1], 2)) - 1) + pow(a->x[2], 2);
+    sum = 100 * (Square(a->x[1] - 10 * theta) + sqrt((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])) - 1) + (a->x[2] * a->x[2]);
 
     return sum;
 }
@@ -1428,7 +1439,7 @@ double Himmelblau(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(pow(a->x[0], 2) + a->x[1] - 11, 2) + pow(a->x[0] + pow(a->x[1], 2) - 7, 2);
+    sum = Square((a->x[0] * a->x[0]) + a->x[1] - 11) + Square(a->x[0] + (a->x[1] * a->x[1]) - 7);
 
     return sum;
 }
@@ -1455,7 +1466,7 @@ double Hosaki(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = (1 - 8 * a->x[0] + 7 * pow(a->x[0], 2) - (7 / 3 * pow(a->x[0], 3)) + (1 / 4 * pow(a->x[0], 4))) * pow(a->x[1], 2) * exp(-a->x[1]);
+    sum = (1 - 8 * a->x[0] + 7 * (a->x[0] * a->x[0]) - (7 / 3 * pow(a->x[0], 3)) + (1 / 4 * Square(Square(a->x[0])))) * (a->x[1] * a->x[1]) * exp(-a->x[1]);
 
     return sum;
 }
@@ -1484,7 +1495,7 @@ double Jennrick_Sampson(Agent *a, va_list arg)
     }
 
     for (i = 1; i <= 10; i++)
-        sum += pow(2 + 2 * i - (exp(i * a->x[0]) + exp(i * a->x[1])), 2);
+        sum += Square(2 + 2 * i - (exp(i * a->x[0]) + exp(i * a->x[1])));
 
     return sum;
 }
@@ -1511,7 +1522,7 @@ double Keane(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = (pow(sin(a->x[0] - a->x[1]), 2) * pow(sin(a->x[0] + a->x[1]), 2)) / sqrt(pow(a->x[0], 2) + pow(a->x[1], 2));
+    sum = (Square(sin(a->x[0] - a->x[1])) * Square(sin(a->x[0] + a->x[1]))) / sqrt((a->x[0] * a->x[0]) + (a->x[1] * a->x[1]));
 
     return sum;
 }
@@ -1538,7 +1549,7 @@ double Leon(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 100 * pow(a->x[1] - pow(a->x[0], 2), 2) + pow(1 - a->x[0], 2);
+    sum = 100 * Square(a->x[1] - (a->x[0] * a->x[0])) + Square(1 - a->x[0]);
 
     return sum;
 }
@@ -1573,10 +1584,10 @@ double Levy(Agent *a, va_list arg)
     for (i = 0; i < (a->n - 1); i++)
     {
         w = 1 + ((a->x[i] - 1) / 4);
-        partial_sum += pow(w - 1, 2) * (1 + 10 * pow(sin(M_PI * w + 1), 2)) + pow(w_d - 1, 2) * (1 + pow(sin(2 * M_PI * w_d), 2));
+        partial_sum += Square(w - 1) * (1 + 10 * Square(sin(M_PI * w + 1))) + Square(w_d - 1) * (1 + Square(sin(2 * M_PI * w_d)));
     }
 
-    sum = pow(sin(M_PI * w_1), 2) + partial_sum;
+    sum = Square(sin(M_PI * w_1)) + partial_sum;
 
     return sum;
 }
@@ -1603,7 +1614,7 @@ double Levy_Thirteenth(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(sin(3 * M_PI * a->x[0]), 2) + (pow(a->x[0] - 1, 2) * (1 + pow(sin(3 * M_PI * a->x[1]), 2))) + (pow(a->x[1] - 1, 2) * (1 + pow(sin(2 * M_PI * a->x[1]), 2)));
+    sum = Square(sin(3 * M_PI * a->x[0])) + (Square(a->x[0] - 1) * (1 + Square(sin(3 * M_PI * a->x[1])))) + (Square(a->x[1] - 1) * (1 + Square(sin(2 * M_PI * a->x[1]))));
 
     return sum;
 }
@@ -1630,7 +1641,7 @@ double Matyas(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 0.26 * (pow(a->x[0], 2) + pow(a->x[1], 2)) - (0.48 * a->x[0] * a->x[1]);
+    sum = 0.26 * ((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])) - (0.48 * a->x[0] * a->x[1]);
 
     return sum;
 }
@@ -1657,7 +1668,7 @@ double McCormick(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = sin(a->x[0] + a->x[1]) + pow(a->x[0] - a->x[1], 2) - (3 / 2) * a->x[0] + (5 / 2) * a->x[1] + 1;
+    sum = sin(a->x[0] + a->x[1]) + Square(a->x[0] - a->x[1]) - (3 / 2) * a->x[0] + (5 / 2) * a->x[1] + 1;
 
     return sum;
 }
@@ -1684,7 +1695,7 @@ double Miele_Cantrell(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(exp(-a->x[0]) - a->x[1], 4) + 100 * pow(a->x[1] - a->x[2], 6) + pow(tan(a->x[2] - a->x[3]), 4) + pow(a->x[0], 8);
+    sum = Square(Square(exp(-a->x[0]) - a->x[1])) + 100 * pow(a->x[1] - a->x[2], 6) + Square(Square(tan(a->x[2] - a->x[3]))) + pow(a->x[0], 8);
 
     return sum;
 }
@@ -1711,7 +1722,7 @@ double Parsopoulos(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = cos(pow(a->x[0], 2)) + sin(pow(a->x[1], 2));
+    sum = cos((a->x[0] * a->x[0])) + sin((a->x[1] * a->x[1]));
 
     return sum;
 }
@@ -1738,7 +1749,7 @@ double Pen_Holder(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = -exp(pow(fabs(cos(a->x[0]) * cos(a->x[1]) * exp(fabs(1 - pow(pow(a->x[0], 2) + pow(a->x[1], 2), 0.5) / M_PI))), -1));
+    sum = -exp(pow(fabs(cos(a->x[0]) * cos(a->x[1]) * exp(fabs(1 - pow((a->x[0] * a->x[0]) + (a->x[1] * a->x[1]), 0.5) / M_PI))), -1));
 
     return sum;
 }
@@ -1767,7 +1778,7 @@ double Pathological(Agent *a, va_list arg)
     }
 
     for (i = 0; i < (a->n - 1); i++)
-        sum += 0.5 + (pow(sin(sqrt(100 * pow(a->x[i], 2) + pow(a->x[i + 1], 2)) - 0.5), 2)) / (1 + 0.001 * pow(pow(a->x[i], 2) - 2 * a->x[i] * a->x[i + 1] + pow(a->x[i + 1], 2), 2));
+        sum += 0.5 + (Square(sin(sqrt(100 * (a->x[i] * a->x[i]) + (a->x[i + 1] * a->x[i + 1])) - 0.5))) / (1 + 0.001 * Square((a->x[i] * a->x[i]) - 2 * a->x[i] * a->x[i + 1] + (a->x[i + 1] * a->x[i + 1])));
 
     return sum;
 }
@@ -1798,7 +1809,7 @@ double Paviani(Agent *a, va_list arg)
     for (i = 0; i < a->n; i++)
     {
         prod *= a->x[i];
-        sum += pow(log(a->x[i] - 2), 2) + pow(log(10 - a->x[i]), 2);
+        sum += Square(log(a->x[i] - 2)) + Square(log(10 - a->x[i]));
     }
 
     sum = sum - pow(prod, 0.2);
@@ -1828,7 +1839,7 @@ double Periodic(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 1 + pow(sin(a->x[0]), 2) + pow(sin(a->x[1]), 2) - 0.1 * exp(-(pow(a->x[0], 2) + pow(a->x[1], 2)));
+    sum = 1 + Square(sin(a->x[0])) + Square(sin(a->x[1])) - 0.1 * exp(-((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -1884,7 +1895,7 @@ double Price_First(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(fabs(a->x[0]) - 5, 2) + pow(fabs(a->x[1]) - 5, 2);
+    sum = Square(fabs(a->x[0]) - 5) + Square(fabs(a->x[1]) - 5);
 
     return sum;
 }
@@ -1911,7 +1922,7 @@ double Price_Second(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 1 + pow(sin(a->x[0]), 2) + pow(sin(a->x[1]), 2) - 0.1 * exp(-pow(a->x[0], 2) - pow(a->x[1], 2));
+    sum = 1 + Square(sin(a->x[0])) + Square(sin(a->x[1])) - 0.1 * exp(-(a->x[0] * a->x[0]) - (a->x[1] * a->x[1]));
 
     return sum;
 }
@@ -1938,7 +1949,7 @@ double Price_Third(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 100 * pow(a->x[1] - pow(a->x[0], 2), 2) + 6 * pow(6.4 * pow(a->x[1] - 0.5, 2) - a->x[0] - 0.6, 2);
+    sum = 100 * Square(a->x[1] - (a->x[0] * a->x[0])) + 6 * Square(6.4 * Square(a->x[1] - 0.5) - a->x[0] - 0.6);
 
     return sum;
 }
@@ -1965,7 +1976,7 @@ double Price_Forth(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(2 * pow(a->x[0], 3) * a->x[1] - pow(a->x[1], 3), 2) + pow(6 * a->x[0] - pow(a->x[1], 2) + a->x[1], 2);
+    sum = Square(2 * pow(a->x[0], 3) * a->x[1] - pow(a->x[1], 3)) + Square(6 * a->x[0] - (a->x[1] * a->x[1]) + a->x[1]);
 
     return sum;
 }
@@ -1979,7 +1990,7 @@ Domain: -500 <= x_i <= 500 */
 double Qing(Agent *a, va_list arg)
 {
     int i;
-    double sum = 0;
+    double sum = 0, tmp;
 
     if (!a)
     {
@@ -1994,7 +2005,10 @@ double Qing(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += pow(pow(a->x[i], 2) - (i + 1), 2);
+    {
+        tmp = (a->x[i] * a->x[i]) - (i + 1);
+        sum += tmp * tmp;
+    }
 
     return sum;
 }
@@ -2021,7 +2035,7 @@ double Quadratic(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = -3803.84 - 138.08 * a->x[0] - 232.92 * a->x[1] + 128.08 * pow(a->x[0], 2) + 203.64 * pow(a->x[1], 2) + 182.25 * a->x[0] * a->x[1];
+    sum = -3803.84 - 138.08 * a->x[0] - 232.92 * a->x[1] + 128.08 * (a->x[0] * a->x[0]) + 203.64 * (a->x[1] * a->x[1]) + 182.25 * a->x[0] * a->x[1];
 
     return sum;
 }
@@ -2035,7 +2049,7 @@ Domain: -1.28 <= x_i <= 1.28 */
 double Quartic(Agent *a, va_list arg)
 {
     int i;
-    double sum = 0, u;
+    double sum = 0, u, tmp;
 
     if (!a)
     {
@@ -2050,7 +2064,10 @@ double Quartic(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += (i + 1) * pow(a->x[i], 4);
+    {
+        tmp = a->x[i] * a->x[i];
+        sum += (i + 1) * tmp * tmp;
+    }
 
     do
     {
@@ -2086,7 +2103,7 @@ double Quintic(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += fabs(pow(a->x[i], 5) - 3 * pow(a->x[i], 4) + 4 * pow(a->x[i], 3) + 2 * pow(a->x[i], 2) - 10 * a->x[i] - 4);
+        sum += fabs(pow(a->x[i], 5) - 3 * Square(Square(a->x[i])) + 4 * pow(a->x[i], 3) + 2 * (a->x[i] * a->x[i]) - 10 * a->x[i] - 4);
 
     return sum;
 }
@@ -2117,7 +2134,7 @@ double Rastrigin(Agent *a, va_list arg)
     sum = 10 * a->n;
 
     for (i = 0; i < a->n; i++)
-        sum += pow(a->x[i], 2) - 10 * cos(2 * M_PI * a->x[i]);
+        sum += (a->x[i] * a->x[i]) - 10 * cos(2 * M_PI * a->x[i]);
 
     return sum;
 }
@@ -2131,7 +2148,7 @@ Domain: -30 <= x_i <= 30 */
 double Rosenbrock(Agent *a, va_list arg)
 {
     int i;
-    double sum = 0;
+    double sum = 0, tmp;
 
     if (!a)
     {
@@ -2146,7 +2163,10 @@ double Rosenbrock(Agent *a, va_list arg)
     }
 
     for (i = 0; i < (a->n - 1); i++)
-        sum += 100 * (pow(a->x[i + 1] - pow(a->x[i], 2), 2)) + pow(a->x[i] - 1, 2);
+    {
+        tmp = a->x[i + 1] - (a->x[i] * a->x[i]);
+        sum += 100 * tmp * tmp + (a->x[i] - 1) * (a->x[i] - 1);
+    }
 
     return sum;
 }
@@ -2173,7 +2193,7 @@ double Rotated_Ellipsoid_1(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 7 * pow(a->x[0], 2) - 6 * sqrt(3) * a->x[0] * a->x[1] + 13 * pow(a->x[1], 2);
+    sum = 7 * (a->x[0] * a->x[0]) - 6 * sqrt(3) * a->x[0] * a->x[1] + 13 * (a->x[1] * a->x[1]);
 
     return sum;
 }
@@ -2200,7 +2220,7 @@ double Rotated_Ellipsoid_2(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0], 2) - a->x[0] * a->x[1] + pow(a->x[1], 2);
+    sum = (a->x[0] * a->x[0]) - a->x[0] * a->x[1] + (a->x[1] * a->x[1]);
 
     return sum;
 }
@@ -2227,7 +2247,7 @@ double Rump(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = (333.75 - pow(a->x[0], 2)) * pow(a->x[1], 6) + pow(a->x[0], 2) * (11 * pow(a->x[0], 2) * pow(a->x[1], 2) - 121 * pow(a->x[1], 4) - 2) + 5.5 * pow(a->x[1], 8) + (a->x[0]) / (2 * a->x[1]);
+    sum = (333.75 - (a->x[0] * a->x[0])) * pow(a->x[1], 6) + (a->x[0] * a->x[0]) * (11 * (a->x[0] * a->x[0]) * (a->x[1] * a->x[1]) - 121 * Square(Square(a->x[1])) - 2) + 5.5 * pow(a->x[1], 8) + (a->x[0]) / (2 * a->x[1]);
 
     return sum;
 }
@@ -2256,7 +2276,7 @@ double Salomon(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        partial_sum += pow(a->x[i], 2);
+        partial_sum += (a->x[i] * a->x[i]);
 
     sum = 1 - cos(2 * M_PI * sqrt(partial_sum)) + 0.1 * sqrt(partial_sum);
 
@@ -2285,7 +2305,7 @@ double Schaffer_First(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 0.5 + (pow(sin(pow(pow(a->x[0], 2) + pow(a->x[1], 2), 2)), 2) - 0.5) / (1 + 0.001 * pow(pow(a->x[0], 2) + pow(a->x[1], 2), 2));
+    sum = 0.5 + (Square(sin(Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])))) - 0.5) / (1 + 0.001 * Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -2312,7 +2332,7 @@ double Schaffer_Second(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 0.5 + (pow(sin(pow(pow(a->x[0], 2) - pow(a->x[1], 2), 2)), 2) - 0.5) / (1 + 0.001 * pow(pow(a->x[0], 2) + pow(a->x[1], 2), 2));
+    sum = 0.5 + (Square(sin(Square((a->x[0] * a->x[0]) - (a->x[1] * a->x[1])))) - 0.5) / (1 + 0.001 * Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -2339,7 +2359,7 @@ double Schaffer_Third(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 0.5 + (pow(sin(cos(fabs(pow(a->x[0], 2) - pow(a->x[1], 2)))), 2) - 0.5) / (1 + 0.001 * pow(pow(a->x[0], 2) + pow(a->x[1], 2), 2));
+    sum = 0.5 + (Square(sin(cos(fabs((a->x[0] * a->x[0]) - (a->x[1] * a->x[1]))))) - 0.5) / (1 + 0.001 * Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -2366,7 +2386,7 @@ double Schaffer_Forth(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 0.5 + (pow(cos(sin(pow(a->x[0], 2) - pow(a->x[1], 2))), 2) - 0.5) / (1 + 0.001 * pow(pow(a->x[0], 2) + pow(a->x[1], 2), 2));
+    sum = 0.5 + (Square(cos(sin((a->x[0] * a->x[0]) - (a->x[1] * a->x[1])))) - 0.5) / (1 + 0.001 * Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -2393,7 +2413,7 @@ double Schmidt_Vetters(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 1 / (1 + pow(a->x[0] - a->x[1], 2)) + sin((M_PI * a->x[1] + a->x[2]) / 2) + exp(pow((a->x[0] + a->x[1]) / a->x[1] - 2, 2));
+    sum = 1 / (1 + Square(a->x[0] - a->x[1])) + sin((M_PI * a->x[1] + a->x[2]) / 2) + exp(Square((a->x[0] + a->x[1]) / a->x[1] - 2));
 
     return sum;
 }
@@ -2407,7 +2427,7 @@ Domain: -100 <= x_i <= 100 */
 double Schumer_Steiglitz(Agent *a, va_list arg)
 {
     int i;
-    double sum = 0;
+    double sum = 0, tmp;
 
     if (!a)
     {
@@ -2422,7 +2442,10 @@ double Schumer_Steiglitz(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += pow(a->x[i], 4);
+    {
+        tmp = a->x[i] * a->x[i];
+        sum += tmp * tmp;
+    }
 
     return sum;
 }
@@ -2451,7 +2474,7 @@ double Schewefel(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += pow(a->x[i], 2);
+        sum += (a->x[i] * a->x[i]);
 
     alpha = sqrt(M_PI);
 
@@ -2484,7 +2507,7 @@ double Sphere(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += pow(a->x[i], 2);
+        sum += (a->x[i] * a->x[i]);
 
     return sum;
 }
@@ -2513,7 +2536,7 @@ double Streched_V_SineWave(Agent *a, va_list arg)
     }
 
     for (i = 0; i < (a->n - 1); i++)
-        sum += pow(pow(a->x[i + 1], 2) + pow(a->x[i], 2), 0.25) * (pow(sin(50 * pow(pow(a->x[i + 1], 2) + pow(a->x[i], 2), 0.1)), 2) + 0.1);
+        sum += pow((a->x[i + 1] * a->x[i + 1]) + (a->x[i] * a->x[i]), 0.25) * (Square(sin(50 * pow((a->x[i + 1] * a->x[i + 1]) + (a->x[i] * a->x[i]), 0.1))) + 0.1);
 
     return sum;
 }
@@ -2571,7 +2594,7 @@ double Sum_Squares(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += (i + 1) * pow(a->x[i], 2);
+        sum += (i + 1) * (a->x[i] * a->x[i]);
 
     return sum;
 }
@@ -2585,7 +2608,7 @@ Domain:  -5 <= x_i <= 5 */
 double Styblinski_Tang(Agent *a, va_list arg)
 {
     int i;
-    double sum = 0;
+    double sum = 0, tmp;
 
     if (!a)
     {
@@ -2600,7 +2623,10 @@ double Styblinski_Tang(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += pow(a->x[i], 4) - 16 * pow(a->x[i], 2) + 5 * a->x[i];
+    {
+        tmp = a->x[i] * a->x[i];
+        sum += tmp * tmp - 16 * tmp + 5 * a->x[i];
+    }
 
     sum *= 0.5;
 
@@ -2683,7 +2709,7 @@ double Carrom_Table(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = -(1 / 30) * exp(2 * fabs(1 - (sqrt(pow(a->x[0], 2) + pow(a->x[1], 2)) / M_PI)) * pow(cos(a->x[0]), 2) * pow(cos(a->x[1]), 2));
+    sum = -(1 / 30) * exp(2 * fabs(1 - (sqrt((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])) / M_PI)) * Square(cos(a->x[0])) * Square(cos(a->x[1])));
 
     return sum;
 }
@@ -2710,7 +2736,7 @@ double Testtube_Holder(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = -4 * (sin(a->x[0]) * cos(a->x[1]) * exp(fabs(cos(pow(a->x[0], 2) + pow(a->x[1], 2)) / 200)));
+    sum = -4 * (sin(a->x[0]) * cos(a->x[1]) * exp(fabs(cos((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])) / 200)));
 
     return sum;
 }
@@ -2737,7 +2763,7 @@ double Trecanni(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0], 4) - 4 * pow(a->x[0], 3) + 4 * a->x[0] + pow(a->x[1], 2);
+    sum = Square(Square(a->x[0])) - 4 * pow(a->x[0], 3) + 4 * a->x[0] + (a->x[1] * a->x[1]);
 
     return sum;
 }
@@ -2764,7 +2790,7 @@ double Trefethen(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = exp(sin(50 * a->x[0])) + sin(60 * exp(a->x[1])) + sin(70 * sin(a->x[0])) + sin(sin(80 * a->x[1])) - sin(10 * (a->x[0] + a->x[1])) + ((1 / 4) * (pow(a->x[0], 2) + pow(a->x[1], 2)));
+    sum = exp(sin(50 * a->x[0])) + sin(60 * exp(a->x[1])) + sin(70 * sin(a->x[0])) + sin(sin(80 * a->x[1])) - sin(10 * (a->x[0] + a->x[1])) + ((1 / 4) * ((a->x[0] * a->x[0]) + (a->x[1] * a->x[1])));
 
     return sum;
 }
@@ -2795,7 +2821,7 @@ double Trigonometric_1(Agent *a, va_list arg)
     for (i = 0; i < a->n; i++)
         for (j = 0; j < a->n; j++)
             partial_sum += cos(a->x[j]);
-    sum += pow(a->n - partial_sum + (i + 1) * (1 - cos(a->x[i]) - sin(a->x[i])), 2);
+    sum += Square(a->n - partial_sum + (i + 1) * (1 - cos(a->x[i]) - sin(a->x[i])));
 
     return sum;
 }
@@ -2824,7 +2850,7 @@ double Trigonometric_2(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        partial_sum += 8 * pow(sin(7 * pow(a->x[i] - 0.9, 2)), 2) + 6 * pow(sin((14 * pow(a->x[0] - 0.9, 2))), 2) + pow(a->x[i] - 0.9, 2);
+        partial_sum += 8 * Square(sin(7 * Square(a->x[i] - 0.9))) + 6 * Square(sin((14 * Square(a->x[0] - 0.9)))) + Square(a->x[i] - 0.9);
 
     sum = 1 + partial_sum;
 
@@ -2853,7 +2879,7 @@ double Venter_Sobiezcczanski(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(a->x[0], 2) - 100 * cos(pow(a->x[0], 2)) - 100 * cos(pow(a->x[0], 2) / 30) + pow(a->x[1], 2) - 100 * cos(pow(a->x[1], 2)) - 100 * cos(pow(a->x[1], 2) / 30);
+    sum = (a->x[0] * a->x[0]) - 100 * cos((a->x[0] * a->x[0])) - 100 * cos((a->x[0] * a->x[0]) / 30) + (a->x[1] * a->x[1]) - 100 * cos((a->x[1] * a->x[1])) - 100 * cos((a->x[1] * a->x[1]) / 30);
 
     return sum;
 }
@@ -2889,7 +2915,7 @@ double Watson(Agent *a, va_list arg)
                 partial_sum_1 += ((j - 1) * pow((i / 29), j) * a->x[j + 1]);
             partial_sum_2 += pow((i / 29), j) * a->x[j + 1];
         }
-        sum += pow(partial_sum_1 - pow(partial_sum_2, 2) - 1, 2) + pow(a->x[0], 2);
+        sum += Square(partial_sum_1 - Square(partial_sum_2) - 1) + (a->x[0] * a->x[0]);
     }
 
     return sum;
@@ -2917,7 +2943,7 @@ double Wayburn_Seader_1(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow((pow(a->x[0], 6) + pow(a->x[1], 4) - 17), 2) + pow(((2 * a->x[0]) + a->x[1] - 4), 4);
+    sum = Square((pow(a->x[0], 6) + Square(Square(a->x[1])) - 17)) + Square(Square(((2 * a->x[0]) + a->x[1] - 4)));
 
     return sum;
 }
@@ -2944,7 +2970,7 @@ double Wayburn_Seader_2(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow((1.613 + (4 * pow((a->x[0] - 0.3125), 2)) - (4 * pow((a->x[1] - 1.625), 2))), 2) + pow((a->x[1] - 1), 2);
+    sum = Square((1.613 + (4 * Square((a->x[0] - 0.3125))) - (4 * Square((a->x[1] - 1.625))))) + Square((a->x[1] - 1));
 
     return sum;
 }
@@ -2971,7 +2997,7 @@ double Wayburn_Seader_3(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 2 * (pow(a->x[0], 3) / 3) - 8 * pow(a->x[0], 2) + 31 * a->x[0] - (a->x[0] * a->x[1]) + 5 + pow(pow((a->x[0] - 4), 2) + (pow((a->x[1] - 5), 2) - 4), 2);
+    sum = 2 * (pow(a->x[0], 3) / 3) - 8 * (a->x[0] * a->x[0]) + 31 * a->x[0] - (a->x[0] * a->x[1]) + 5 + Square(Square((a->x[0] - 4)) + (Square((a->x[1] - 5)) - 4));
 
     return sum;
 }
@@ -3000,9 +3026,9 @@ double Wavy(Agent *a, va_list arg)
     }
 
     for (i = 0; i < a->n; i++)
-        sum += cos(k * a->x[i]) * exp(-pow(a->x[i], 2) / 2);
+        sum += cos(k * a->x[i]) * exp(-(a->x[i] * a->x[i]) / 2);
 
-    sum = 1 - (1 / a->n) * sum;
+    sum = 1 - (1.0 / a->n) * sum;
 
     return sum;
 }
@@ -3065,7 +3091,7 @@ double XinShe_Yang_2(Agent *a, va_list arg)
     for (i = 0; i < a->n; i++)
     {
         sum1 += fabs(a->x[i]);
-        sum2 += sin(pow(a->x[i], 2));
+        sum2 += sin((a->x[i] * a->x[i]));
     }
 
     sum += (sum1)*exp(-sum2);
@@ -3099,8 +3125,8 @@ double XinShe_Yang_3(Agent *a, va_list arg)
     for (i = 0; i < a->n; i++)
     {
         sum1 += pow((a->x[i] / beta), 2 * m);
-        sum2 += pow(a->x[i], 2);
-        sum3 *= pow(cos(a->x[i]), 2);
+        sum2 += (a->x[i] * a->x[i]);
+        sum3 *= Square(cos(a->x[i]));
     }
 
     sum = exp(-sum1) - (2 * exp(-sum2)) * sum3;
@@ -3133,9 +3159,9 @@ double XinShe_Yang_4(Agent *a, va_list arg)
 
     for (i = 0; i < a->n; i++)
     {
-        sum1 += pow(sin(a->x[i]), 2);
-        sum2 += pow(a->x[i], 2);
-        sum3 += pow(sin(sqrt(fabs(a->x[i]))), 2);
+        sum1 += Square(sin(a->x[i]));
+        sum2 += (a->x[i] * a->x[i]);
+        sum3 += Square(sin(sqrt(fabs(a->x[i]))));
     }
 
     sum = (sum1 - exp(-sum2)) * exp(-sum3);
@@ -3168,11 +3194,11 @@ double Zakharov(Agent *a, va_list arg)
 
     for (i = 0; i < a->n; i++)
     {
-        sum1 += pow(a->x[i], 2);
+        sum1 += (a->x[i] * a->x[i]);
         sum2 += (i + 1) * a->x[i];
     }
 
-    sum = sum1 + pow(0.5 * sum2, 2) + pow(0.5 * sum2, 4);
+    sum = sum1 + Square(0.5 * sum2) + Square(Square(0.5 * sum2));
 
     return sum;
 }
@@ -3199,7 +3225,7 @@ double Zettl(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = pow(pow(a->x[0], 2) + pow(a->x[1], 2) - 2 * a->x[0], 2) + 0.25 * a->x[0];
+    sum = Square((a->x[0] * a->x[0]) + (a->x[1] * a->x[1]) - 2 * a->x[0]) + 0.25 * a->x[0];
 
     return sum;
 }
@@ -3226,12 +3252,599 @@ double Zirilli(Agent *a, va_list arg)
         return DBL_MAX;
     }
 
-    sum = 0.25 * pow(a->x[0], 4) - 0.5 * pow(a->x[0], 2) + 0.1 * a->x[0] + 0.5 * pow(a->x[1], 2);
+    sum = 0.25 * Square(Square(a->x[0])) - 0.5 * (a->x[0] * a->x[0]) + 0.1 * a->x[0] + 0.5 * (a->x[1] * a->x[1]);
 
     return sum;
 }
 /***********************/
 
+/* Batch benchmark functions
+These functions evaluate a contiguous block X of m agents, each one with n decision variables stored row-wise (agent i starts at X[i*n]),
+and write the fitness of agent i into f[i]. The input checks are performed once per block, and integer powers are expanded as products,
+so that the inner loops can be vectorized by the compiler (e.g., -O3 -fopenmp-simd, plus -ffast-math to use the libm vector routines). */
+
+/* It checks the input of a batch function
+Parameters:
+X: block of agents
+m: number of agents
+n: number of decision variables
+f: output fitness values
+min_n: minimum number of decision variables required by the function
+name: name of the function */
+static int CheckBatchInput(double *X, int m, int n, double *f, int min_n, const char *name)
+{
+    if (!X || !f)
+    {
+        fprintf(stderr, "\nBlock of agents not allocated @%s_Batch.\n", name);
+        return 0;
+    }
+
+    if (m < 1 || n < min_n)
+    {
+        fprintf(stderr, "\nInvalid number of agents or decision variables @%s_Batch.\n", name);
+        return 0;
+    }
+
+    return 1;
+}
+
+/* It computes the 1st Ackley's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Ackley_First_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double alpha = 20, beta = 0.02, gamma = 2 * M_PI, inv_n;
+    double sum_1, sum_2, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Ackley_First"))
+        return;
+
+    inv_n = 1.0 / n;
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum_1 = sum_2 = 0;
+#pragma omp simd reduction(+ : sum_1, sum_2)
+        for (j = 0; j < n; j++)
+        {
+            sum_1 += x[j] * x[j];
+            sum_2 += cos(gamma * x[j]);
+        }
+        f[i] = -alpha * exp(-beta * sqrt(inv_n * sum_1)) - exp(inv_n * sum_2) + alpha + exp(1);
+    }
+}
+
+/* It computes the 1st Alpine's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Alpine_First_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Alpine_First"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (j = 0; j < n; j++)
+            sum += fabs(x[j] * sin(x[j]) + 0.1 * x[j]);
+        f[i] = sum;
+    }
+}
+
+/* It computes the Chung Reynolds' function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Chung_Reynolds_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Chung_Reynolds"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (j = 0; j < n; j++)
+            sum += x[j] * x[j];
+        f[i] = sum * sum;
+    }
+}
+
+/* It computes the Dixon's-Price function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Dixon_Price_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, tmp, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Dixon_Price"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = (x[0] - 1) * (x[0] - 1);
+#pragma omp simd reduction(+ : sum) private(tmp)
+        for (j = 1; j < n; j++)
+        {
+            tmp = 2 * x[j] * x[j] - x[j - 1];
+            sum += (j + 1) * tmp * tmp;
+        }
+        f[i] = sum;
+    }
+}
+
+/* It computes the Exponential function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Exponential_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Exponential"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (j = 0; j < n; j++)
+            sum += x[j] * x[j];
+        f[i] = -exp(-0.5 * sum);
+    }
+}
+
+/* It computes the Griewank's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Griewank_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, partial_sum, *x, *inv_sqrt = NULL;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Griewank"))
+        return;
+
+    /* 1/sqrt(j+1) does not depend on the agent, so it is computed once per block */
+    inv_sqrt = (double *)malloc(n * sizeof(double));
+    if (!inv_sqrt)
+    {
+        fprintf(stderr, "\nCannot allocate the coefficient buffer @Griewank_Batch.\n");
+        return;
+    }
+    for (j = 0; j < n; j++)
+        inv_sqrt[j] = 1.0 / sqrt(j + 1);
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+        partial_sum = 1;
+#pragma omp simd reduction(+ : sum) reduction(* : partial_sum)
+        for (j = 0; j < n; j++)
+        {
+            partial_sum *= cos(x[j] * inv_sqrt[j]) + 1;
+            sum += x[j] * x[j];
+        }
+        f[i] = sum / 4000 - partial_sum;
+    }
+
+    free(inv_sqrt);
+}
+
+/* It computes the Qing's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Qing_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, tmp, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Qing"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum) private(tmp)
+        for (j = 0; j < n; j++)
+        {
+            tmp = x[j] * x[j] - (j + 1);
+            sum += tmp * tmp;
+        }
+        f[i] = sum;
+    }
+}
+
+/* It computes the Rastrigin's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Rastrigin_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Rastrigin"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 10 * n;
+#pragma omp simd reduction(+ : sum)
+        for (j = 0; j < n; j++)
+            sum += x[j] * x[j] - 10 * cos(2 * M_PI * x[j]);
+        f[i] = sum;
+    }
+}
+
+/* It computes the Rosenbrock's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Rosenbrock_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, tmp, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 2, "Rosenbrock"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum) private(tmp)
+        for (j = 0; j < n - 1; j++)
+        {
+            tmp = x[j + 1] - x[j] * x[j];
+            sum += 100 * tmp * tmp + (x[j] - 1) * (x[j] - 1);
+        }
+        f[i] = sum;
+    }
+}
+
+/* It computes the Salomon's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Salomon_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Salomon"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (j = 0; j < n; j++)
+            sum += x[j] * x[j];
+        sum = sqrt(sum);
+        f[i] = 1 - cos(2 * M_PI * sum) + 0.1 * sum;
+    }
+}
+
+/* It computes the Schumer Steiglitz's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Schumer_Steiglitz_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, tmp, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Schumer_Steiglitz"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum) private(tmp)
+        for (j = 0; j < n; j++)
+        {
+            tmp = x[j] * x[j];
+            sum += tmp * tmp;
+        }
+        f[i] = sum;
+    }
+}
+
+/* It computes the Schewefel's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Schewefel_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, alpha = sqrt(M_PI), *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Schewefel"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (j = 0; j < n; j++)
+            sum += x[j] * x[j];
+        f[i] = pow(sum, alpha);
+    }
+}
+
+/* It computes the Sphere's function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Sphere_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Sphere"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (j = 0; j < n; j++)
+            sum += x[j] * x[j];
+        f[i] = sum;
+    }
+}
+
+/* It computes the Sum Squares function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Sum_Squares_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Sum_Squares"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (j = 0; j < n; j++)
+            sum += (j + 1) * x[j] * x[j];
+        f[i] = sum;
+    }
+}
+
+/* It computes the Styblinski's-Tang function over a block of agents
+Parameters:
+X: block of agents (m x n, row-wise)
+m: number of agents
+n: number of decision variables
+f: output fitness values (m) */
+void Styblinski_Tang_Batch(double *X, int m, int n, double *f)
+{
+    int i, j;
+    double sum, tmp, *x;
+
+    if (!CheckBatchInput(X, m, n, f, 1, "Styblinski_Tang"))
+        return;
+
+    for (i = 0; i < m; i++)
+    {
+        x = X + (size_t)i * n;
+        sum = 0;
+#pragma omp simd reduction(+ : sum) private(tmp)
+        for (j = 0; j < n; j++)
+        {
+            tmp = x[j] * x[j];
+            sum += tmp * tmp - 16 * tmp + 5 * x[j];
+        }
+        f[i] = 0.5 * sum;
+    }
+}
+/***********************/
+
+/* Benchmark function registry */
+/* It maps the name of each benchmark function to its scalar and batch (when available) implementations */
+static BenchmarkFunction BENCHMARK_FUNCTIONS[] = {
+    {"Ackley_First", Ackley_First, Ackley_First_Batch},
+    {"Ackley_Second", Ackley_Second, NULL},
+    {"Ackley_Third", Ackley_Third, NULL},
+    {"Adjiman", Adjiman, NULL},
+    {"Alpine_First", Alpine_First, Alpine_First_Batch},
+    {"Alpine_Second", Alpine_Second, NULL},
+    {"Bartels_Conn", Bartels_Conn, NULL},
+    {"Beale", Beale, NULL},
+    {"Biggs_EXP2", Biggs_EXP2, NULL},
+    {"Biggs_EXP3", Biggs_EXP3, NULL},
+    {"Biggs_EXP4", Biggs_EXP4, NULL},
+    {"Biggs_EXP5", Biggs_EXP5, NULL},
+    {"Biggs_EXP6", Biggs_EXP6, NULL},
+    {"Bird", Bird, NULL},
+    {"Bohachevsky_First", Bohachevsky_First, NULL},
+    {"Bohachevsky_Second", Bohachevsky_Second, NULL},
+    {"Bohachevsky_Third", Bohachevsky_Third, NULL},
+    {"Booth", Booth, NULL},
+    {"Box_Betts", Box_Betts, NULL},
+    {"Brent", Brent, NULL},
+    {"Brown", Brown, NULL},
+    {"Bukin_Second", Bukin_Second, NULL},
+    {"Bukin_Forth", Bukin_Forth, NULL},
+    {"Bukin_Sixth", Bukin_Sixth, NULL},
+    {"Three_HumpCamel", Three_HumpCamel, NULL},
+    {"Six_HumpCamel", Six_HumpCamel, NULL},
+    {"Chen_Bird", Chen_Bird, NULL},
+    {"Chen_V", Chen_V, NULL},
+    {"Chichinadze", Chichinadze, NULL},
+    {"Chung_Reynolds", Chung_Reynolds, Chung_Reynolds_Batch},
+    {"Colville", Colville, NULL},
+    {"Cross_Tray", Cross_Tray, NULL},
+    {"Csendes", Csendes, NULL},
+    {"Cube", Cube, NULL},
+    {"Damavandi", Damavandi, NULL},
+    {"Deckkers_Aarts", Deckkers_Aarts, NULL},
+    {"Dixon_Price", Dixon_Price, Dixon_Price_Batch},
+    {"Easom", Easom, NULL},
+    {"ElAttar_VidyasagarDutta", ElAttar_VidyasagarDutta, NULL},
+    {"Eggcrate", Eggcrate, NULL},
+    {"Eggholder", Eggholder, NULL},
+    {"Exponential", Exponential, Exponential_Batch},
+    {"EXP_2", EXP_2, NULL},
+    {"Freudenstein_Roth", Freudenstein_Roth, NULL},
+    {"Giunta", Giunta, NULL},
+    {"Goldstein_Price", Goldstein_Price, NULL},
+    {"Griewank", Griewank, Griewank_Batch},
+    {"Gulf_Research", Gulf_Research, NULL},
+    {"Helical_Valley", Helical_Valley, NULL},
+    {"Himmelblau", Himmelblau, NULL},
+    {"Hosaki", Hosaki, NULL},
+    {"Jennrick_Sampson", Jennrick_Sampson, NULL},
+    {"Keane", Keane, NULL},
+    {"Leon", Leon, NULL},
+    {"Levy", Levy, NULL},
+    {"Levy_Thirteenth", Levy_Thirteenth, NULL},
+    {"Matyas", Matyas, NULL},
+    {"McCormick", McCormick, NULL},
+    {"Miele_Cantrell", Miele_Cantrell, NULL},
+    {"Parsopoulos", Parsopoulos, NULL},
+    {"Pen_Holder", Pen_Holder, NULL},
+    {"Pathological", Pathological, NULL},
+    {"Paviani", Paviani, NULL},
+    {"Periodic", Periodic, NULL},
+    {"Powell_Sum", Powell_Sum, NULL},
+    {"Price_First", Price_First, NULL},
+    {"Price_Second", Price_Second, NULL},
+    {"Price_Third", Price_Third, NULL},
+    {"Price_Forth", Price_Forth, NULL},
+    {"Qing", Qing, Qing_Batch},
+    {"Quadratic", Quadratic, NULL},
+    {"Quartic", Quartic, NULL},
+    {"Quintic", Quintic, NULL},
+    {"Rastrigin", Rastrigin, Rastrigin_Batch},
+    {"Rosenbrock", Rosenbrock, Rosenbrock_Batch},
+    {"Rotated_Ellipsoid_1", Rotated_Ellipsoid_1, NULL},
+    {"Rotated_Ellipsoid_2", Rotated_Ellipsoid_2, NULL},
+    {"Rump", Rump, NULL},
+    {"Salomon", Salomon, Salomon_Batch},
+    {"Schaffer_First", Schaffer_First, NULL},
+    {"Schaffer_Second", Schaffer_Second, NULL},
+    {"Schaffer_Third", Schaffer_Third, NULL},
+    {"Schaffer_Forth", Schaffer_Forth, NULL},
+    {"Schmidt_Vetters", Schmidt_Vetters, NULL},
+    {"Schumer_Steiglitz", Schumer_Steiglitz, Schumer_Steiglitz_Batch},
+    {"Schewefel", Schewefel, Schewefel_Batch},
+    {"Sphere", Sphere, Sphere_Batch},
+    {"Streched_V_SineWave", Streched_V_SineWave, NULL},
+    {"Sum_DifferentPowers", Sum_DifferentPowers, NULL},
+    {"Sum_Squares", Sum_Squares, Sum_Squares_Batch},
+    {"Styblinski_Tang", Styblinski_Tang, Styblinski_Tang_Batch},
+    {"Holder_Table_First", Holder_Table_First, NULL},
+    {"Holder_Table_Second", Holder_Table_Second, NULL},
+    {"Carrom_Table", Carrom_Table, NULL},
+    {"Testtube_Holder", Testtube_Holder, NULL},
+    {"Trecanni", Trecanni, NULL},
+    {"Trefethen", Trefethen, NULL},
+    {"Trigonometric_1", Trigonometric_1, NULL},
+    {"Trigonometric_2", Trigonometric_2, NULL},
+    {"Venter_Sobiezcczanski", Venter_Sobiezcczanski, NULL},
+    {"Watson", Watson, NULL},
+    {"Wayburn_Seader_1", Wayburn_Seader_1, NULL},
+    {"Wayburn_Seader_2", Wayburn_Seader_2, NULL},
+    {"Wayburn_Seader_3", Wayburn_Seader_3, NULL},
+    {"Wavy", Wavy, NULL},
+    {"XinShe_Yang_1", XinShe_Yang_1, NULL},
+    {"XinShe_Yang_2", XinShe_Yang_2, NULL},
+    {"XinShe_Yang_3", XinShe_Yang_3, NULL},
+    {"XinShe_Yang_4", XinShe_Yang_4, NULL},
+    {"Zakharov", Zakharov, NULL},
+    {"Zettl", Zettl, NULL},
+    {"Zirilli", Zirilli, NULL},
+    {NULL, NULL, NULL}};
+
+/* It returns the registry entry of a benchmark function given its name, or NULL if it does not exist
+Parameters:
+name: name of the function (e.g., "Sphere") */
+BenchmarkFunction *GetBenchmarkFunction(const char *name)
+{
+    int i;
+
+    if (!name)
+    {
+        fprintf(stderr, "\nInvalid function name @GetBenchmarkFunction.\n");
+        return NULL;
+    }
+
+    for (i = 0; BENCHMARK_FUNCTIONS[i].name; i++)
+        if (!strcmp(BENCHMARK_FUNCTIONS[i].name, name))
+            return &BENCHMARK_FUNCTIONS[i];
+
+    return NULL;
+}
+
+/* It returns the number of benchmark functions in the registry */
+int GetNumberOfBenchmarkFunctions()
+{
+    return (int)(sizeof(BENCHMARK_FUNCTIONS) / sizeof(BenchmarkFunction)) - 1;
+}
+/*****************************/
+
 /* Genetic Programming general-purpose functions */
 /* It computes the pointwise sum of two n-dimensional arrays
 Parameters:
@@ -1,6 +1,9 @@
 #include "ga.h"
 
-/* It executes the Genetic Algorithm for function minimization
+/* It executes the Genetic Algorithm for function minimization. Parents are drawn by roulette (s->selection = _ROULETTE_), in which
+the weight of an agent is 1 / (1 + fit - min_fit), or by tournaments of s->tournament_size agents (s->selection = _TOURNAMENT_).
+Offspring are written into a second population, which takes the place of the current one by swapping pointers, and the roulette
+is a sampler rebuilt in O(m) at each generation, so the generation loop does not allocate memory.
 Parameters:
 s: search space
 Evaluate: pointer to the function used to evaluate chromosomes
@@ -9,10 +12,11 @@ arg: list of additional arguments */
 void runGA(SearchSpace *s, prtFun Evaluate, ...)
 {
 	va_list arg, argtmp;
-	int i, j, k, t;
-	int *selection = NULL;
+	int i, k, t, p1, p2;
 	int crossover_index, mutation_index;
-	double **tmp;
+	double min, *w = NULL;
+	Agent **offspring = NULL, *tmp = NULL;
+	Sampler *roulette = NULL;
 
 	va_start(arg, Evaluate);
 	va_copy(argtmp, arg);
@@ -23,54 +27,170 @@ void runGA(SearchSpace *s, prtFun Evaluate, ...)
 		exit(-1);
 	}
 
+	if (s->is_binary_opt)
+	{
+		fprintf(stderr, "\nBinary search spaces must be optimized by runBGA @runGA.\n");
+		exit(-1);
+	}
+
+	ResetTermination(s); /* It starts counting evaluations, time and stagnation */
 	EvaluateSearchSpace(s, _GA_, Evaluate, arg); /* Initial evaluation of the search space */
-	
-	tmp = (double **)calloc(s->m, sizeof(double *));
+
+	offspring = (Agent **)malloc(s->m * sizeof(Agent *));
 	for(i = 0; i < s->m; i++)
-		tmp[i] = (double *)calloc(s->n, sizeof(double));
+		offspring[i] = CreateAgent(s->n, _GA_, _NOTENSOR_);
 
-	for (t = 1; t <= s->iterations; t++)
+	if(s->selection == _ROULETTE_)
+	{
+		w = (double *)malloc(s->m * sizeof(double));
+		roulette = CreateSampler(s->m);
+	}
+
+	for (t = 1; !StopOptimization(s, t); t++)
 	{
 		fprintf(stderr, "\nRunning generation %d/%d ... ", t, s->iterations);
+		va_copy(arg, argtmp);
 
-		/* It performs the selection */
-		selection = RouletteSelectionGA(s, s->m);
+		/* It sets up the roulette */
+		if(roulette)
+		{
+			min = DBL_MAX;
+			for(i = 0; i < s->m; i++)
+				min = s->a[i]->fit < min ? s->a[i]->fit : min;
+			for(i = 0; i < s->m; i++)
+				w[i] = 1 / (1 + s->a[i]->fit - min);
+			BuildSampler(roulette, w, s->m);
+		}
 
-		/* It performs the crossover */
-		for(i = 0; i < s->m / 2; i += 2)
+		/* It performs the selection and the crossover */
+		for(i = 0; i < s->m; i += 2)
 		{
+			p1 = roulette ? DrawSampler(roulette) : TournamentSelection(s, s->tournament_size);
+			p2 = roulette ? DrawSampler(roulette) : TournamentSelection(s, s->tournament_size);
 			crossover_index = (int) GenerateUniformRandomNumber(0, s->n);
 
 			for(k = 0; k < s->n; k++)
 			{
-				if(k < crossover_index)
-				{
-					tmp[i][k] = s->a[selection[i]]->x[k];
-					tmp[i+1][k] = s->a[selection[i+1]]->x[k];
-				}
-				else
-				{
-					tmp[i][k] = s->a[selection[i+1]]->x[k];
-					tmp[i+1][k] = s->a[selection[i]]->x[k];
-				}
+				offspring[i]->x[k] = (k < crossover_index) ? s->a[p1]->x[k] : s->a[p2]->x[k];
+				if(i + 1 < s->m) /* the last agent of an odd population gets a single offspring */
+					offspring[i + 1]->x[k] = (k < crossover_index) ? s->a[p2]->x[k] : s->a[p1]->x[k];
+			}
+		}
 
+		/* It performs the mutation */
+		for(i = 0; i < s->m; i++)
+		{
+			if(GenerateUniformRandomNumber(0, 1) <= s->pMutation)
+			{
+				mutation_index = (int) GenerateUniformRandomNumber(0, s->n);
+				offspring[i]->x[mutation_index] = GenerateUniformRandomNumber(s->LB[mutation_index], s->UB[mutation_index]);
 			}
 		}
 
-		if(s->m % 2 != 0)
+		/* It changes the generation */
+		for(i = 0; i < s->m; i++)
 		{
+			tmp = s->a[i];
+			s->a[i] = offspring[i];
+			offspring[i] = tmp;
+			s->a[i]->fit = DBL_MAX; /* the fitness value of the parent that owned the buffer does not apply */
+			s->a[i]->cv = s->n_constraints ? DBL_MAX : 0;
+		}
+
+		EvaluateSearchSpace(s, _GA_, Evaluate, arg);
+	}
+
+	fprintf(stderr, "\nOK (minimum fitness value %lf)\n", s->gfit);
+
+	for(i = 0; i < s->m; i++)
+		DestroyAgent(&offspring[i], _GA_);
+	free(offspring);
+	if(roulette)
+	{
+		DestroySampler(&roulette);
+		free(w);
+	}
+
+	va_end(arg);
+}
+
+/* It executes the Binary Genetic Algorithm for function minimization, which follows runGA on a binary search space
+(see SetBinarySearchSpace): the one-point crossover copies whole words of the parents, and the mutation flips a bit.
+The fitness function reads the position of each agent at a->b.
+Parameters:
+s: search space
+Evaluate: pointer to the function used to evaluate particles
+arg: list of additional arguments */
+void runBGA(SearchSpace *s, prtFun Evaluate, ...)
+{
+	va_list arg, argtmp;
+	int i, t, p1, p2, words, cw;
+	int crossover_index, mutation_index;
+	double min, *w = NULL;
+	uint64_t mask, *b1 = NULL, *b2 = NULL;
+	Agent **offspring = NULL, *tmp = NULL;
+	Sampler *roulette = NULL;
+
+	va_start(arg, Evaluate);
+	va_copy(argtmp, arg);
+
+	if (!s || !s->is_binary_opt)
+	{
+		fprintf(stderr, "\nBinary search space not allocated @runBGA.\n");
+		exit(-1);
+	}
+
+	words = getBinaryWords(s->n);
+
+	ResetTermination(s); /* It starts counting evaluations, time and stagnation */
+	EvaluateBinarySearchSpace(s, Evaluate, arg); /* Initial evaluation of the search space */
+
+	offspring = (Agent **)malloc(s->m * sizeof(Agent *));
+	for(i = 0; i < s->m; i++)
+		offspring[i] = CopyAgent(s->a[i], _GA_, _NOTENSOR_);
+	PlaceAgents(s, offspring, s->m); /* offspring i takes the place of agent i, so it goes to the same node */
+
+	if(s->selection == _ROULETTE_)
+	{
+		w = (double *)malloc(s->m * sizeof(double));
+		roulette = CreateSampler(s->m);
+	}
+
+	for (t = 1; !StopOptimization(s, t); t++)
+	{
+		fprintf(stderr, "\nRunning generation %d/%d ... ", t, s->iterations);
+		va_copy(arg, argtmp);
+
+		/* It sets up the roulette */
+		if(roulette)
+		{
+			min = DBL_MAX;
+			for(i = 0; i < s->m; i++)
+				min = s->a[i]->fit < min ? s->a[i]->fit : min;
+			for(i = 0; i < s->m; i++)
+				w[i] = 1 / (1 + s->a[i]->fit - min);
+			BuildSampler(roulette, w, s->m);
+		}
+
+		/* It performs the selection and the crossover */
+		for(i = 0; i < s->m; i += 2)
+		{
+			p1 = roulette ? DrawSampler(roulette) : TournamentSelection(s, s->tournament_size);
+			p2 = roulette ? DrawSampler(roulette) : TournamentSelection(s, s->tournament_size);
 			crossover_index = (int) GenerateUniformRandomNumber(0, s->n);
+			cw = crossover_index / BINARY_WORD_SIZE; /* word of the crossover point */
+			mask = ((uint64_t)1 << (crossover_index % BINARY_WORD_SIZE)) - 1; /* bits of that word before the crossover point */
 
-			for(k = 0; k < s->n; k++) 
+			b1 = s->a[p1]->b;
+			b2 = s->a[p2]->b;
+			memcpy(offspring[i]->b, b1, cw * sizeof(uint64_t));
+			offspring[i]->b[cw] = (b1[cw] & mask) | (b2[cw] & ~mask);
+			memcpy(offspring[i]->b + cw + 1, b2 + cw + 1, (words - cw - 1) * sizeof(uint64_t));
+			if(i + 1 < s->m) /* the last agent of an odd population gets a single offspring */
 			{
-				if(k < crossover_index)
-				{
-					tmp[s->m - 1][k] = s->a[selection[s->m - 1]]->x[k];
-				}
-				else
-				{
-					tmp[s->m - 1][k] = s->a[selection[0]]->x[k];
-				}
+				memcpy(offspring[i + 1]->b, b2, cw * sizeof(uint64_t));
+				offspring[i + 1]->b[cw] = (b2[cw] & mask) | (b1[cw] & ~mask);
+				memcpy(offspring[i + 1]->b + cw + 1, b1 + cw + 1, (words - cw - 1) * sizeof(uint64_t));
 			}
 		}
 
@@ -80,32 +200,224 @@ void runGA(SearchSpace *s, prtFun Evaluate, ...)
 			if(GenerateUniformRandomNumber(0, 1) <= s->pMutation)
 			{
 				mutation_index = (int) GenerateUniformRandomNumber(0, s->n);
-				tmp[i][mutation_index] = GenerateUniformRandomNumber(s->LB[mutation_index], s->UB[mutation_index]);
+				offspring[i]->b[mutation_index / BINARY_WORD_SIZE] ^= (uint64_t)1 << (mutation_index % BINARY_WORD_SIZE);
 			}
-
 		}
 
 		/* It changes the generation */
 		for(i = 0; i < s->m; i++)
 		{
-			for(j = 0; j < s->n; j++)
-			{
-				s->a[i]->x[j] = tmp[i][j];
-			}
+			tmp = s->a[i];
+			s->a[i] = offspring[i];
+			offspring[i] = tmp;
 		}
 
-		EvaluateSearchSpace(s, _GA_, Evaluate, arg);
-
-		free(selection);
+		EvaluateBinarySearchSpace(s, Evaluate, arg);
 	}
 
 	fprintf(stderr, "\nOK (minimum fitness value %lf)\n", s->gfit);
 
 	for(i = 0; i < s->m; i++)
-		free(tmp[i]);
+		DestroyAgent(&offspring[i], _GA_);
+	free(offspring);
+	if(roulette)
+	{
+		DestroySampler(&roulette);
+		free(w);
+	}
 
-	free(tmp);
+	va_end(arg);
+}
 
+/* It selects an agent by a binary tournament based on the crowded-comparison operator, i.e., the agent in the better front wins,
+and ties are broken by the larger crowding distance
+Parameters:
+rank: front of each agent
+dist: crowding distance of each agent
+m: number of agents */
+static int CrowdedTournament(int *rank, double *dist, int m)
+{
+	int i, k;
+
+	i = (int)GenerateUniformRandomNumber(0, m);
+	k = (int)GenerateUniformRandomNumber(0, m);
+
+	if ((rank[i] < rank[k]) || ((rank[i] == rank[k]) && (dist[i] > dist[k])))
+		return i;
+
+	return k;
+}
+
+/* It sorts a population by the crowded-comparison operator, so that its best m agents come first. Whole fronts are taken in
+order while they fit, and the first one that does not fit is sorted by decreasing crowding distance. The agents, their objectives,
+fronts and crowding distances are rearranged accordingly.
+Parameters:
+a: array of agents
+f: objectives of the agents (size x n_objectives, row-wise)
+size: number of agents
+m: number of agents that survive
+n_objectives: number of objectives
+rank: output array with the front of each agent
+dist: output array with the crowding distance of each agent within its front */
+static void SortPopulation(Agent **a, double *f, int size, int m, int n_objectives, int *rank, double *dist)
+{
+	int i, k, lo, hi, n_fronts, *order = NULL, *end = NULL, *rank_tmp = NULL;
+	double *f_tmp = NULL, *dist_tmp = NULL;
+	Agent **a_tmp = NULL;
+	Data *data = NULL;
+
+	order = (int *)malloc(size * sizeof(int));
+	end = (int *)calloc(size + 1, sizeof(int));
+	rank_tmp = (int *)malloc(size * sizeof(int));
+	dist_tmp = (double *)malloc(size * sizeof(double));
+	f_tmp = (double *)malloc((size_t)size * n_objectives * sizeof(double));
+	a_tmp = (Agent **)malloc(size * sizeof(Agent *));
+	data = (Data *)malloc(size * sizeof(Data));
+
+	n_fronts = FastNonDominatedSort(f, size, n_objectives, rank);
+
+	/* It groups the agents by front (counting sort), so front k is [end[k-1],end[k]) */
+	for (i = 0; i < size; i++)
+		end[rank[i] + 1]++;
+	for (k = 0; k < n_fronts; k++)
+		end[k + 1] += end[k];
+	for (i = 0; i < size; i++)
+		order[end[rank[i]]++] = i;
+
+	for (i = 0; i < size; i++)
+		dist[i] = 0;
+
+	for (k = 0, lo = 0; (k < n_fronts) && (lo < m); k++, lo = hi)
+	{
+		hi = end[k];
+		CrowdingDistance(f, order + lo, hi - lo, n_objectives, dist);
+		if (hi <= m)
+			continue;
+
+		for (i = lo; i < hi; i++)
+		{
+			data[i - lo].id = order[i];
+			data[i - lo].val = -dist[order[i]];
+		}
+		qsort(data, hi - lo, sizeof(Data), SortDataByVal);
+		for (i = lo; i < hi; i++)
+			order[i] = data[i - lo].id;
+	}
+
+	for (i = 0; i < size; i++)
+	{
+		a_tmp[i] = a[order[i]];
+		rank_tmp[i] = rank[order[i]];
+		dist_tmp[i] = dist[order[i]];
+		memcpy(f_tmp + (size_t)i * n_objectives, f + (size_t)order[i] * n_objectives, n_objectives * sizeof(double));
+	}
+	memcpy(a, a_tmp, size * sizeof(Agent *));
+	memcpy(rank, rank_tmp, size * sizeof(int));
+	memcpy(dist, dist_tmp, size * sizeof(double));
+	memcpy(f, f_tmp, (size_t)size * n_objectives * sizeof(double));
+
+	free(order);
+	free(end);
+	free(rank_tmp);
+	free(dist_tmp);
+	free(f_tmp);
+	free(a_tmp);
+	free(data);
+}
+
+/* It executes the Non-dominated Sorting Genetic Algorithm II for the minimization of several objectives. Parents are drawn by
+binary tournaments, and the offspring are created by the one-point crossover and mutation of runGA. Parents and offspring are
+then sorted together, and the best half survives. Every evaluated solution is offered to the archive of the search space
+(s->archive), which must be created beforehand and is the outcome of the run.
+Parameters:
+s: search space
+Evaluate: pointer to the function used to evaluate the objectives of chromosomes
+arg: list of additional arguments */
+void runNSGA2(SearchSpace *s, prtMOFun Evaluate, ...)
+{
+	va_list arg, argtmp;
+	int i, k, t, M, p1, p2;
+	int crossover_index, mutation_index, *rank = NULL;
+	double *f = NULL, *dist = NULL;
+	Agent **pool = NULL;
+
+	va_start(arg, Evaluate);
+	va_copy(argtmp, arg);
+
+	if (!s)
+	{
+		fprintf(stderr, "\nSearch space not allocated @runNSGA2.\n");
+		exit(-1);
+	}
+
+	if (!s->archive || (s->archive->n != s->n))
+	{
+		fprintf(stderr, "\nArchive not allocated or with a different number of decision variables @runNSGA2.\n");
+		exit(-1);
+	}
+
+	M = s->archive->n_objectives;
+	pool = (Agent **)malloc(2 * s->m * sizeof(Agent *)); /* parents followed by offspring */
+	for (i = 0; i < s->m; i++)
+	{
+		pool[i] = s->a[i];
+		pool[s->m + i] = CreateAgent(s->n, _GA_, _NOTENSOR_);
+	}
+	f = (double *)malloc((size_t)2 * s->m * M * sizeof(double));
+	rank = (int *)malloc(2 * s->m * sizeof(int));
+	dist = (double *)malloc(2 * s->m * sizeof(double));
+
+	ResetTermination(s); /* It starts counting evaluations, time and stagnation */
+	EvaluateObjectivesBatch(s, pool, s->m, Evaluate, f, arg); /* Initial evaluation of the search space */
+	SortPopulation(pool, f, s->m, s->m, M, rank, dist);
+
+	for (t = 1; !StopOptimization(s, t); t++)
+	{
+		fprintf(stderr, "\nRunning generation %d/%d ... ", t, s->iterations);
+		va_copy(arg, argtmp);
+
+		/* It performs the selection and the crossover */
+		for (i = 0; i < s->m; i += 2)
+		{
+			p1 = CrowdedTournament(rank, dist, s->m);
+			p2 = CrowdedTournament(rank, dist, s->m);
+			crossover_index = (int) GenerateUniformRandomNumber(0, s->n);
+
+			for (k = 0; k < s->n; k++)
+			{
+				pool[s->m + i]->x[k] = (k < crossover_index) ? pool[p1]->x[k] : pool[p2]->x[k];
+				if (i + 1 < s->m)
+					pool[s->m + i + 1]->x[k] = (k < crossover_index) ? pool[p2]->x[k] : pool[p1]->x[k];
+			}
+		}
+
+		/* It performs the mutation */
+		for (i = s->m; i < 2 * s->m; i++)
+		{
+			if (GenerateUniformRandomNumber(0, 1) <= s->pMutation)
+			{
+				mutation_index = (int) GenerateUniformRandomNumber(0, s->n);
+				pool[i]->x[mutation_index] = GenerateUniformRandomNumber(s->LB[mutation_index], s->UB[mutation_index]);
+			}
+		}
+
+		EvaluateObjectivesBatch(s, pool + s->m, s->m, Evaluate, f + (size_t)s->m * M, arg);
+
+		/* It keeps the best half of parents and offspring */
+		SortPopulation(pool, f, 2 * s->m, s->m, M, rank, dist);
+
+		fprintf(stderr, "OK (%d non-dominated solutions)", s->archive->size);
+	}
+
+	for (i = 0; i < s->m; i++)
+	{
+		s->a[i] = pool[i];
+		DestroyAgent(&pool[s->m + i], _GA_);
+	}
 
+	free(pool);
+	free(f);
+	free(rank);
+	free(dist);
 	va_end(arg);
-}
\ No newline at end of file
+}
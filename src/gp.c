@@ -15,6 +15,7 @@ limitations under the License.
 
 
 #include "gp.h"
+#include "jit.h"
 
 /* It executes the Binary Geometric Semantic Genetic Programming for function minimization
 Parameters:
@@ -39,11 +40,12 @@ void runBGSGP(SearchSpace *s, prtFun Evaluate, ...)
 		exit(-1);
 	}
 
+	ResetTermination(s); /* It starts counting evaluations, time and stagnation */
 	EvaluateSearchSpace(s, _GP_, Evaluate, arg); /* Initial evaluation */
 	tmpTree = (Node **)malloc(s->m * sizeof(Node *));
 	ShowSearchSpace(s, _GP_);
 
-	for (t = 1; t <= s->iterations; t++)
+	for (t = 1; !StopOptimization(s, t); t++)
 	{
 		fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -75,6 +77,11 @@ void runBGSGP(SearchSpace *s, prtFun Evaluate, ...)
 		{
 			DestroyTree(&s->T[j]);
 			s->T[j] = SGMB(s, tmpTree[mutation[z]]);
+			if (!IsTreeWithinLimits(s, s->T[j]))
+			{ /* an oversized offspring is replaced by its parent */
+				DestroyTree(&s->T[j]);
+				s->T[j] = CopyTree(tmpTree[mutation[z]]);
+			}
 			z++;
 		}
 
@@ -92,7 +99,10 @@ void runBGSGP(SearchSpace *s, prtFun Evaluate, ...)
 
 			aux = SGXB(s, tmpTree[crossover[father_cross_point]], tmpTree[crossover[mother_crosspoint]]);
 			DestroyTree(&(s->T[j]));
-			s->T[j] = CopyTree(aux);
+			if (IsTreeWithinLimits(s, aux))
+				s->T[j] = CopyTree(aux);
+			else /* an oversized offspring is replaced by the father */
+				s->T[j] = CopyTree(tmpTree[crossover[father_cross_point]]);
 			DestroyTree(&aux);
 			z++;
 		}
@@ -138,11 +148,12 @@ void runGSGP(SearchSpace *s, prtFun Evaluate, ...)
 		exit(-1);
 	}
 
+	ResetTermination(s); /* It starts counting evaluations, time and stagnation */
 	EvaluateSearchSpace(s, _GP_, Evaluate, arg); /* Initial evaluation */
 	tmpTree = (Node **)malloc(s->m * sizeof(Node *));
 	ShowSearchSpace(s, _GP_);
 
-	for (t = 1; t <= s->iterations; t++)
+	for (t = 1; !StopOptimization(s, t); t++)
 	{
 		fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -184,7 +195,10 @@ void runGSGP(SearchSpace *s, prtFun Evaluate, ...)
 
 			aux = SGME(s, tmpTree[crossover[father_cross_point]], tmpTree[crossover[mother_crosspoint]]);
 			DestroyTree(&s->T[j]);
-			s->T[j] = CopyTree(aux);
+			if (IsTreeWithinLimits(s, aux))
+				s->T[j] = CopyTree(aux);
+			else /* an oversized offspring is replaced by its parent */
+				s->T[j] = CopyTree(tmpTree[crossover[father_cross_point]]);
 			DestroyTree(&aux);
 			z++;
 		}
@@ -203,7 +217,10 @@ void runGSGP(SearchSpace *s, prtFun Evaluate, ...)
 
 			aux = SGXE(s, tmpTree[crossover[father_cross_point]], tmpTree[crossover[mother_crosspoint]]);
 			DestroyTree(&(s->T[j]));
-			s->T[j] = CopyTree(aux);
+			if (IsTreeWithinLimits(s, aux))
+				s->T[j] = CopyTree(aux);
+			else /* an oversized offspring is replaced by the father */
+				s->T[j] = CopyTree(tmpTree[crossover[father_cross_point]]);
 			DestroyTree(&aux);
 			z++;
 		}
@@ -226,39 +243,54 @@ void runGSGP(SearchSpace *s, prtFun Evaluate, ...)
 }
 /*************************/
 
-/* It executes the Genetic Programming for function minimization
+/* It evolves the trees of a GP/TGP search space. The trees are stored as linear trees during the optimization, and the
+population and its parents are swapped at each iteration instead of being copied. The trees are converted back to
+s->T at the end. If s->jit is set, the GP trees that survive several generations are executed as native code (see jit.h).
 Parameters:
 s: search space
+opt_id: _GP_ or _TGP_
 Evaluate: pointer to the function used to evaluate particles
 arg: list of additional arguments */
-void runGP(SearchSpace *s, prtFun Evaluate, ...)
+static void EvolveLinearForest(SearchSpace *s, int opt_id, prtFun Evaluate, va_list arg)
 {
-	va_list arg, argtmp;
+	va_list argtmp;
 	int t, i, j, z, n_reproduction, n_mutation, n_crossover;
 	int *reproduction = NULL, *mutation = NULL, *crossover = NULL;
 	int father_cross_point, mother_crosspoint, ctr;
-	double beta, prob;
-	Node **tmpTree = NULL, **aux = NULL;
+	LinearTree **tree = NULL, **tmpTree = NULL, **swap = NULL;
+	GPJit *jit = NULL;
 
-	va_start(arg, Evaluate);
 	va_copy(argtmp, arg);
 
-	if (!s)
+	tree = (LinearTree **)malloc(s->m * sizeof(LinearTree *));
+	tmpTree = (LinearTree **)malloc(s->m * sizeof(LinearTree *));
+	for (i = 0; i < s->m; i++)
 	{
-		fprintf(stderr, "\nSearch space not allocated @runGP.\n");
-		exit(-1);
+		tree[i] = CreateLinearTree(getSizeTree(s->T[i]));
+		Tree2LinearTree(s->T[i], tree[i]);
+		tmpTree[i] = CreateLinearTree(tree[i]->capacity);
 	}
 
-	EvaluateSearchSpace(s, _GP_, Evaluate, arg); /* Initial evaluation */
-	tmpTree = (Node **)malloc(s->m * sizeof(Node *));
-	ShowSearchSpace(s, _GP_);
+	if (s->jit && (opt_id == _GP_) && !s->is_binary_opt) /* binary trees are always run over bit-packed terminals */
+	{
+		jit = CreateGPJit();
+		s->tree_kernel = (prtTreeKernel *)calloc(s->m, sizeof(prtTreeKernel));
+		UpdateGPJit(jit, s, tree);
+	}
 
-	for (t = 1; t <= s->iterations; t++)
+	ResetTermination(s); /* It starts counting evaluations, time and stagnation */
+	EvaluateLinearForest(s, opt_id, tree, Evaluate, arg); /* Initial evaluation */
+	if (opt_id == _GP_)
+		ShowSearchSpace(s, _GP_);
+
+	for (t = 1; !StopOptimization(s, t); t++)
 	{
 		fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
-		for (i = 0; i < s->m; i++)
-			tmpTree[i] = CopyTree(s->T[i]);
+		/* The current trees become the parents, and the new ones overwrite the parents of the previous iteration */
+		swap = tmpTree;
+		tmpTree = tree;
+		tree = swap;
 
 		/* Calcultating the number of individuals to be reproducted */
 		n_reproduction = round(s->m * s->pReproduction);
@@ -274,20 +306,19 @@ void runGP(SearchSpace *s, prtFun Evaluate, ...)
 
 		/* It performs the reproduction */
 		for (i = 0; i < n_reproduction; i++)
-		{
-			DestroyTree(&s->T[i]);
-			s->T[i] = CopyTree(tmpTree[reproduction[i]]);
-		}
+			CopyLinearTree(tree[i], tmpTree[reproduction[i]]);
 
 		/* It performs the mutation */
 		z = 0;
 		for (j = n_reproduction; j < n_reproduction + n_mutation; j++)
 		{
-			DestroyTree(&s->T[j]);
-			if (getSizeTree(tmpTree[mutation[z]]) > 1)
-				s->T[j] = Mutation(s, tmpTree[mutation[z]], PROB_MUTATION_FUNCTION);
+			if (tmpTree[mutation[z]]->size > 1)
+				LinearMutation(s, tmpTree[mutation[z]], tree[j], PROB_MUTATION_FUNCTION);
 			else
-				s->T[j] = GROW(s, s->min_depth, s->max_depth);
+				GrowLinearTree(s, tree[j], s->min_depth, s->max_depth);
+
+			if (!IsLinearTreeWithinLimits(s, tree[j])) /* an oversized offspring is replaced by its parent */
+				CopyLinearTree(tree[j], tmpTree[mutation[z]]);
 			z++;
 		}
 
@@ -303,31 +334,22 @@ void runGP(SearchSpace *s, prtFun Evaluate, ...)
 				ctr++;
 			} while ((father_cross_point == mother_crosspoint) && (ctr <= 10));
 
-			if ((getSizeTree(tmpTree[crossover[father_cross_point]]) > 1) && (getSizeTree(tmpTree[crossover[mother_crosspoint]]) > 1))
-			{
-				aux = Crossover(tmpTree[crossover[father_cross_point]],
-								tmpTree[crossover[mother_crosspoint]], PROB_CROSSOVER_FUNCTION);
-				DestroyTree(&(s->T[j]));
-				s->T[j] = CopyTree(aux[0]);
-				if (j + 1 < n_reproduction + n_mutation + n_crossover)
-				{
-					DestroyTree(&(s->T[j + 1]));
-					s->T[j + 1] = CopyTree(aux[1]); /* in case of an odd number of samples to do crossover */
-				}
-				DestroyTree(&aux[0]);
-				DestroyTree(&aux[1]);
-				free(aux);
-			}
+			/* the second offspring is discarded in case of an odd number of samples to do crossover */
+			if ((tmpTree[crossover[father_cross_point]]->size > 1) && (tmpTree[crossover[mother_crosspoint]]->size > 1))
+				LinearCrossover(tmpTree[crossover[father_cross_point]], tmpTree[crossover[mother_crosspoint]],
+								tree[j], (j + 1 < n_reproduction + n_mutation + n_crossover) ? tree[j + 1] : NULL, PROB_CROSSOVER_FUNCTION);
 			else
 			{
-				DestroyTree(&(s->T[j]));
-				s->T[j] = CopyTree(tmpTree[crossover[father_cross_point]]);
+				CopyLinearTree(tree[j], tmpTree[crossover[father_cross_point]]);
 				if (j + 1 < n_reproduction + n_mutation + n_crossover)
-				{
-					DestroyTree(&(s->T[j + 1]));
-					s->T[j + 1] = CopyTree(tmpTree[crossover[mother_crosspoint]]); /* in case of an odd number of samples to do crossover */
-				}
+					CopyLinearTree(tree[j + 1], tmpTree[crossover[mother_crosspoint]]);
 			}
+
+			/* an oversized offspring is replaced by the parent it has taken its root from */
+			if (!IsLinearTreeWithinLimits(s, tree[j]))
+				CopyLinearTree(tree[j], tmpTree[crossover[father_cross_point]]);
+			if ((j + 1 < n_reproduction + n_mutation + n_crossover) && !IsLinearTreeWithinLimits(s, tree[j + 1]))
+				CopyLinearTree(tree[j + 1], tmpTree[crossover[mother_crosspoint]]);
 			z++;
 		}
 
@@ -335,16 +357,51 @@ void runGP(SearchSpace *s, prtFun Evaluate, ...)
 		free(mutation);
 		free(crossover);
 
-		for (i = 0; i < s->m; i++)
-			DestroyTree(&tmpTree[i]);
-
-		EvaluateSearchSpace(s, _GP_, Evaluate, arg);
+		if (jit)
+			UpdateGPJit(jit, s, tree);
+		EvaluateLinearForest(s, opt_id, tree, Evaluate, arg);
 
 		fprintf(stderr, "OK (minimum fitness value %lf) -> Best tree: %d.", s->gfit, s->best);
 		va_copy(arg, argtmp);
 	}
 
+	for (i = 0; i < s->m; i++)
+	{ /* It stores the final trees back in the search space */
+		DestroyTree(&s->T[i]);
+		s->T[i] = LinearTree2Tree(s, tree[i]);
+		DestroyLinearTree(&tree[i]);
+		DestroyLinearTree(&tmpTree[i]);
+	}
+	free(tree);
 	free(tmpTree);
+	if (jit)
+	{ /* the native code is unloaded along with the compiler */
+		free(s->tree_kernel);
+		s->tree_kernel = NULL;
+		DestroyGPJit(&jit);
+	}
+	va_end(argtmp);
+}
+
+/* It executes the Genetic Programming for function minimization
+Parameters:
+s: search space
+Evaluate: pointer to the function used to evaluate particles
+arg: list of additional arguments */
+void runGP(SearchSpace *s, prtFun Evaluate, ...)
+{
+	va_list arg;
+
+	va_start(arg, Evaluate);
+
+	if (!s)
+	{
+		fprintf(stderr, "\nSearch space not allocated @runGP.\n");
+		exit(-1);
+	}
+
+	EvolveLinearForest(s, _GP_, Evaluate, arg);
+
 	va_end(arg);
 }
 /*************************/
@@ -355,109 +412,17 @@ s: search space
 Evaluate: pointer to the function used to evaluate particles
 arg: list of additional arguments */
 void runTGP(SearchSpace *s, prtFun Evaluate, ...){
-	va_list arg, argtmp;
-	int t, i, j, z, n_reproduction, n_mutation, n_crossover;
-	int *reproduction = NULL, *mutation = NULL, *crossover = NULL;
-	int father_cross_point, mother_crosspoint, ctr;
-	double beta, prob;
-	Node **tmpTree = NULL, **aux = NULL;
+	va_list arg;
 
 	va_start(arg, Evaluate);
-	va_copy(argtmp, arg);
 
 	if (!s){
 		fprintf(stderr, "\nSearch space not allocated @runTGP.\n");
 		exit(-1);
 	}
-	
-	EvaluateSearchSpace(s, _TGP_, Evaluate, arg); /* Initial evaluation */
-	tmpTree = (Node **)malloc(s->m * sizeof(Node *));
-	
-	for (t = 1; t <= s->iterations; t++){
-		fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
-
-		for (i = 0; i < s->m; i++)
-			tmpTree[i] = CopyTree(s->T[i]);
-
-		/* Calcultating the number of individuals to be reproducted */
-		n_reproduction = round(s->m * s->pReproduction);
-		reproduction = RouletteSelection(s, n_reproduction);
-
-		/* Calcultating the number of individuals to be mutated */
-		n_mutation = round(s->m * s->pMutation);
-		mutation = RouletteSelection(s, n_mutation);
 
-		/* Calcultating the number of individuals to perform the crossover */
-		n_crossover = s->m - (n_reproduction + n_mutation);
-		crossover = RouletteSelection(s, n_crossover);
+	EvolveLinearForest(s, _TGP_, Evaluate, arg);
 
-		/* It performs the reproduction */
-		for (i = 0; i < n_reproduction; i++){
-			DestroyTree(&s->T[i]);
-			s->T[i] = CopyTree(tmpTree[reproduction[i]]);
-		}
-
-		/* It performs the mutation */
-		z = 0;
-		for (j = n_reproduction; j < n_reproduction + n_mutation; j++){
-			DestroyTree(&s->T[j]);
-			if (getSizeTree(tmpTree[mutation[z]]) > 1)
-				s->T[j] = Mutation(s, tmpTree[mutation[z]], PROB_MUTATION_FUNCTION);
-			else
-				s->T[j] = GROW(s, s->min_depth, s->max_depth);
-			z++;
-		}
-
-		/* It performs the crossover */
-		z = 0;
-		for (j = n_reproduction + n_mutation; j < n_reproduction + n_mutation + n_crossover; j += 2){
-			ctr = 1;
-			do{
-				father_cross_point = GenerateUniformRandomNumber(0, n_crossover);
-				mother_crosspoint = GenerateUniformRandomNumber(0, n_crossover);
-				ctr++;
-			} while ((father_cross_point == mother_crosspoint) && (ctr <= 10));
-
-			if ((getSizeTree(tmpTree[crossover[father_cross_point]]) > 1) && (getSizeTree(tmpTree[crossover[mother_crosspoint]]) > 1)){
-				aux = Crossover(tmpTree[crossover[father_cross_point]],
-								tmpTree[crossover[mother_crosspoint]], PROB_CROSSOVER_FUNCTION);
-				DestroyTree(&(s->T[j]));
-				s->T[j] = CopyTree(aux[0]);
-				if (j + 1 < n_reproduction + n_mutation + n_crossover)
-				{
-					DestroyTree(&(s->T[j + 1]));
-					s->T[j + 1] = CopyTree(aux[1]); /* in case of an odd number of samples to do crossover */
-				}
-				DestroyTree(&aux[0]);
-				DestroyTree(&aux[1]);
-				free(aux);
-			}
-			else{
-				DestroyTree(&(s->T[j]));
-				s->T[j] = CopyTree(tmpTree[crossover[father_cross_point]]);
-				if (j + 1 < n_reproduction + n_mutation + n_crossover)
-				{
-					DestroyTree(&(s->T[j + 1]));
-					s->T[j + 1] = CopyTree(tmpTree[crossover[mother_crosspoint]]); /* in case of an odd number of samples to do crossover */
-				}
-			}
-			z++;
-		}
-
-		free(reproduction);
-		free(mutation);
-		free(crossover);
-
-		for (i = 0; i < s->m; i++)
-			DestroyTree(&tmpTree[i]);
-
-		EvaluateSearchSpace(s, _TGP_, Evaluate, arg);
-
-		fprintf(stderr, "OK (minimum fitness value %lf) -> Best tree: %d.", s->gfit, s->best);
-		va_copy(arg, argtmp);
-	}
-	
-	free(tmpTree);
 	va_end(arg);
 }
 /*************************/
\ No newline at end of file
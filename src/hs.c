@@ -15,6 +15,49 @@ limitations under the License.
 
 #include "hs.h"
 
+/* It merges a batch of evaluated harmonies into the harmony memory, which must be sorted from the best to the worst harmony.
+The best harmonies of the batch replace the worst ones in memory, so that the memory keeps the s->m best harmonies of both sets.
+Parameters:
+s: search space
+candidate: batch of evaluated harmonies (their fitness values are overwritten)
+b: number of harmonies
+rehearsal: rehearsal matrix concerning PSF-HS (NULL for HS and IHS)
+op_type: b x n matrix with the operations used to generate each harmony concerning PSF-HS (NULL for HS and IHS) */
+void MergeHarmonies(SearchSpace *s, Agent **candidate, int b, char **rehearsal, char **op_type)
+{
+    int i, j, c, best, worst;
+
+    for (c = 0; (c < b) && (c < s->m); c++)
+    {
+        best = 0;
+        for (i = 1; i < b; i++)
+            if (candidate[i]->fit < candidate[best]->fit)
+                best = i;
+
+        worst = s->m - 1 - c;
+        if (candidate[best]->fit >= s->a[worst]->fit)
+            break;
+
+        /* We accept the new solution */
+        for (j = 0; j < s->n; j++)
+            s->a[worst]->x[j] = candidate[best]->x[j];
+        s->a[worst]->fit = candidate[best]->fit;
+        s->a[worst]->cv = candidate[best]->cv;
+        if (rehearsal)
+            for (j = 0; j < s->n; j++)
+                rehearsal[worst][j] = op_type[best][j];
+
+        if (s->a[worst]->fit < s->gfit)
+        { /* update the global best */
+            s->gfit = s->a[worst]->fit;
+            for (j = 0; j < s->n; j++)
+                s->g[j] = s->a[worst]->x[j];
+        }
+
+        candidate[best]->fit = DBL_MAX; /* it will not be selected again */
+    }
+}
+
 /* It executes the Harmony Search for function minimization
 Parameters:
 s: search space
@@ -23,9 +66,8 @@ arg: list of additional arguments */
 void runHS(SearchSpace *s, prtFun Evaluate, ...)
 {
     va_list arg, argtmp;
-    int t, i, j;
-    double fitValue;
-    Agent *tmp = NULL;
+    int t, i;
+    Agent **candidate = NULL;
 
     va_start(arg, Evaluate);
     va_copy(argtmp, arg);
@@ -36,9 +78,18 @@ void runHS(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    if (s->is_binary_opt)
+    {
+        fprintf(stderr, "\nBinary search spaces must be optimized by runBHS @runHS.\n");
+        exit(-1);
+    }
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _HS_, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    candidate = (Agent **)calloc(2 * s->batch_size, sizeof(Agent *));
+
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -46,29 +97,24 @@ void runHS(SearchSpace *s, prtFun Evaluate, ...)
 
         qsort(s->a, s->m, sizeof(Agent **), SortAgent); /* Sorts all harmonies according to their fitness. First position gets the best harmony. */
 
-        tmp = GenerateNewAgent(s, _HS_);
-        CheckAgentLimits(s, tmp);
-        fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
-
-        if ((fitValue < s->a[s->m - 1]->fit))
-        { /* We accept the new solution */
-            DestroyAgent(&(s->a[s->m - 1]), _HS_);
-            s->a[s->m - 1] = CopyAgent(tmp, _HS_, _NOTENSOR_);
-            s->a[s->m - 1]->fit = fitValue;
+        /* it improvises s->batch_size harmonies from the same memory */
+        for (i = 0; i < s->batch_size; i++)
+        {
+            candidate[i] = GenerateNewAgent(s, _HS_);
+            CheckAgentLimits(s, candidate[i]);
         }
 
-        if (fitValue < s->gfit)
-        { /* update the global best */
-            s->gfit = fitValue;
-            for (j = 0; j < s->n; j++)
-                s->g[j] = tmp->x[j];
-        }
+        EvaluateScreenedBatch(s, candidate, s->batch_size, NULL, Evaluate, arg); /* It executes the fitness function for the harmonies, unless the surrogate model discards them */
+        MergeHarmonies(s, candidate, s->batch_size, NULL, NULL);
 
-        DestroyAgent(&tmp, _HS_);
+        for (i = 0; i < s->batch_size; i++)
+            DestroyAgent(&candidate[i], _HS_);
 
         fprintf(stderr, "OK (minimum fitness value %lf)", s->gfit);
     }
 
+    free(candidate);
+
     va_end(arg);
 }
 
@@ -80,9 +126,8 @@ arg: list of additional arguments */
 void runIHS(SearchSpace *s, prtFun Evaluate, ...)
 {
     va_list arg, argtmp;
-    int t, i, j;
-    double fitValue;
-    Agent *tmp = NULL;
+    int t, i;
+    Agent **candidate = NULL;
 
     va_start(arg, Evaluate);
     va_copy(argtmp, arg);
@@ -93,9 +138,18 @@ void runIHS(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    if (s->is_binary_opt)
+    {
+        fprintf(stderr, "\nBinary search spaces must be optimized by runBHS @runIHS.\n");
+        exit(-1);
+    }
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _HS_, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    candidate = (Agent **)calloc(2 * s->batch_size, sizeof(Agent *));
+
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -105,29 +159,139 @@ void runIHS(SearchSpace *s, prtFun Evaluate, ...)
 
         s->PAR = s->PAR_min + ((s->PAR_max - s->PAR_min) / s->iterations) * t;
         s->bw = s->bw_max * exp((log(s->bw_min / s->bw_max) / s->iterations) * t);
-        tmp = GenerateNewAgent(s, _HS_);
-        CheckAgentLimits(s, tmp);
-        fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
-
-        if ((fitValue < s->a[s->m - 1]->fit))
-        { /* We accept the new solution */
-            DestroyAgent(&(s->a[s->m - 1]), _HS_);
-            s->a[s->m - 1] = CopyAgent(tmp, _HS_, _NOTENSOR_);
-            s->a[s->m - 1]->fit = fitValue;
+        /* it improvises s->batch_size harmonies from the same memory */
+        for (i = 0; i < s->batch_size; i++)
+        {
+            candidate[i] = GenerateNewAgent(s, _HS_);
+            CheckAgentLimits(s, candidate[i]);
         }
 
-        if (fitValue < s->gfit)
-        { /* update the global best */
-            s->gfit = fitValue;
-            for (j = 0; j < s->n; j++)
-                s->g[j] = tmp->x[j];
+        EvaluateScreenedBatch(s, candidate, s->batch_size, NULL, Evaluate, arg); /* It executes the fitness function for the harmonies, unless the surrogate model discards them */
+        MergeHarmonies(s, candidate, s->batch_size, NULL, NULL);
+
+        for (i = 0; i < s->batch_size; i++)
+            DestroyAgent(&candidate[i], _HS_);
+
+        fprintf(stderr, "OK (minimum fitness value %lf)", s->gfit);
+    }
+
+    free(candidate);
+
+    va_end(arg);
+}
+
+/* It improvises a bit-packed harmony as GenerateNewAgent does for HS: each bit is taken from a harmony of the memory drawn
+at random with probability HMCR, and the pitch adjustment (with probability PAR) flips it; otherwise, the bit is drawn at random.
+The harmony is built a word at a time.
+Parameters:
+s: binary search space
+a: output agent */
+void ImproviseBinaryHarmony(SearchSpace *s, Agent *a)
+{
+    int i, k, w, end, words;
+    uint64_t bit, b;
+
+    if (!s || !s->is_binary_opt)
+    {
+        fprintf(stderr, "\nBinary search space not allocated @ImproviseBinaryHarmony.\n");
+        exit(-1);
+    }
+
+    words = getBinaryWords(s->n);
+    for (w = 0; w < words; w++)
+    {
+        b = 0;
+        end = (w < words - 1) ? BINARY_WORD_SIZE : s->n - w * BINARY_WORD_SIZE;
+        for (k = 0; k < end; k++)
+        {
+            if (s->HMCR >= GenerateUniformRandomNumber(0, 1))
+            {
+                i = GenerateUniformRandomNumber(0, s->m);
+                bit = (s->a[i]->b[w] >> k) & 1;
+                if (s->PAR >= GenerateUniformRandomNumber(0, 1))
+                    bit ^= 1;
+            }
+            else
+                bit = GenerateUniformRandomNumber(0, 1) < 0.5;
+            b |= bit << k;
         }
+        a->b[w] = b;
+    }
+}
 
-        DestroyAgent(&tmp, _HS_);
+/* It executes the Binary Harmony Search for function minimization, which follows runHS on a binary search space
+(see SetBinarySearchSpace). The improvised harmonies replace the worst ones in memory by swapping buffers, so no
+harmony is allocated along the run. The fitness function reads the position of each agent at a->b.
+Parameters:
+s: search space
+Evaluate: pointer to the function used to evaluate harmonies
+arg: list of additional arguments */
+void runBHS(SearchSpace *s, prtFun Evaluate, ...)
+{
+    va_list arg, argtmp;
+    int t, i, c, worst;
+    Agent **candidate = NULL, *tmp = NULL;
+
+    va_start(arg, Evaluate);
+    va_copy(argtmp, arg);
+
+    if (!s || !s->is_binary_opt)
+    {
+        fprintf(stderr, "\nBinary search space not allocated @runBHS.\n");
+        exit(-1);
+    }
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
+    EvaluateBinarySearchSpace(s, Evaluate, arg); /* Initial evaluation of the search space */
+
+    candidate = (Agent **)malloc(s->batch_size * sizeof(Agent *));
+    for (i = 0; i < s->batch_size; i++)
+        candidate[i] = CopyAgent(s->a[0], _HS_, _NOTENSOR_);
+    PlaceAgents(s, candidate, s->batch_size); /* the batch is evaluated in the same order at every iteration */
+
+    for (t = 1; !StopOptimization(s, t); t++)
+    {
+        fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
+
+        va_copy(arg, argtmp);
+
+        qsort(s->a, s->m, sizeof(Agent **), SortAgent); /* Sorts all harmonies according to their fitness. First position gets the best harmony. */
+
+        /* it improvises s->batch_size harmonies from the same memory */
+        for (i = 0; i < s->batch_size; i++)
+            ImproviseBinaryHarmony(s, candidate[i]);
+
+        EvaluateBatch(s, candidate, s->batch_size, Evaluate, arg);
+
+        /* The best harmonies of the batch replace the worst ones in memory */
+        qsort(candidate, s->batch_size, sizeof(Agent **), SortAgent);
+        for (c = 0; (c < s->batch_size) && (c < s->m); c++)
+        {
+            worst = s->m - 1 - c;
+            if (candidate[c]->fit >= s->a[worst]->fit)
+                break;
+
+            tmp = s->a[worst];
+            s->a[worst] = candidate[c];
+            candidate[c] = tmp;
+
+            if (IsBetterSolution(s->a[worst]->fit, s->a[worst]->cv, s->gfit, s->gcv))
+            { /* update the global best, as EvaluateBinarySearchSpace does */
+                s->best = worst;
+                s->gfit = s->a[worst]->fit;
+                s->gcv = s->a[worst]->cv;
+                memcpy(s->gb, s->a[worst]->b, getBinaryWords(s->n) * sizeof(uint64_t));
+                UnpackBinary(s->gb, s->n, s->g);
+            }
+        }
 
         fprintf(stderr, "OK (minimum fitness value %lf)", s->gfit);
     }
 
+    for (i = 0; i < s->batch_size; i++)
+        DestroyAgent(&candidate[i], _HS_);
+    free(candidate);
+
     va_end(arg);
 }
 
@@ -289,9 +453,9 @@ void runPSF_HS(SearchSpace *s, prtFun Evaluate, ...)
 {
     va_list arg, argtmp;
     int i, j, t;
-    double fitValue, *HMCR, *PAR;
-    char *op_type, **rehearsal;
-    Agent *tmp = NULL;
+    double *HMCR, *PAR;
+    char **op_type, **rehearsal;
+    Agent *tmp = NULL, **candidate = NULL;
 
     va_start(arg, Evaluate);
     va_copy(argtmp, arg);
@@ -302,6 +466,7 @@ void runPSF_HS(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _HS_, Evaluate, arg); /* Initial evaluation of the search space */
 
     rehearsal = (char **)calloc(s->m, sizeof(char *));
@@ -309,9 +474,12 @@ void runPSF_HS(SearchSpace *s, prtFun Evaluate, ...)
         rehearsal[i] = (char *)calloc(s->n, sizeof(char));
     HMCR = (double *)calloc(s->n, sizeof(double));
     PAR = (double *)calloc(s->n, sizeof(double));
-    op_type = (char *)calloc(s->n, sizeof(char));
+    op_type = (char **)calloc(s->batch_size, sizeof(char *));
+    for (i = 0; i < s->batch_size; i++)
+        op_type[i] = (char *)calloc(s->n, sizeof(char));
+    candidate = (Agent **)calloc(2 * s->batch_size, sizeof(Agent *));
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -326,9 +494,9 @@ void runPSF_HS(SearchSpace *s, prtFun Evaluate, ...)
                     HMCR[j] = s->HMCR;
                     PAR[j] = s->PAR;
                 }
-                tmp = GenerateNewPSF(s, HMCR, PAR, op_type);
+                tmp = GenerateNewPSF(s, HMCR, PAR, op_type[0]);
                 for (j = 0; j < s->n; j++)
-                    rehearsal[i][j] = op_type[j];
+                    rehearsal[i][j] = op_type[0][j];
                 DestroyAgent(&(s->a[i]), _HS_);
                 s->a[i] = CopyAgent(tmp, _HS_, _NOTENSOR_);
                 DestroyAgent(&tmp, _HS_);
@@ -338,29 +506,19 @@ void runPSF_HS(SearchSpace *s, prtFun Evaluate, ...)
 
         qsort(s->a, s->m, sizeof(Agent **), SortAgent); /* Sorts all harmonies according to their fitness. First position gets the best harmony. */
 
-        tmp = GenerateNewPSF(s, HMCR, PAR, op_type);
-        UpdateIndividualHMCR_PAR(s, rehearsal, HMCR, PAR);
-        CheckAgentLimits(s, tmp);
-
-        fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
-
-        if ((fitValue < s->a[s->m - 1]->fit))
-        { /* We accept the new solution */
-            DestroyAgent(&(s->a[s->m - 1]), _HS_);
-            s->a[s->m - 1] = CopyAgent(tmp, _HS_, _NOTENSOR_);
-            s->a[s->m - 1]->fit = fitValue;
-            for (j = 0; j < s->n; j++)
-                rehearsal[s->m - 1][j] = op_type[j];
+        /* it improvises s->batch_size harmonies from the same memory */
+        for (i = 0; i < s->batch_size; i++)
+        {
+            candidate[i] = GenerateNewPSF(s, HMCR, PAR, op_type[i]);
+            CheckAgentLimits(s, candidate[i]);
         }
+        UpdateIndividualHMCR_PAR(s, rehearsal, HMCR, PAR);
 
-        if (fitValue < s->gfit)
-        { /* update the global best */
-            s->gfit = fitValue;
-            for (j = 0; j < s->n; j++)
-                s->g[j] = tmp->x[j];
-        }
+        EvaluateBatch(s, candidate, s->batch_size, Evaluate, arg); /* It executes the fitness function for the harmonies */
+        MergeHarmonies(s, candidate, s->batch_size, rehearsal, op_type);
 
-        DestroyAgent(&tmp, _HS_);
+        for (i = 0; i < s->batch_size; i++)
+            DestroyAgent(&candidate[i], _HS_);
 
         fprintf(stderr, "OK (minimum fitness value %lf)", s->gfit);
     }
@@ -370,7 +528,10 @@ void runPSF_HS(SearchSpace *s, prtFun Evaluate, ...)
     free(rehearsal);
     free(HMCR);
     free(PAR);
+    for (i = 0; i < s->batch_size; i++)
+        free(op_type[i]);
     free(op_type);
+    free(candidate);
 
     va_end(arg);
 }
@@ -397,9 +558,10 @@ void runTensorHS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _HS_, tensor_id, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -445,7 +607,7 @@ void runTensorHS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         for (j = 0; j < s->n; j++)
             tmp->x[j] = TensorSpan(s->LB[j], s->UB[j], tmp_t[j], tensor_id);
 
-        fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
+        fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent tmp */
 
         if ((fitValue < s->a[s->m - 1]->fit))
         { /* We accept the new solution */
@@ -494,9 +656,10 @@ void runTensorIHS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _HS_, tensor_id, Evaluate, arg); /* Initial evaluation of the search space */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -545,7 +708,7 @@ void runTensorIHS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         for (j = 0; j < s->n; j++)
             tmp->x[j] = TensorSpan(s->LB[j], s->UB[j], tmp_t[j], tensor_id);
 
-        fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
+        fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent tmp */
 
         if ((fitValue < s->a[s->m - 1]->fit))
         { /* We accept the new solution */
@@ -595,6 +758,7 @@ void runTensorPSF_HS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _HS_, tensor_id, Evaluate, arg); /* Initial evaluation of the search space */
 
     rehearsal = (char ***)calloc(s->m, sizeof(char **));
@@ -614,7 +778,7 @@ void runTensorPSF_HS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         op_type[j] = (char *)calloc(tensor_id, sizeof(char));
     }
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
 
@@ -661,7 +825,7 @@ void runTensorPSF_HS(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         CheckAgentLimits(s, tmp);
         UpdateIndividualTensorHMCR_PAR(s, tensor_id, rehearsal, HMCR, PAR);
 
-        fitValue = Evaluate(tmp, arg); /* It executes the fitness function for agent tmp */
+        fitValue = EvaluateFitness(s, tmp, Evaluate, arg); /* It executes the fitness function for agent tmp */
 
         if ((fitValue < s->a[s->m - 1]->fit))
         { /* We accept the new solution */
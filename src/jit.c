@@ -0,0 +1,547 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "jit.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define JIT_SUPPORTED
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#define JIT_PATH_LENGTH 512
+
+extern const int N_ARGS_FUNCTION[]; /* number of arguments of each GP function (common.c) */
+
+/* C syntax of each GP function: text before the first argument, between the arguments and after the last one.
+The expressions match the ones of RunLinearTree, so the native code computes the same outputs. */
+static const char *JIT_SYNTAX[][3] = {
+    {"(", " + ", ")"},                                 /* _SUM_ */
+    {"(", " - ", ")"},                                 /* _SUB_ */
+    {"(", " * ", ")"},                                 /* _MUL_ */
+    {"(", " / (", " + 0.00001))"},                     /* _DIV_ */
+    {"exp(", NULL, ")"},                               /* _EXP_ */
+    {"sqrt(fabs(", NULL, "))"},                        /* _SQRT_ */
+    {"log(", NULL, " + 0.00001)"},                     /* _LOG_ */
+    {"fabs(", NULL, ")"},                              /* _ABS_ */
+    {"(double)((int)(", ") & (int)(", "))"},           /* _AND_ */
+    {"(double)((int)(", ") | (int)(", "))"},           /* _OR_ */
+    {"(double)((int)(", ") ^ (int)(", "))"},           /* _XOR_ */
+    {"(double)~(int)(", NULL, ")"},                    /* _NOT_ */
+};
+
+/* It checks whether all nodes of a linear tree can be translated into C (tensor-based functions cannot)
+Parameters:
+T: linear tree */
+static char IsCompilable(LinearTree *T)
+{
+    int i;
+
+    for (i = 0; i < T->size; i++)
+    {
+        if ((T->node[i].status != FUNCTION) && (T->node[i].status != TERMINAL) && (T->node[i].status != CONSTANT))
+            return 0;
+        if ((T->node[i].status == FUNCTION) && ((T->node[i].op < 0) || (T->node[i].op > _NOT_)))
+            return 0;
+    }
+
+    return 1;
+}
+
+/* It writes the C expression of the subtree rooted at a given node and returns the position right after the subtree
+Parameters:
+fp: output file
+T: linear tree
+i: position of the root of the subtree
+standalone: if 1, constants are read from the static arrays written by ExportTree2C, otherwise from the search space */
+static int WriteLinearNode(FILE *fp, LinearTree *T, int i, char standalone)
+{
+    const LinearNode *node = &T->node[i];
+    int next = i + 1;
+
+    if (node->status == TERMINAL)
+        fprintf(fp, "t[%d][j]", node->id);
+    else if (node->status == CONSTANT)
+    {
+        if (standalone)
+            fprintf(fp, "c%d[j]", node->id);
+        else
+            fprintf(fp, "c[j][%d]", node->id);
+    }
+    else
+    {
+        fprintf(fp, "%s", JIT_SYNTAX[node->op][0]);
+        next = WriteLinearNode(fp, T, next, standalone);
+        if (N_ARGS_FUNCTION[node->op] == 2)
+        {
+            fprintf(fp, "%s", JIT_SYNTAX[node->op][1]);
+            next = WriteLinearNode(fp, T, next, standalone);
+        }
+        fprintf(fp, "%s", JIT_SYNTAX[node->op][2]);
+    }
+
+    return next;
+}
+
+/* It computes the structural hash of a linear tree (FNV-1a over the nodes in prefix order, which identify the tree)
+Parameters:
+T: linear tree */
+static unsigned long long HashJitTree(LinearTree *T)
+{
+    unsigned long long h = 14695981039346656037ULL;
+    int i;
+
+    for (i = 0; i < T->size; i++)
+    {
+        h = (h ^ (unsigned long long)T->node[i].status) * 1099511628211ULL;
+        h = (h ^ (unsigned long long)(unsigned int)((T->node[i].status == FUNCTION) ? T->node[i].op : T->node[i].id)) * 1099511628211ULL;
+    }
+
+    return h;
+}
+
+/* It checks whether two linear trees have the same structure
+Parameters:
+T1: first linear tree
+T2: second linear tree */
+static char SameJitTree(LinearTree *T1, LinearTree *T2)
+{
+    int i;
+
+    if (T1->size != T2->size)
+        return 0;
+
+    for (i = 0; i < T1->size; i++)
+    {
+        if (T1->node[i].status != T2->node[i].status)
+            return 0;
+        if ((T1->node[i].status == FUNCTION) ? (T1->node[i].op != T2->node[i].op) : (T1->node[i].id != T2->node[i].id))
+            return 0;
+    }
+
+    return 1;
+}
+
+/* It rebuilds the hash table of the known trees, so that it has at least twice as many slots as trees
+Parameters:
+jit: state of the compiler */
+static void IndexGPJit(GPJit *jit)
+{
+    int i, slot;
+
+    if (jit->n_slots < 2 * jit->max_entries)
+    {
+        for (jit->n_slots = 64; jit->n_slots < 2 * jit->max_entries; jit->n_slots *= 2)
+            ;
+        jit->slot = (int *)realloc(jit->slot, jit->n_slots * sizeof(int));
+    }
+
+    for (i = 0; i < jit->n_slots; i++)
+        jit->slot[i] = -1;
+
+    for (i = 0; i < jit->n_entries; i++)
+    {
+        slot = jit->entry[i].key & (jit->n_slots - 1);
+        while (jit->slot[slot] >= 0)
+            slot = (slot + 1) & (jit->n_slots - 1);
+        jit->slot[slot] = i;
+    }
+}
+
+/* It returns the position of a tree among the known trees, adding it if it is not there
+Parameters:
+jit: state of the compiler
+T: linear tree */
+static int FindGPJit(GPJit *jit, LinearTree *T)
+{
+    unsigned long long key = HashJitTree(T);
+    int slot, e;
+
+    if (jit->n_entries == jit->max_entries)
+    { /* there must be room for the new tree, which also keeps the hash table at most half full */
+        jit->max_entries = jit->max_entries ? 2 * jit->max_entries : 64;
+        jit->entry = (JitEntry *)realloc(jit->entry, jit->max_entries * sizeof(JitEntry));
+        IndexGPJit(jit);
+    }
+
+    for (slot = key & (jit->n_slots - 1); (e = jit->slot[slot]) >= 0; slot = (slot + 1) & (jit->n_slots - 1))
+        if ((jit->entry[e].key == key) && SameJitTree(jit->entry[e].T, T))
+            return e;
+
+    e = jit->n_entries++;
+    jit->slot[slot] = e;
+    jit->entry[e].key = key;
+    jit->entry[e].T = CreateLinearTree(T->size);
+    CopyLinearTree(jit->entry[e].T, T);
+    jit->entry[e].generations = 0;
+    jit->entry[e].last_generation = 0;
+    jit->entry[e].cost = -1;
+    jit->entry[e].kernel = NULL;
+
+    return e;
+}
+
+#ifdef JIT_SUPPORTED
+/* It runs the C compiler without going through the shell, so neither the paths nor LIBOPT_JIT_CC are interpreted
+as shell syntax. LIBOPT_JIT_CC is split into words at blanks, so it may hold a launcher or extra flags (e.g. "ccache gcc").
+Parameters:
+cc: compiler command (NULL means "cc")
+library: path of the shared object to be built
+source: path of the C source file */
+static int RunCompiler(const char *cc, const char *library, const char *source)
+{
+    char words[JIT_PATH_LENGTH], *argv[32], *word = NULL;
+    int argc = 0, status, fd;
+    pid_t pid;
+
+    snprintf(words, JIT_PATH_LENGTH, "%s", cc ? cc : "cc");
+    for (word = strtok(words, " \t"); word && (argc < 23); word = strtok(NULL, " \t"))
+        argv[argc++] = word;
+    if (!argc)
+        return 0;
+    argv[argc++] = "-O2";
+    argv[argc++] = "-fPIC";
+    argv[argc++] = "-shared";
+    argv[argc++] = "-ffp-contract=off"; /* the outputs are rounded as the interpreter's ones */
+    argv[argc++] = "-o";
+    argv[argc++] = (char *)library;
+    argv[argc++] = (char *)source;
+    argv[argc++] = "-lm";
+    argv[argc] = NULL;
+
+    pid = fork();
+    if (pid < 0)
+        return 0;
+    if (!pid) /* the compiler output is discarded */
+    {
+        fd = open("/dev/null", O_WRONLY);
+        if (fd >= 0)
+        {
+            dup2(fd, STDOUT_FILENO);
+            dup2(fd, STDERR_FILENO);
+            close(fd);
+        }
+        execvp(argv[0], argv);
+        _exit(127);
+    }
+
+    while (waitpid(pid, &status, 0) < 0)
+        if (errno != EINTR)
+            return 0;
+
+    return WIFEXITED(status) && !WEXITSTATUS(status);
+}
+#endif
+
+/* It compiles the native code of a set of trees into a single shared object
+Parameters:
+jit: state of the compiler
+candidate: positions of the trees among the known ones
+n: number of trees */
+static void CompileGPJit(GPJit *jit, int *candidate, int n)
+{
+#ifdef JIT_SUPPORTED
+    char source[JIT_PATH_LENGTH], library[JIT_PATH_LENGTH], symbol[32];
+    const char *cc = getenv("LIBOPT_JIT_CC");
+    void *module = NULL;
+    FILE *fp = NULL;
+    double start = GetWallClockTime();
+    int i;
+
+    snprintf(source, JIT_PATH_LENGTH, "%s/trees%d.c", jit->dir, jit->n_modules);
+    snprintf(library, JIT_PATH_LENGTH, "%s/trees%d.so", jit->dir, jit->n_modules);
+
+    fp = fopen(source, "w");
+    if (!fp)
+    {
+        jit->available = 0;
+        return;
+    }
+
+    fprintf(fp, "#include <math.h>\n\n");
+    for (i = 0; i < n; i++)
+    {
+        fprintf(fp, "void tree%d(double **t, double **c, double *out, int n)\n{\n    int j;\n\n    for (j = 0; j < n; j++)\n        out[j] = ", i);
+        WriteLinearNode(fp, jit->entry[candidate[i]].T, 0, 0);
+        fprintf(fp, ";\n}\n\n");
+    }
+    fclose(fp);
+
+    if (RunCompiler(cc, library, source))
+        module = dlopen(library, RTLD_NOW | RTLD_LOCAL);
+    remove(source);
+    remove(library); /* a loaded shared object remains available */
+    jit->compile_time = GetWallClockTime() - start;
+
+    if (!module)
+    {
+        fprintf(stderr, "\nNative code is not available, so the trees are interpreted @CompileGPJit.\n");
+        jit->available = 0;
+        return;
+    }
+
+    jit->module = (void **)realloc(jit->module, (jit->n_modules + 1) * sizeof(void *));
+    jit->module[jit->n_modules++] = module;
+
+    for (i = 0; i < n; i++)
+    {
+        snprintf(symbol, 32, "tree%d", i);
+        *(void **)&jit->entry[candidate[i]].kernel = dlsym(module, symbol);
+        if (jit->entry[candidate[i]].kernel)
+            jit->compiled++;
+    }
+#else
+    jit->available = 0;
+#endif
+}
+
+/* It estimates the time that would be spent interpreting a set of trees until they are discarded. A tree is expected to
+survive as many generations as it has already survived (up to the last iteration), and the time to interpret it once is
+measured the first time it is asked for.
+Parameters:
+jit: state of the compiler
+s: search space
+candidate: positions of the trees among the known ones
+n: number of trees */
+static double InterpretationTime(GPJit *jit, SearchSpace *s, int *candidate, int n)
+{
+    int i, max_size = 1, remaining = s->iterations - jit->generation + 2; /* the first call comes before the initial evaluation */
+    double *out = NULL, *stack = NULL, start, time = 0;
+    JitEntry *e = NULL;
+
+    for (i = 0; i < n; i++)
+        if (jit->entry[candidate[i]].T->size > max_size)
+            max_size = jit->entry[candidate[i]].T->size;
+
+    out = (double *)malloc(s->n * sizeof(double));
+    stack = (double *)malloc(max_size * s->n * sizeof(double));
+
+    for (i = 0; i < n; i++)
+    {
+        e = &jit->entry[candidate[i]];
+        if (e->cost < 0)
+        {
+            start = GetWallClockTime();
+            RunLinearTree(s, _GP_, e->T, out, stack, NULL);
+            e->cost = GetWallClockTime() - start;
+        }
+        time += e->cost * ((e->generations < remaining) ? e->generations : remaining);
+    }
+
+    free(out);
+    free(stack);
+
+    return time;
+}
+
+/* It creates the state of the compiler, i.e., a temporary directory for the generated files. Native code is disabled
+if the directory cannot be created.
+Parameters: none */
+GPJit *CreateGPJit(void)
+{
+    GPJit *jit = (GPJit *)calloc(1, sizeof(GPJit));
+#ifdef JIT_SUPPORTED
+    const char *tmp = getenv("TMPDIR");
+    char dir[JIT_PATH_LENGTH];
+
+    snprintf(dir, JIT_PATH_LENGTH, "%s/libopt-jit-XXXXXX", tmp ? tmp : "/tmp");
+    if (mkdtemp(dir))
+    {
+        jit->dir = (char *)malloc((strlen(dir) + 1) * sizeof(char));
+        strcpy(jit->dir, dir);
+        jit->available = 1;
+    }
+#endif
+    jit->compile_time = JIT_COMPILE_TIME;
+
+    return jit;
+}
+
+/* It unloads the native code and deallocates the state of the compiler. The native code of the trees cannot be used
+afterwards.
+Parameters:
+jit: address of the state of the compiler */
+void DestroyGPJit(GPJit **jit)
+{
+    int i;
+
+    if (!jit || !*jit)
+        return;
+
+    for (i = 0; i < (*jit)->n_entries; i++)
+        DestroyLinearTree(&(*jit)->entry[i].T);
+    if ((*jit)->entry)
+        free((*jit)->entry);
+    if ((*jit)->slot)
+        free((*jit)->slot);
+
+#ifdef JIT_SUPPORTED
+    for (i = 0; i < (*jit)->n_modules; i++)
+        dlclose((*jit)->module[i]);
+    if ((*jit)->dir)
+        rmdir((*jit)->dir);
+#endif
+    if ((*jit)->module)
+        free((*jit)->module);
+    if ((*jit)->dir)
+        free((*jit)->dir);
+
+    free(*jit);
+    *jit = NULL;
+}
+
+/* It sets the native code of the trees of a GP search space (s->tree_kernel), which is used by the next evaluation.
+The trees evaluated along JIT_MIN_GENERATIONS generations (e.g., the elite ones kept by reproduction) are compiled,
+at most JIT_MAX_BATCH of them per call, provided the compilation is expected to pay off. The other trees are
+interpreted. It must be called once per generation, before the evaluation.
+Parameters:
+jit: state of the compiler
+s: search space (s->tree_kernel must have room for s->m kernels)
+T: linear trees (s->m trees) */
+void UpdateGPJit(GPJit *jit, SearchSpace *s, LinearTree **T)
+{
+    int i, j, k, n = 0, *position = NULL, *candidate = NULL;
+    JitEntry *e = NULL;
+
+    if (!jit || !s || !T || !s->tree_kernel)
+    {
+        fprintf(stderr, "\nInvalid input parameters @UpdateGPJit.\n");
+        exit(-1);
+    }
+
+    jit->generation++;
+    position = (int *)malloc(s->m * sizeof(int));
+    candidate = (int *)malloc(s->m * sizeof(int));
+
+    for (k = 0; k < s->m; k++)
+    {
+        position[k] = FindGPJit(jit, T[k]);
+        e = &jit->entry[position[k]];
+        if (e->last_generation != jit->generation)
+        { /* copies of the same tree count once */
+            e->last_generation = jit->generation;
+            e->generations++;
+            if (!e->kernel && (e->generations >= JIT_MIN_GENERATIONS) && IsCompilable(e->T))
+                candidate[n++] = position[k];
+        }
+    }
+
+    if (jit->available && n)
+    {
+        if (n > JIT_MAX_BATCH)
+        { /* the oldest trees are compiled first (partial selection sort), and the other ones wait for the next generations */
+            for (i = 0; i < JIT_MAX_BATCH; i++)
+                for (j = i + 1; j < n; j++)
+                    if (jit->entry[candidate[j]].generations > jit->entry[candidate[i]].generations)
+                    {
+                        k = candidate[i];
+                        candidate[i] = candidate[j];
+                        candidate[j] = k;
+                    }
+            n = JIT_MAX_BATCH;
+        }
+
+        if (InterpretationTime(jit, s, candidate, n) > JIT_PAYOFF * jit->compile_time)
+            CompileGPJit(jit, candidate, n);
+    }
+
+    for (k = 0; k < s->m; k++)
+        s->tree_kernel[k] = jit->entry[position[k]].kernel;
+
+    /* It forgets the trees that have been discarded by the optimization, unless they have been compiled */
+    for (i = 0, n = 0; i < jit->n_entries; i++)
+    {
+        if (jit->entry[i].kernel || (jit->entry[i].last_generation == jit->generation))
+            jit->entry[n++] = jit->entry[i];
+        else
+            DestroyLinearTree(&jit->entry[i].T);
+    }
+    jit->n_entries = n;
+    IndexGPJit(jit);
+
+    free(position);
+    free(candidate);
+}
+
+/* It writes a tree as a standalone C function, which computes the output of the tree with a single loop over the
+decision variables. The random constants used by the tree are written along with it.
+Parameters:
+s: search space (_GP_)
+T: pointer to the tree (e.g., s->T[s->best])
+fileName: output file name
+functionName: name of the C function */
+char ExportTree2C(SearchSpace *s, Node *T, char *fileName, char *functionName)
+{
+    LinearTree *L = NULL;
+    char *used = NULL;
+    FILE *fp = NULL;
+    int i, j;
+
+    if (!s || !T || !fileName || !functionName)
+    {
+        fprintf(stderr, "\nInvalid input parameters @ExportTree2C.\n");
+        return 0;
+    }
+
+    L = CreateLinearTree(getSizeTree(T));
+    Tree2LinearTree(T, L);
+    if (!IsCompilable(L))
+    {
+        fprintf(stderr, "\nTensor-based trees cannot be exported @ExportTree2C.\n");
+        DestroyLinearTree(&L);
+        return 0;
+    }
+
+    fp = fopen(fileName, "w");
+    if (!fp)
+    {
+        fprintf(stderr, "\nUnable to open file %s @ExportTree2C.\n", fileName);
+        DestroyLinearTree(&L);
+        return 0;
+    }
+
+    fprintf(fp, "#include <math.h>\n\n");
+
+    used = (char *)calloc(s->n_constants, sizeof(char));
+    for (i = 0; i < L->size; i++)
+    {
+        if ((L->node[i].status == CONSTANT) && !used[L->node[i].id])
+        {
+            used[L->node[i].id] = 1;
+            fprintf(fp, "static const double c%d[%d] = {", L->node[i].id, s->n);
+            for (j = 0; j < s->n; j++)
+                fprintf(fp, "%s%.17g", j ? ", " : "", s->constant[j][L->node[i].id]);
+            fprintf(fp, "};\n");
+        }
+    }
+    free(used);
+
+    fprintf(fp, "\n/* It computes the output of the tree\nParameters:\nt: terminals (%d-sized arrays), i.e.,", s->n);
+    for (i = 0, j = 0; i < s->n_terminals; i++)
+        if (strcmp(s->terminal[i], "CONST")) /* constants are written above */
+            fprintf(fp, "%s t[%d] = %s", j++ ? "," : "", i, s->terminal[i]);
+    fprintf(fp, "\nout: output array (%d-sized) */\n", s->n);
+    fprintf(fp, "void %s(double **t, double *out)\n{\n    int j;\n\n    for (j = 0; j < %d; j++)\n        out[j] = ", functionName, s->n);
+    WriteLinearNode(fp, L, 0, 1);
+    fprintf(fp, ";\n}\n");
+
+    fclose(fp);
+    DestroyLinearTree(&L);
+
+    return 1;
+}
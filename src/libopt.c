@@ -0,0 +1,380 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <stddef.h>
+
+#include "libopt.h"
+#include "opt.h"
+#include "pso.h"
+#include "ba.h"
+#include "fpa.h"
+#include "fa.h"
+#include "cs.h"
+#include "ga.h"
+#include "bha.h"
+#include "wca.h"
+#include "mbo.h"
+#include "abc.h"
+#include "hs.h"
+#include "bso.h"
+#include "loa.h"
+#include "restart.h"
+
+/* It defines a technique that can be executed through a handle */
+typedef struct _Technique{
+    const char *name; /* name of the technique */
+    int opt_id; /* identifier of the search space used by the technique */
+    prtRun run; /* function that runs the technique */
+    char from_file; /* 1 if the search space requires structural parameters, i.e., it must be created from a model file */
+}Technique;
+
+static const Technique technique[] = {
+    {"PSO", _PSO_, runPSO, 0},
+    {"AIWPSO", _PSO_, runAIWPSO, 0},
+    {"BA", _BA_, runBA, 0},
+    {"FPA", _FPA_, runFPA, 0},
+    {"FA", _FA_, runFA, 0},
+    {"CS", _CS_, runCS, 0},
+    {"GA", _GA_, runGA, 0},
+    {"BHA", _BHA_, runBHA, 0},
+    {"WCA", _WCA_, runWCA, 0},
+    {"MBO", _MBO_, runMBO, 1},
+    {"ABC", _ABC_, runABC, 0},
+    {"HS", _HS_, runHS, 0},
+    {"IHS", _HS_, runIHS, 0},
+    {"PSF-HS", _HS_, runPSF_HS, 0},
+    {"BSO", _BSO_, runBSO, 0},
+    {"LOA", _LOA_, runLOA, 1},
+};
+
+/* It defines a parameter that can be set through a handle */
+typedef struct _Parameter{
+    const char *name; /* name of the parameter (the same of the search space's field) */
+    size_t offset; /* position of the field within the search space */
+    char type; /* 'i' for int, 'l' for long int and 'd' for double */
+}Parameter;
+
+#define PARAMETER(field, type) {#field, offsetof(SearchSpace, field), type}
+#define STOP_PARAMETER(field, type) {#field, offsetof(SearchSpace, stop.field), type}
+
+/* Only parameters that do not change the allocated structures of the search space are listed */
+static const Parameter parameter[] = {
+    PARAMETER(iterations, 'i'), PARAMETER(n_threads, 'i'),
+    STOP_PARAMETER(max_evaluations, 'l'), STOP_PARAMETER(max_time, 'd'), STOP_PARAMETER(max_stagnation, 'i'), STOP_PARAMETER(tolerance, 'd'),
+    PARAMETER(w, 'd'), PARAMETER(w_min, 'd'), PARAMETER(w_max, 'd'), PARAMETER(c1, 'd'), PARAMETER(c2, 'd'), /* PSO */
+    PARAMETER(f_min, 'd'), PARAMETER(f_max, 'd'), PARAMETER(r, 'd'), PARAMETER(A, 'd'), /* BA */
+    PARAMETER(beta, 'd'), PARAMETER(p, 'd'), /* FPA and CS */
+    PARAMETER(alpha, 'd'), PARAMETER(beta_0, 'd'), PARAMETER(gamma, 'd'), /* FA */
+    PARAMETER(pReproduction, 'd'), PARAMETER(pMutation, 'd'), PARAMETER(pCrossover, 'd'), PARAMETER(selection, 'i'), PARAMETER(tournament_size, 'i'), /* GA */
+    PARAMETER(nsr, 'i'), PARAMETER(dmax, 'd'), /* WCA */
+    PARAMETER(X, 'i'), PARAMETER(M, 'i'), /* MBO */
+    PARAMETER(limit, 'i'), /* ABC */
+    PARAMETER(HMCR, 'd'), PARAMETER(PAR, 'd'), PARAMETER(bw, 'd'), PARAMETER(batch_size, 'i'), /* HS */
+    PARAMETER(PAR_min, 'd'), PARAMETER(PAR_max, 'd'), PARAMETER(bw_min, 'd'), PARAMETER(bw_max, 'd'), /* IHS */
+    PARAMETER(p_one_cluster, 'd'), PARAMETER(p_one_center, 'd'), PARAMETER(p_two_centers, 'd'), PARAMETER(k, 'i'), /* BSO */
+};
+
+/* It defines the handle, which owns a search space */
+struct LibOptHandle_{
+    SearchSpace *s; /* search space */
+    const Technique *technique; /* technique executed by LibOptRun */
+};
+
+/* It finds a technique by its name
+Parameters:
+name: name of the technique */
+static const Technique *FindTechnique(const char *name)
+{
+    size_t i;
+
+    if (name)
+        for (i = 0; i < sizeof(technique) / sizeof(technique[0]); i++)
+            if (!strcmp(technique[i].name, name))
+                return &technique[i];
+
+    fprintf(stderr, "\nUnknown technique %s @FindTechnique.\n", name ? name : "(null)");
+    return NULL;
+}
+
+/* It finds a parameter of a handle by its name
+Parameters:
+h: handle
+name: name of the parameter */
+static const Parameter *FindParameter(LibOptHandle *h, const char *name)
+{
+    size_t i;
+
+    if (!h || !name)
+    {
+        fprintf(stderr, "\nHandle and/or parameter name not allocated @FindParameter.\n");
+        return NULL;
+    }
+
+    if ((h->technique->opt_id == _MBO_) && !strcmp(name, "k"))
+    { /* MBO allocates the neighbours of each bird according to k */
+        fprintf(stderr, "\nParameter k of MBO must be set in the model file @FindParameter.\n");
+        return NULL;
+    }
+
+    for (i = 0; i < sizeof(parameter) / sizeof(parameter[0]); i++)
+        if (!strcmp(parameter[i].name, name))
+            return &parameter[i];
+
+    fprintf(stderr, "\nUnknown parameter %s @FindParameter.\n", name);
+    return NULL;
+}
+
+/* It wraps the fitness function of a handle to be used as a prtFun. It expects the function and its data as additional arguments.
+Parameters:
+a: agent
+arg: list of additional arguments */
+static double EvaluateHandleFunction(Agent *a, va_list arg)
+{
+    va_list argtmp;
+    LibOptFunction Evaluate;
+    void *data;
+
+    va_copy(argtmp, arg); /* it does not consume the caller's list */
+    Evaluate = va_arg(argtmp, LibOptFunction);
+    data = va_arg(argtmp, void *);
+    va_end(argtmp);
+
+    return Evaluate(a->x, a->n, data);
+}
+
+/* Handle-related functions */
+/* It creates a handle with m agents and n decision variables. The boundaries must be set before running.
+Parameters:
+technique: name of the technique (e.g., "PSO")
+m: number of agents
+n: number of decision variables */
+LibOptHandle *LibOptCreate(const char *technique, int m, int n)
+{
+    const Technique *tech = FindTechnique(technique);
+    LibOptHandle *h = NULL;
+
+    if (!tech)
+        return NULL;
+
+    if (tech->from_file)
+    {
+        fprintf(stderr, "\n%s must be created from a model file @LibOptCreate.\n", technique);
+        return NULL;
+    }
+
+    h = (LibOptHandle *)malloc(sizeof(LibOptHandle));
+    h->technique = tech;
+    h->s = CreateSearchSpace(m, n, tech->opt_id);
+    if (!h->s)
+    {
+        free(h);
+        return NULL;
+    }
+
+    return h;
+}
+
+/* It creates a handle from a model file (see examples/model_files)
+Parameters:
+technique: name of the technique (e.g., "PSO")
+fileName: path to the model file */
+LibOptHandle *LibOptCreateFromFile(const char *technique, const char *fileName)
+{
+    const Technique *tech = FindTechnique(technique);
+    LibOptHandle *h = NULL;
+
+    if (!tech || !fileName)
+        return NULL;
+
+    h = (LibOptHandle *)malloc(sizeof(LibOptHandle));
+    h->technique = tech;
+    h->s = ReadSearchSpaceFromFile((char *)fileName, tech->opt_id);
+    if (!h->s)
+    {
+        free(h);
+        return NULL;
+    }
+
+    return h;
+}
+
+/* It deallocates a handle
+Parameters:
+h: address of the handle */
+void LibOptDestroy(LibOptHandle **h)
+{
+    if (!h || !*h)
+        return;
+
+    DestroySearchSpace(&(*h)->s, (*h)->technique->opt_id);
+    free(*h);
+    *h = NULL;
+}
+/**************************/
+
+/* Configuration-related functions */
+/* It sets the boundaries of the decision variables
+Parameters:
+h: handle
+LB: lower boundaries (n-sized array)
+UB: upper boundaries (n-sized array) */
+int LibOptSetBounds(LibOptHandle *h, const double *LB, const double *UB)
+{
+    int j;
+
+    if (!h || !LB || !UB)
+    {
+        fprintf(stderr, "\nInvalid input parameters @LibOptSetBounds.\n");
+        return 0;
+    }
+
+    for (j = 0; j < h->s->n; j++)
+    {
+        if (LB[j] > UB[j])
+        {
+            fprintf(stderr, "\nLower boundary greater than the upper one for variable %d @LibOptSetBounds.\n", j);
+            return 0;
+        }
+    }
+
+    for (j = 0; j < h->s->n; j++)
+    {
+        h->s->LB[j] = LB[j];
+        h->s->UB[j] = UB[j];
+    }
+
+    return 1;
+}
+
+/* It sets an integer-valued parameter. Real-valued parameters are accepted as well.
+Parameters:
+h: handle
+name: name of the parameter (e.g., "iterations")
+value: new value */
+int LibOptSetInt(LibOptHandle *h, const char *name, long int value)
+{
+    const Parameter *p = FindParameter(h, name);
+    char *field = NULL;
+
+    if (!p)
+        return 0;
+
+    field = (char *)h->s + p->offset;
+    if (p->type == 'i')
+        *(int *)field = (int)value;
+    else if (p->type == 'l')
+        *(long int *)field = value;
+    else
+        *(double *)field = (double)value;
+
+    return 1;
+}
+
+/* It sets a real-valued parameter
+Parameters:
+h: handle
+name: name of the parameter (e.g., "w")
+value: new value */
+int LibOptSetDouble(LibOptHandle *h, const char *name, double value)
+{
+    const Parameter *p = FindParameter(h, name);
+
+    if (!p)
+        return 0;
+
+    if (p->type != 'd')
+    {
+        fprintf(stderr, "\nParameter %s is integer-valued @LibOptSetDouble.\n", name);
+        return 0;
+    }
+
+    *(double *)((char *)h->s + p->offset) = value;
+
+    return 1;
+}
+
+/* It initializes the random number generator shared by all handles
+Parameters:
+seed: seed of the generator */
+void LibOptSetSeed(int seed)
+{
+    srandinter(seed);
+}
+/**************************/
+
+/* Optimization-related functions */
+/* It initializes the agents at random and minimizes a fitness function. Each call is an independent run.
+Parameters:
+h: handle
+Evaluate: fitness function, which receives the position, the number of decision variables and data
+data: pointer forwarded to the fitness function */
+int LibOptRun(LibOptHandle *h, LibOptFunction Evaluate, void *data)
+{
+    if (!h || !Evaluate)
+    {
+        fprintf(stderr, "\nInvalid input parameters @LibOptRun.\n");
+        return 0;
+    }
+
+    if (!CheckSearchSpace(h->s, h->technique->opt_id))
+        return 0;
+
+    ResetSearchSpace(h->s, h->technique->opt_id); /* fitness values of a previous run must not be kept */
+    h->technique->run(h->s, EvaluateHandleFunction, Evaluate, data);
+
+    return 1;
+}
+
+/* It returns the best fitness value found by the last run (DBL_MAX if there is none)
+Parameters:
+h: handle */
+double LibOptGetBestFitness(const LibOptHandle *h)
+{
+    return h ? h->s->gfit : DBL_MAX;
+}
+
+/* It copies the best position found by the last run
+Parameters:
+h: handle
+x: output array (n-sized) */
+int LibOptGetBest(const LibOptHandle *h, double *x)
+{
+    if (!h || !x)
+    {
+        fprintf(stderr, "\nInvalid input parameters @LibOptGetBest.\n");
+        return 0;
+    }
+
+    memcpy(x, h->s->g, h->s->n * sizeof(double));
+
+    return 1;
+}
+
+/* It returns the number of decision variables
+Parameters:
+h: handle */
+int LibOptGetDimension(const LibOptHandle *h)
+{
+    return h ? h->s->n : 0;
+}
+
+/* It returns the number of evaluations performed by the last run
+Parameters:
+h: handle */
+long int LibOptGetEvaluations(const LibOptHandle *h)
+{
+    return h ? h->s->stop.n_evaluations : 0;
+}
+/**************************/
@@ -16,6 +16,57 @@ limitations under the License.
 
 #include "loa.h"
 
+/* It takes a lion that is not alive from the pool
+Parameters:
+s: search space */
+Agent *GetLion(SearchSpace *s)
+{
+  Agent *a = NULL;
+
+  if (!s->n_free_lions)
+  {
+    fprintf(stderr, "\nPool of lions is exhausted @GetLion.\n");
+    exit(-1);
+  }
+
+  a = s->free_lion[--s->n_free_lions];
+  a->fit = DBL_MAX;
+  a->pfit = DBL_MAX;
+  a->best_fit = DBL_MAX;
+
+  return a;
+}
+
+/* It gives a dead lion back to the pool
+Parameters:
+s: search space
+a: lion to be released */
+void ReleaseLion(SearchSpace *s, Agent *a)
+{
+  s->free_lion[s->n_free_lions++] = a;
+}
+
+/* It draws k distinct indexes from [0, n) by a partial Fisher-Yates shuffle, which are stored in the first k positions of 'index'
+Parameters:
+index: array with at least n positions
+n: number of candidate indexes
+k: number of indexes to be drawn */
+void PickIndexes(int *index, int n, int k)
+{
+  int i, j, aux;
+
+  for (i = 0; i < n; i++)
+    index[i] = i;
+
+  for (i = 0; i < k && i < n - 1; i++)
+  {
+    j = i + (int)GenerateUniformRandomNumber(0, n - i - 0.001);
+    aux = index[i];
+    index[i] = index[j];
+    index[j] = aux;
+  }
+}
+
 /* In each pride, some females look for a prey (hunt)
 Parameters:
 s: search space
@@ -25,12 +76,13 @@ Evaluate: pointer to the function used to evaluate lionsses
 arg: list of additional arguments */
 void Hunting(SearchSpace *s, int pride, int *selected_females, prtFun Evaluate, va_list arg)
 {
-  int i, j, n_selected, index, center_index;
-  int *group = calloc(3, sizeof(int));               /* counter of members of each group */
-  int range_group[3][2];                             /* matrix that represents the interval of each grupo (in indexes) */
-  int *cumulative_finesses = calloc(3, sizeof(int)); /* cumulative finesses if each group */
-  Agent **Hunters = NULL;                            /* array of hunters */
-  double *Prey = NULL;                               /* prey position in search space */
+  int i, j, n_selected, center_index;
+  int group[3] = {0, 0, 0};                 /* counter of members of each group */
+  int range_group[3][2];                    /* matrix that represents the interval of each grupo (in indexes) */
+  int cumulative_finesses[3] = {0, 0, 0};   /* cumulative finesses if each group */
+  Agent **Hunters = s->pride_id[pride].members; /* array of hunters */
+  Agent *aux = NULL;
+  double *Prey = s->pride_id[pride].prey;   /* prey position in search space */
 
   /* determining which and how many females will hunt */
   n_selected = 0;
@@ -42,23 +94,17 @@ void Hunting(SearchSpace *s, int pride, int *selected_females, prtFun Evaluate,
     if (selected_females[i])
     {                                                      /* if ith female was selected */
       group[(int)(GenerateUniformRandomNumber(0, 2.9))]++; /* sum one on a random group (index from 0 to 2)*/
-      n_selected++;
+      Hunters[n_selected++] = s->pride_id[pride].females[i];
     }
   }
 
-  Hunters = (Agent **)calloc(n_selected, sizeof(Agent *)); /* allocating the array of hunters */
-  /* putting each of the selected lionesses randomly in to the Hunters array */
-  for (i = 0; i < s->pride_id[pride].n_females; i++)
+  /* putting the selected lionesses in a random order into the Hunters array */
+  for (i = n_selected - 1; i > 0; i--)
   {
-    if (selected_females[i])
-    {
-      /* try a position on the array. repeat until find a empty slot (Hunters[index] == 0)*/
-      do
-      {
-        index = (int)GenerateUniformRandomNumber(0, n_selected - 0.001);
-      } while (Hunters[index] != 0);
-      Hunters[index] = s->pride_id[pride].females[i];
-    }
+    j = (int)GenerateUniformRandomNumber(0, i + 0.999);
+    aux = Hunters[i];
+    Hunters[i] = Hunters[j];
+    Hunters[j] = aux;
   }
 
   /* determining the interval of indexes of each group */
@@ -72,9 +118,6 @@ void Hunting(SearchSpace *s, int pride, int *selected_females, prtFun Evaluate,
   range_group[2][0] = group[0] + group[1];
   range_group[2][1] = group[0] + group[1] + group[2];
 
-  /* dealocating the group counter array */
-  free(group);
-
   /* determining the cumulative finesses for each group */
   for (i = 0; i < 3; i++)
   {
@@ -90,14 +133,11 @@ void Hunting(SearchSpace *s, int pride, int *selected_females, prtFun Evaluate,
       center_index = i;
   }
 
-  /* dealocating the cumulative finesses array */
-  free(cumulative_finesses);
-
   /* Generating a Prey in center of hunters*/
-  Prey = (double *)calloc(s->n, sizeof(double));
   /* for each decision variable if the prey */
   for (i = 0; i < s->n; i++)
   {
+    Prey[i] = 0;
     /* for each  selected lioness */
     for (j = 0; j < n_selected; j++)
       Prey[i] += Hunters[j]->x[i];
@@ -150,9 +190,6 @@ void Hunting(SearchSpace *s, int pride, int *selected_females, prtFun Evaluate,
         Prey[j] = Prey[j] + GenerateUniformRandomNumber(0, 1) * improve_perc * (Prey[j] - Hunters[i]->x[j]);
     }
   }
-
-  free(Prey);
-  free(Hunters);
 }
 
 /* In each pride, remained females go toward a safe place
@@ -165,15 +202,14 @@ arg: list of additional arguments */
 void MovingSafePlace(SearchSpace *s, int pride, int *selected_females, prtFun Evaluate, va_list arg)
 {
   int i, j;
-  int tournament_size, index, pride_size, territory_index;
-  int sucess = 0;               /* counter of how many lions improved its fitness in the last iteration */
-  char *selected = NULL;         /* binary array that indicates if a agent was already selected (1) for tournament or not (0) */
-  Agent **pride_members = NULL; /* array of all agents of the pride */
-  double r1[s->n];              /* vector of direction */
-  double *r2 = NULL;            /* pointer to vector of direction perpendicular to r1 */
+  int tournament_size, pride_size, territory_index;
+  int sucess = 0;                                     /* counter of how many lions improved its fitness in the last iteration */
+  int *index = s->pride_id[pride].index;              /* indexes of the lions selected for tournament */
+  Agent **pride_members = s->pride_id[pride].members; /* array of all agents of the pride */
+  double *r1 = s->pride_id[pride].prey + s->n;        /* vector of direction */
+  double *r2 = s->pride_id[pride].prey + 2 * s->n;    /* vector of direction perpendicular to r1 */
 
   pride_size = s->pride_id[pride].n_females + s->pride_id[pride].n_males; /* pride size is the number of males + the number of females */
-  pride_members = (Agent **)malloc(pride_size * sizeof(Agent *));         /* allocating the array of members */
 
   /* for each female in the pride */
   for (i = 0; i < s->pride_id[pride].n_females; i++)
@@ -193,8 +229,7 @@ void MovingSafePlace(SearchSpace *s, int pride, int *selected_females, prtFun Ev
       sucess++;
   }
 
-  selected = (char *)calloc(pride_size, sizeof(char)); /* allocating the binary array */
-  tournament_size = (int)fmax(2, ceil(sucess / 2));  /* determining the tournament size */
+  tournament_size = (int)fmin(pride_size, fmax(2, ceil(sucess / 2))); /* determining the tournament size */
 
   /* for each female in the pride */
   for (i = 0; i < s->pride_id[pride].n_females; i++)
@@ -202,24 +237,16 @@ void MovingSafePlace(SearchSpace *s, int pride, int *selected_females, prtFun Ev
     /* if the ith female is not hunting */
     if (!selected_females[i])
     {
-
-      /* determinig which lion will be select to tournament */
-      for (j = 0; j < tournament_size; j++)
-      {
-        do
-        {
-          index = (int)GenerateUniformRandomNumber(0, pride_size - 0.001);
-        } while (selected[index]);
-        selected[index] = 1; /* mark as selected */
-      }
+      /* determinig which lions will be selected to tournament */
+      PickIndexes(index, pride_size, tournament_size);
 
       /* determinig the best territory (winner of the tournament) */
-      territory_index = 0;
-      for (j = 1; j < pride_size; j++)
+      territory_index = index[0];
+      for (j = 1; j < tournament_size; j++)
       {
-        /* if the territory was selected for tournament AND the jth territory is better than the index-th */
-        if ((selected[j]) && (pride_members[j]->best_fit < pride_members[territory_index]->best_fit))
-          territory_index = j;
+        /* if the jth territory is better than the index-th */
+        if (pride_members[index[j]]->best_fit < pride_members[territory_index]->best_fit)
+          territory_index = index[j];
       }
 
       /* determing the vector of direction from female previous position to the selected position (territory) */
@@ -228,7 +255,7 @@ void MovingSafePlace(SearchSpace *s, int pride, int *selected_females, prtFun Ev
         r1[j] = pride_members[territory_index]->xl[j] - s->pride_id[pride].females[i]->prev_x[j];
 
       /* determing the r2 vector (perpendicular to r1)*/
-      r2 = GetPerpendicularVector(r1, s->n);
+      FillPerpendicularVector(r1, s->n, r2);
 
       /* making the magnitude of r2 1 */
       NormalizeVector(r2, s->n);
@@ -244,18 +271,8 @@ void MovingSafePlace(SearchSpace *s, int pride, int *selected_females, prtFun Ev
 
       CheckAgentLimits(s, s->pride_id[pride].females[i]);
       EvaluateAgent(s, s->pride_id[pride].females[i], _LOA_, Evaluate, arg);
-
-      /* if is not the last female */
-      if (i < s->pride_id[pride].n_females - 1)
-      {
-        /* reset the selected array for the next tournament */
-        memset(selected, 0, sizeof(char) * pride_size);
-      }
-      free(r2);
     }
   }
-  free(pride_members);
-  free(selected);
 }
 
 /* In each pride, male lions roams in that pride's territory(best position of each lion in the pride)
@@ -267,13 +284,12 @@ arg: list of additional arguments */
 void Roaming(SearchSpace *s, int pride, prtFun Evaluate, va_list arg)
 {
   int i, j, k;
-  int pride_size, n_territory, index;
-  int *selected = NULL;
-  Agent **pride_members = NULL;
+  int pride_size, n_territory;
+  int *index = s->pride_id[pride].index;              /* indexes of the visited territories */
+  Agent **pride_members = s->pride_id[pride].members; /* array of all agents of the pride */
   double step, angle, distance;
 
   pride_size = s->pride_id[pride].n_males + s->pride_id[pride].n_females;
-  pride_members = (Agent **)malloc(pride_size * sizeof(Agent *));
 
   /* for each female in the pride */
   for (i = 0; i < s->pride_id[pride].n_females; i++)
@@ -283,40 +299,28 @@ void Roaming(SearchSpace *s, int pride, prtFun Evaluate, va_list arg)
   for (i = 0; i < s->pride_id[pride].n_males; i++)
     pride_members[i + s->pride_id[pride].n_females] = s->pride_id[pride].males[i]; /* pointing to the males of the pride */
 
-  selected = (int *)calloc(pride_size, sizeof(int));
-
   /* determining the size of the territory */
-  n_territory = round(s->roaming_percent * pride_size);
+  n_territory = (int)fmin(pride_size, round(s->roaming_percent * pride_size));
 
   /* for each male in pride */
   for (i = 0; i < s->pride_id[pride].n_males; i++)
   {
     /* randomly selecting n_territory places of pride's territory */
+    PickIndexes(index, pride_size, n_territory);
+
+    /* for each selected territory */
     for (j = 0; j < n_territory; j++)
     {
-      do
-      {
-        index = (int)GenerateUniformRandomNumber(0, pride_size - 0.001);
-      } while (selected[index]);
-      selected[index] = 1; /* mark as selected */
-    }
-    /* for each territory */
-    for (j = 0; j < pride_size; j++)
-    {
-      /* if the jth territory was selected */
-      if (selected[j])
-      {
-        angle = GenerateUniformRandomNumber(-M_PI / 6, M_PI / 6);
-        distance = EuclideanDistance(s->pride_id[pride].males[i]->x, pride_members[j]->xl, s->n);
-        step = GenerateUniformRandomNumber(0, 2 * distance);
-        /* for each decision variable */
-        for (k = 0; k < s->n; k++)
-          s->pride_id[pride].males[i]->x[k] = s->pride_id[pride].males[i]->x[k] + step + angle; /* Updates the actual male position */
+      angle = GenerateUniformRandomNumber(-M_PI / 6, M_PI / 6);
+      distance = EuclideanDistance(s->pride_id[pride].males[i]->x, pride_members[index[j]]->xl, s->n);
+      step = GenerateUniformRandomNumber(0, 2 * distance);
+      /* for each decision variable */
+      for (k = 0; k < s->n; k++)
+        s->pride_id[pride].males[i]->x[k] = s->pride_id[pride].males[i]->x[k] + step + angle; /* Updates the actual male position */
 
-        CheckAgentLimits(s, s->pride_id[pride].males[i]);
+      CheckAgentLimits(s, s->pride_id[pride].males[i]);
 
-        EvaluateAgent(s, s->pride_id[pride].males[i], _LOA_, Evaluate, arg);
-      }
+      EvaluateAgent(s, s->pride_id[pride].males[i], _LOA_, Evaluate, arg);
     }
     /* saving the last fitness value */
     s->pride_id[pride].males[i]->pfit = s->pride_id[pride].males[i]->fit;
@@ -325,17 +329,7 @@ void Roaming(SearchSpace *s, int pride, prtFun Evaluate, va_list arg)
     /* for each decision variable */
     for (k = 0; k < s->n; k++)
       s->pride_id[pride].males[i]->x[k] = s->pride_id[pride].males[i]->xl[k];
-
-    /* if is not the last male */
-    if (i < s->pride_id[pride].n_males - 1)
-    {
-      /* reset the selected array for the next random selection */
-      for (j = 0; j < pride_size; j++)
-        selected[j] = 0;
-    }
   }
-  free(pride_members);
-  free(selected);
 }
 
 /* Nomad lions (female and male) move randomly in search space
@@ -395,79 +389,47 @@ void Mating(SearchSpace *s, int pride, int *n_offsprings, prtFun Evaluate, va_li
 {
   int i, j, k;
   int n_matting_females = 0, n_matting_males = 0;
-  int male_index = s->pride_id[pride].n_males;     /* index position indicator for the new array of porintes (male) */
-  int female_index = s->pride_id[pride].n_females; /* index position indicator for the new array of porintes (female) */
-  int *selected_female = NULL;                     /* array indicating if a female was selected for matting */
-  int *selected_male = NULL;                       /* array indicating if a male was selected for matting */
+  int male_index = s->pride_id[pride].n_males;                                  /* index position of the next male cub */
+  int female_index = s->pride_id[pride].n_females;                              /* index position of the next female cub */
+  char *selected_female = s->pride_id[pride].flag;                              /* array indicating if a female was selected for matting */
+  char *selected_male = s->pride_id[pride].flag + s->pride_id[pride].n_females; /* array indicating if a male was selected for matting */
   double prob, Beta, sum;
-  Agent **temp_males = NULL;   /* array of pointes to allocate new male cubs */
-  Agent **temp_females = NULL; /* array of pointes to allocate new female cubs */
   /* each  selected female generate 2 cubs, a male and a female */
   Agent *offspring1 = NULL;
   Agent *offspring2 = NULL;
 
-  /* allocating the 'selected' arrays */
-  selected_female = (int *)calloc(s->pride_id[pride].n_females, sizeof(int));
-  selected_male = (int *)calloc(s->pride_id[pride].n_males, sizeof(int));
-
   /* determining the number of female lions that will mate and which ones */
   for (i = 0; i < s->pride_id[pride].n_females; i++)
   {
     prob = GenerateUniformRandomNumber(0, 1);
-    if (prob <= s->mating_prob)
-    {
-      n_matting_females++;
-      selected_female[i] = 1; /* mark the female as selected */
-    }
+    selected_female[i] = (prob <= s->mating_prob); /* mark the female as selected */
+    n_matting_females += selected_female[i];
   }
 
   /* determining the number of offsprings */
   *n_offsprings = 2 * n_matting_females; /* half males and half females */
 
-  /* allocating the new arrays of agents*/
-  temp_males = (Agent **)malloc((s->pride_id[pride].n_males + (int)(*n_offsprings / 2)) * sizeof(Agent *));
-  temp_females = (Agent **)malloc((s->pride_id[pride].n_females + (int)(*n_offsprings / 2)) * sizeof(Agent *));
-
-  /* copying the old arrays of agents to the new ones*/
-  /* for males */
-  for (i = 0; i < s->pride_id[pride].n_males; i++)
-    temp_males[i] = s->pride_id[pride].males[i];
-  /* for females */
-  for (i = 0; i < s->pride_id[pride].n_females; i++)
-    temp_females[i] = s->pride_id[pride].females[i];
-
-  /* dealocating the old arrays of agents */
-  free(s->pride_id[pride].males);
-  free(s->pride_id[pride].females);
-
-  /* pointing the old ones to the new ones */
-  s->pride_id[pride].males = temp_males;
-  s->pride_id[pride].females = temp_females;
-
   /* Generating the offsprings */
   /* for each old female selected for matting */
   for (i = 0; i < s->pride_id[pride].n_females; i++)
   {
     if (selected_female[i])
     {
-      n_matting_males = 0;
       /* the selected female needs to mate with, at least, one male. */
       do
       {
+        n_matting_males = 0;
         /* determining which males and how many will matte with the ith female (50% each) */
         for (j = 0; j < s->pride_id[pride].n_males; j++)
         {
           prob = GenerateUniformRandomNumber(0, 1);
-          if (prob <= 0.5)
-          {
-            selected_male[j] = 1; /* mark the female as selected */
-            n_matting_males++;
-          }
+          selected_male[j] = (prob <= 0.5); /* mark the male as selected */
+          n_matting_males += selected_male[j];
         }
       } while (n_matting_males == 0);
-      /* allocating the offsprings */
-      offspring1 = CreateAgent(s->n, _LOA_, _NOTENSOR_);
-      offspring2 = CreateAgent(s->n, _LOA_, _NOTENSOR_);
+      /* taking the offsprings from the pool */
+      offspring1 = GetLion(s);
+      offspring2 = GetLion(s);
       Beta = GenerateGaussianRandomNumber(0.5, 0.01); /* 0.01 indicates variance. The stand deviation is 0.1 */
       /* for each decision variable */
       for (j = 0; j < s->n; j++)
@@ -530,21 +492,8 @@ void Mating(SearchSpace *s, int pride, int *n_offsprings, prtFun Evaluate, va_li
       /* moving the idexes */
       male_index++;
       female_index++;
-      /* zeroing the agents pointes */
-      offspring1 = NULL;
-      offspring2 = NULL;
-      /* if is not the last iteraction */
-      if (i < s->pride_id[pride].n_females - 1)
-      {
-        /* reseting the selected_males array */
-        for (j = 0; j < s->pride_id[pride].n_males; j++)
-          selected_male[j] = 0;
-      }
     }
   }
-
-  free(selected_female);
-  free(selected_male);
 }
 
 /* A nomad female mate with one nomad male with a determined probability, producing 2 offsprings(a male and a female)
@@ -556,56 +505,28 @@ Evaluate: pointer to the function used to evaluate the cubs
 arg: list of additional arguments */
 void NomadMating(SearchSpace *s, int *n_offsprings, int extra_male_nomads, prtFun Evaluate, va_list arg)
 {
-  int i, j, k;
+  int i, j;
   int n_matting_females = 0;
-  int male_index = s->n_male_nomads + extra_male_nomads; /* index position indicator for the new array of porintes (male) */
-  int female_index = s->n_female_nomads;                 /* index position indicator for the new array of porintes (female) */
-  int *selected_female = NULL;                           /* array indicating if a female was selected for matting */
+  int male_index = s->n_male_nomads + extra_male_nomads; /* index position of the next male cub */
+  int female_index = s->n_female_nomads;                 /* index position of the next female cub */
+  char *selected_female = s->lion_flag;                  /* array indicating if a female was selected for matting */
   int selected_male;                                     /* index of selected male */
   double prob, Beta;
-  Agent **temp_males = NULL;   /* array of pointes to allocate new male cubs */
-  Agent **temp_females = NULL; /* array of pointes to allocate new female cubs */
   /* each  selected female generate 2 cubs, a male and a female */
   Agent *offspring1 = NULL;
   Agent *offspring2 = NULL;
 
-  /* allocating the 'selected' arrays */
-  selected_female = (int *)calloc(s->n_female_nomads, sizeof(int));
-
   /* determining the number of female lions that will mate and which ones */
   for (i = 0; i < s->n_female_nomads; i++)
   {
     prob = GenerateUniformRandomNumber(0, 1);
-    if (prob <= s->mating_prob)
-    {
-      n_matting_females++;
-      selected_female[i] = 1; /* mark the female as selected */
-    }
+    selected_female[i] = (prob <= s->mating_prob); /* mark the female as selected */
+    n_matting_females += selected_female[i];
   }
 
   /* determining the number of offsprings */
   *n_offsprings = 2 * n_matting_females; /* half males and half females */
 
-  /* allocating the new arrays of agents*/
-  temp_males = (Agent **)malloc((s->n_male_nomads + extra_male_nomads + (int)(*n_offsprings / 2)) * sizeof(Agent *));
-  temp_females = (Agent **)malloc((s->n_female_nomads + (int)(*n_offsprings / 2)) * sizeof(Agent *));
-
-  /* copying the old arrays of agents to the new ones*/
-  /* for males */
-  for (i = 0; i < s->n_male_nomads + extra_male_nomads; i++)
-    temp_males[i] = s->male_nomads[i];
-  /* for females */
-  for (i = 0; i < s->n_female_nomads; i++)
-    temp_females[i] = s->female_nomads[i];
-
-  /* dealocating the old arrays of agents */
-  free(s->male_nomads);
-  free(s->female_nomads);
-
-  /* pointing the old ones to the new ones */
-  s->male_nomads = temp_males;
-  s->female_nomads = temp_females;
-
   /* Generating the offsprings */
   /* for each old female selected for matting */
   for (i = 0; i < s->n_female_nomads; i++)
@@ -614,9 +535,9 @@ void NomadMating(SearchSpace *s, int *n_offsprings, int extra_male_nomads, prtFu
     {
       /* selecting a random male for mating with the ith selected female */
       selected_male = (int)GenerateUniformRandomNumber(0, s->n_male_nomads + extra_male_nomads - 0.001);
-      /* allocating the offsprings */
-      offspring1 = CreateAgent(s->n, _LOA_, _NOTENSOR_);
-      offspring2 = CreateAgent(s->n, _LOA_, _NOTENSOR_);
+      /* taking the offsprings from the pool */
+      offspring1 = GetLion(s);
+      offspring2 = GetLion(s);
       Beta = GenerateGaussianRandomNumber(0.5, 0.01); /* 0.01 indicates variance. The standard deviation is 0.1 */
       /* for each decision variable */
       for (j = 0; j < s->n; j++)
@@ -672,12 +593,8 @@ void NomadMating(SearchSpace *s, int *n_offsprings, int extra_male_nomads, prtFu
       /* moving the idexes */
       male_index++;
       female_index++;
-      /* zeroing the agents pointes */
-      offspring1 = NULL;
-      offspring2 = NULL;
     }
   }
-  free(selected_female);
 }
 
 /* In each pride, male lions become mature and fight with other males in their pride. Beaten males abandon their pride and become a nomad
@@ -689,35 +606,13 @@ extra_male_nomads: number of extra male nomads that moved out from the prides */
 void Defense(SearchSpace *s, int pride, int n_male_offsprings, int extra_male_nomads)
 {
   int i;
-  Agent **new_residents = NULL;
-  Agent **temp_nomads = NULL;
 
   /* sorting male lions by fitness */
   qsort(s->pride_id[pride].males, s->pride_id[pride].n_males + n_male_offsprings, sizeof(Agent **), SortAgent);
 
-  /* allocating the new arrays of agents*/
-  new_residents = (Agent **)malloc(s->pride_id[pride].n_males * sizeof(Agent *));
-  temp_nomads = (Agent **)malloc((s->n_male_nomads + extra_male_nomads + n_male_offsprings) * sizeof(Agent *));
-
-  /* copying the best agents of the old array to the new one */
-  /* for resident males */
-  for (i = 0; i < s->pride_id[pride].n_males; i++)
-    new_residents[i] = s->pride_id[pride].males[i];
-  /* for nomad males */
-  for (i = 0; i < s->n_male_nomads + extra_male_nomads; i++)
-    temp_nomads[i] = s->male_nomads[i];
-
-  /* adding the excess of males in pride to nomad males array */
+  /* the best males stay as residents, and the excess of males in pride is appended to the nomad males array */
   for (i = 0; i < n_male_offsprings; i++)
-    temp_nomads[i + s->n_male_nomads + extra_male_nomads] = s->pride_id[pride].males[i + s->pride_id[pride].n_males];
-
-  /* dealocating the old arrays of agents */
-  free(s->male_nomads);
-  free(s->pride_id[pride].males);
-
-  /* pointing the old ones to the new ones */
-  s->male_nomads = temp_nomads;
-  s->pride_id[pride].males = new_residents;
+    s->male_nomads[i + s->n_male_nomads + extra_male_nomads] = s->pride_id[pride].males[i + s->pride_id[pride].n_males];
 }
 
 /* Every nomad lion try to atack some prides, if the nomad is stronger (best fitness) than lion from the pride, they swap its positions
@@ -770,11 +665,9 @@ extra_nomads: number of extra female nomads after pride females become nomads
 n_migrating: array that each index contains the number of females that will migrate from each pride */
 void Migration(SearchSpace *s, int *n_offsprings, int n_nomad_female_offspring, int *extra_nomads, int *n_migrating)
 {
-  int i, j, k;
-  int *selected = NULL; /* binary array that indicates if a female from a pride will migrate */
-  int nomad_index, female_pride_index, index;
-  Agent **temp_nomads = NULL;
-  Agent **temp_female_pride = NULL;
+  int i, j, n_candidates;
+  char *selected = NULL; /* binary array that indicates if a female from a pride will migrate */
+  int nomad_index, female_pride_index;
 
   nomad_index = s->n_female_nomads + n_nomad_female_offspring; /* start point index to insert migrating females */
   /* determining the number of females that will migrate from each pride */
@@ -784,35 +677,21 @@ void Migration(SearchSpace *s, int *n_offsprings, int n_nomad_female_offspring,
     n_migrating[i] = round(s->imigration_rate * s->pride_id[i].n_females) + (int)(n_offsprings[i] / 2);
     *extra_nomads += n_migrating[i];
   }
-  /* allocating the new array of female nomads */
-  temp_nomads = (Agent **)malloc((s->n_female_nomads + n_nomad_female_offspring + *extra_nomads) * sizeof(Agent *));
-  /* copying the old female nomads to the new array */
-  for (i = 0; i < s->n_female_nomads + n_nomad_female_offspring; i++)
-    temp_nomads[i] = s->female_nomads[i];
-
-  /* freeing the old array of nomads */
-  free(s->female_nomads);
-  /* pointng to the new array of nomads */
-  s->female_nomads = temp_nomads;
 
   /* for each pride */
   for (i = 0; i < s->n_prides; i++)
   {
     female_pride_index = 0;
-    /* allocating the new array of females of ith pride leaving space for nomad females get in (next step of LOA) */
-    temp_female_pride = (Agent **)malloc((s->pride_id[i].n_females) * sizeof(Agent *));
-    selected = (int *)calloc(s->pride_id[i].n_females + (int)(n_offsprings[i] / 2), sizeof(int));
+    n_candidates = s->pride_id[i].n_females + (int)(n_offsprings[i] / 2);
+    selected = s->pride_id[i].flag;
     /* determining which females will migrate from ith pride */
+    PickIndexes(s->pride_id[i].index, n_candidates, n_migrating[i]);
+    memset(selected, 0, n_candidates * sizeof(char));
     for (j = 0; j < n_migrating[i]; j++)
-    {
-      do
-      {
-        index = (int)GenerateUniformRandomNumber(0, (s->pride_id[i].n_females + (int)(n_offsprings[i] / 2)) - 0.001);
-      } while (selected[index]);
-      selected[index] = 1; /* mark as selected */
-    }
+      selected[s->pride_id[i].index[j]] = 1; /* mark as selected */
+
     /* for each female in ith pride */
-    for (j = 0; j < s->pride_id[i].n_females + (int)(n_offsprings[i] / 2); j++)
+    for (j = 0; j < n_candidates; j++)
     {
       if (selected[j])
       {                                                            /* if the female was selected for migration */
@@ -820,16 +699,84 @@ void Migration(SearchSpace *s, int *n_offsprings, int n_nomad_female_offspring,
         nomad_index++;
       }
       else
-      {                                                                    /* copy the pride female to the new array of females of the pride */
-        temp_female_pride[female_pride_index] = s->pride_id[i].females[j]; /* stays in pride */
+      {                                                                                /* keeps the pride female, leaving the empty places at the end of the array */
+        s->pride_id[i].females[female_pride_index] = s->pride_id[i].females[j]; /* stays in pride */
         female_pride_index++;
       }
     }
-    /* freeing the old females of the pride array */
-    free(s->pride_id[i].females);
-    /* pointing to the new array */
-    s->pride_id[i].females = temp_female_pride;
-    free(selected);
+  }
+}
+
+/* It runs the pride phase (hunting, moving toward a safe place, roaming and mating) of every pride on its own worker.
+Each worker owns a shallow copy of the search space with its own global best, evaluation counters, RNG stream and slice
+of the pool of lions, which are merged back into the search space once all prides are done.
+Parameters:
+s: search space
+worker: array of n_prides search spaces used by the workers
+selected_females: binary array with one position per pride female
+n_offsprings: array that each index will contain the number of offsprings of each pride generated by mating
+Evaluate: pointer to the function used to evaluate lions
+arg: list of additional arguments */
+void RunPridesInParallel(SearchSpace *s, SearchSpace *worker, int *selected_females, int *n_offsprings, prtFun Evaluate, va_list arg)
+{
+  int i, j, n_females = 0, n_cubs = 0;
+  int *seed = s->pride_count + 3 * s->n_prides;              /* seed of the RNG stream of each pride, plus one to resume the caller's stream */
+  int *female_offset = s->pride_count + 4 * s->n_prides + 1; /* position of the first female of each pride in 'selected_females' */
+  Agent **cub = NULL;             /* lions of the pool reserved to the prides */
+
+  /* the seeds are drawn sequentially, so the outcome does not depend on the number of threads */
+  for (i = 0; i <= s->n_prides; i++)
+    seed[i] = (int)GenerateUniformRandomNumber(1, 2147483646);
+
+  for (i = 0; i < s->n_prides; i++)
+    n_cubs += 2 * s->pride_id[i].n_females;
+  cub = s->free_lion + s->n_free_lions - n_cubs;
+  s->n_free_lions -= n_cubs;
+
+  for (i = 0; i < s->n_prides; i++)
+  {
+    worker[i] = *s;
+    worker[i].g = s->pride_id[i].g;
+    worker[i].stop.n_evaluations = 0;
+    worker[i].stop.n_infeasible = 0;
+    worker[i].surrogate = NULL;                  /* the archive is not thread-safe */
+    worker[i].free_lion = cub;                   /* every pride takes its cubs from its own slice of the pool */
+    worker[i].n_free_lions = 2 * s->pride_id[i].n_females;
+    cub += worker[i].n_free_lions;
+    female_offset[i] = n_females;
+    n_females += s->pride_id[i].n_females;
+  }
+
+#pragma omp parallel for schedule(dynamic) num_threads(s->n_threads)
+  for (i = 0; i < s->n_prides; i++)
+  {
+    va_list worker_arg;
+
+    PinWorker(s);
+    va_copy(worker_arg, arg);
+    srandinter(seed[i]);
+    Hunting(&worker[i], i, selected_females + female_offset[i], Evaluate, worker_arg);
+    MovingSafePlace(&worker[i], i, selected_females + female_offset[i], Evaluate, worker_arg);
+    Roaming(&worker[i], i, Evaluate, worker_arg);
+    Mating(&worker[i], i, &n_offsprings[i], Evaluate, worker_arg);
+    va_end(worker_arg);
+    UnpinWorker();
+  }
+  srandinter(seed[s->n_prides]);
+
+  /* reduction: global best, evaluation counters and unused cubs */
+  for (i = 0; i < s->n_prides; i++)
+  {
+    s->stop.n_evaluations += worker[i].stop.n_evaluations;
+    s->stop.n_infeasible += worker[i].stop.n_infeasible;
+    if (worker[i].gfit < s->gfit)
+    {
+      s->gfit = worker[i].gfit;
+      for (j = 0; j < s->n; j++)
+        s->g[j] = worker[i].g[j];
+    }
+    memmove(s->free_lion + s->n_free_lions, worker[i].free_lion, worker[i].n_free_lions * sizeof(Agent *));
+    s->n_free_lions += worker[i].n_free_lions;
   }
 }
 
@@ -839,32 +786,54 @@ s: search space
 Evaluate: pointer to the function used to evaluate the cubs */
 void runLOA(SearchSpace *s, prtFun Evaluate, ...)
 {
-  va_list arg;
-  int i, k;
+  va_list arg, argtmp;
+  int i, j, k, aux;
   int *selected_females = NULL; /* binary array indicating if a female is hunting or not */
-  int n_nomad_offspring, extra_male_nomads, extra_female_nomads, n_fill, pride_index;
-  int empty_places[s->n_prides];      /* array that each index indicates the number of empty places in a pride */
-  int n_pride_offspring[s->n_prides]; /* array that each index indicates the number of offsprings generated by a pride */
-  int n_migrating[s->n_prides];       /* array that indicates the number of females that will migrate from the pride indicated by the index (will be filled in 'Migration')*/
-  Agent **new_nomads = NULL;
+  int n_nomad_offspring, extra_male_nomads, extra_female_nomads, n_fill, n_female_candidates, n_male_candidates;
+  int *empty_places = s->pride_count;                     /* array that each index indicates the number of empty places in a pride */
+  int *n_pride_offspring = s->pride_count + s->n_prides;  /* array that each index indicates the number of offsprings generated by a pride */
+  int *n_migrating = s->pride_count + 2 * s->n_prides;    /* array that indicates the number of females that will migrate from the pride indicated by the index (will be filled in 'Migration')*/
+  int *slot = NULL;                   /* pride of each empty place, shuffled to distribute the best nomad females */
+  SearchSpace *worker = NULL;         /* search spaces of the workers (parallel mode) */
   va_start(arg, Evaluate);
+  va_copy(argtmp, arg);
+
+  /* every pride female has its own position in the hunting array */
+  k = 0;
+  for (i = 0; i < s->n_prides; i++)
+    k += s->pride_id[i].n_females;
+  selected_females = (int *)malloc((k + 1) * sizeof(int));
+  slot = s->lion_index;
+  if (s->n_threads > 1)
+    worker = (SearchSpace *)malloc(s->n_prides * sizeof(SearchSpace));
 
+  ResetTermination(s); /* It starts counting evaluations, time and stagnation */
   EvaluateSearchSpace(s, _LOA_, Evaluate, arg); /* Initial evaluation */
-  for (k = 0; k < s->iterations; k++)
+  for (k = 0; !StopOptimization(s, k + 1); k++)
   {
     fprintf(stderr, "\nRunning iteration %d/%d ... ", k + 1, s->iterations);
     /* For each pride */
+    if (worker)
+    {
+      va_copy(arg, argtmp);
+      RunPridesInParallel(s, worker, selected_females, n_pride_offspring, Evaluate, arg);
+    }
+    else
+    {
+      for (i = 0; i < s->n_prides; i++)
+      {
+        Hunting(s, i, selected_females, Evaluate, arg); /* Random selected females go hunting */
+        MovingSafePlace(s, i, selected_females, Evaluate, arg); /* the rest of females go toward a safe place*/
+        Roaming(s, i, Evaluate, arg); /* each male in a pride roams in that pride's territory */
+        Mating(s, i, &n_pride_offspring[i], Evaluate, arg);
+      }
+    }
+    /* the beaten males of every pride become nomads */
     extra_male_nomads = 0;
     for (i = 0; i < s->n_prides; i++)
     {
-      selected_females = (int *)calloc(s->pride_id[i].n_females, sizeof(int));
-      Hunting(s, i, selected_females, Evaluate, arg); /* Random selected females go hunting */
-      MovingSafePlace(s, i, selected_females, Evaluate, arg); /* the rest of females go toward a safe place*/
-      Roaming(s, i, Evaluate, arg); /* each male in a pride roams in that pride's territory */
-      Mating(s, i, &n_pride_offspring[i], Evaluate, arg);
       Defense(s, i, (int)(n_pride_offspring[i] / 2), extra_male_nomads);
       extra_male_nomads += (int)(n_pride_offspring[i] / 2);
-      free(selected_females);
     }
     /* For Nomads */
     NomadMovingRandom(s, extra_male_nomads, Evaluate, arg);
@@ -877,56 +846,49 @@ void runLOA(SearchSpace *s, prtFun Evaluate, ...)
     /**** POPULATION EQUILIBRIUM ****/
     /* some nomad females will become pride females, and the worst nomad females will die */
     /* sorting nomad females */
-    qsort(s->female_nomads, s->n_female_nomads + (int)(n_nomad_offspring / 2) + extra_female_nomads, sizeof(Agent **), SortAgent);
+    n_female_candidates = s->n_female_nomads + (int)(n_nomad_offspring / 2) + extra_female_nomads;
+    qsort(s->female_nomads, n_female_candidates, sizeof(Agent **), SortAgent);
     /* determinig the number of empty places in each pride and the total number of empty places */
     n_fill = 0;
     for (i = 0; i < s->n_prides; i++)
     {
       empty_places[i] = n_migrating[i] - (int)(n_pride_offspring[i] / 2);
-      n_fill += empty_places[i];
+      for (j = 0; j < empty_places[i]; j++)
+        slot[n_fill++] = i;
+    }
+    /* the n_fill first (best) nomad females are distributed randomly to prides to fill the empty places */
+    for (i = n_fill - 1; i > 0; i--)
+    {
+      j = (int)GenerateUniformRandomNumber(0, i + 0.999);
+      aux = slot[i];
+      slot[i] = slot[j];
+      slot[j] = aux;
     }
-    /* the n_fill first females will be distributed randomly to prides to fill the empty places */
-    /* for the first n_fill (best) nomad females */
     for (i = 0; i < n_fill; i++)
     {
-      do
-      {
-        pride_index = (int)GenerateUniformRandomNumber(0, s->n_prides - 0.001);          /* destination pride of the ith nomad female */
-      } while (!empty_places[pride_index]);                                              /* checks if the pride still have empty places to fill */
-      int female_index = s->pride_id[pride_index].n_females - empty_places[pride_index]; /* the index to fill the first empty place in the array of females in pride */
-      s->pride_id[pride_index].females[female_index] = s->female_nomads[i];
-      empty_places[pride_index]--;
+      /* the index to fill the first empty place in the array of females in pride */
+      int female_index = s->pride_id[slot[i]].n_females - empty_places[slot[i]];
+      s->pride_id[slot[i]].females[female_index] = s->female_nomads[i];
+      empty_places[slot[i]]--;
     }
-    /* Allocating the new array of female nomads (removing the worst(die) and the best(fill pride) females ) */
-    new_nomads = (Agent **)malloc(s->n_female_nomads * sizeof(Agent *));
-    /* saving the nomads that will remain nomads */
-    for (i = 0; i < s->n_female_nomads; i++)
-      new_nomads[i] = s->female_nomads[n_fill + i];
-    /* dealocating the worst female nomads */
-    for (i = n_fill + s->n_female_nomads; i < (s->n_female_nomads + (int)(n_nomad_offspring / 2) + extra_female_nomads); i++)
-      DestroyAgent(&(s->female_nomads[i]), _LOA_);
-    /* freeing the old array of nomads */
-    free(s->female_nomads);
-    /* pointing to the new one */
-    s->female_nomads = new_nomads;
+    /* the worst female nomads die and go back to the pool */
+    for (i = n_fill + s->n_female_nomads; i < n_female_candidates; i++)
+      ReleaseLion(s, s->female_nomads[i]);
+    /* the remaining ones are moved to the beginning of the array of nomads */
+    memmove(s->female_nomads, s->female_nomads + n_fill, s->n_female_nomads * sizeof(Agent *));
 
     /* the worst males will die */
     /* sorting nomad males */
-    qsort(s->male_nomads, s->n_male_nomads + (int)(n_nomad_offspring / 2) + extra_male_nomads, sizeof(Agent **), SortAgent);
-    /* Allocating the new array of male nomads */
-    new_nomads = (Agent **)malloc(s->n_male_nomads * sizeof(Agent *));
-    /* saving the best nomads (will remain nomads) */
-    for (i = 0; i < s->n_male_nomads; i++)
-      new_nomads[i] = s->male_nomads[i];
-    /* dealocating the worst male nomads */
-    for (i = s->n_male_nomads; i < s->n_male_nomads + extra_male_nomads + (int)(n_nomad_offspring / 2); i++)
-      DestroyAgent(&(s->male_nomads[i]), _LOA_);
-    /* freeing the old array of nomads */
-    free(s->male_nomads);
-    /* pointing to the new one */
-    s->male_nomads = new_nomads;
+    n_male_candidates = s->n_male_nomads + (int)(n_nomad_offspring / 2) + extra_male_nomads;
+    qsort(s->male_nomads, n_male_candidates, sizeof(Agent **), SortAgent);
+    /* the worst male nomads die and go back to the pool */
+    for (i = s->n_male_nomads; i < n_male_candidates; i++)
+      ReleaseLion(s, s->male_nomads[i]);
 
     fprintf(stderr, "OK (minimum fitness value %lf)", s->gfit);
   }
+  free(selected_females);
+  if (worker)
+    free(worker);
   va_end(arg);
-}
\ No newline at end of file
+}
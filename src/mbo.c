@@ -16,37 +16,71 @@ limitations under the License.
 
 #include "mbo.h"
 
-/* It updates the neighbours of a single bird
+/* It draws random positions for a block of candidate neighbours
+Parameters:
+s: search space
+candidate: array of candidate neighbours
+n_candidates: number of candidates */
+void GenerateNeighbours(SearchSpace *s, Agent **candidate, int n_candidates)
+{
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @GenerateNeighbours.\n");
+        exit(-1);
+    }
+    int i, j;
+
+    for (i = 0; i < n_candidates; i++)
+        for (j = 0; j < s->n; j++)
+            candidate[i]->x[j] = GenerateUniformRandomNumber(s->LB[j], s->UB[j]);
+}
+
+/* It updates the neighbours of a single bird with already evaluated candidates.
+If the bird keeps some of its neighbours (k < s->k), its worst s->X neighbours are moved to the end of the array, where they will be
+overwritten by the shared ones.
 Parameters:
 s: search space
 b: current bird
 k: number of neighbours updated
-Evaluate: pointer to the function used to evaluate birds
-arg: list of additional arguments */
-void UpdateNeighbours(SearchSpace *s, int b, int k, prtFun Evaluate, va_list arg)
+candidate: array of k evaluated candidate neighbours */
+void UpdateNeighbours(SearchSpace *s, int b, int k, Agent **candidate)
 {
     if (!s)
     {
         fprintf(stderr, "\nSearch space not allocated @UpdateNeighbours.\n");
         exit(-1);
     }
-    int i, j;
-    double f;
-    va_list argtmp;
-
-    va_copy(argtmp, arg);
+    int i;
 
     for (i = 0; i < k; i++)
     {
-        for (j = 0; j < s->n; j++)
-            s->a[b]->nb[i]->x[j] = GenerateUniformRandomNumber(s->LB[j], s->UB[j]);
+        memcpy(s->a[b]->nb[i]->x, candidate[i]->x, s->n * sizeof(double));
+        s->a[b]->nb[i]->fit = candidate[i]->fit;
+    }
 
-        f = Evaluate(s->a[b]->nb[i], arg); /* It executes the fitness function for neighbour i */
-        s->a[b]->nb[i]->fit = f;           /* It updates the fitness value of actual neighbour i */
+    if (k < s->k)
+        SelectAgents(s->a[b]->nb, s->k, s->k - s->X);
+    else
+        SelectNeighbours(s, b);
+}
 
-        va_copy(arg, argtmp);
+/* It partially sorts the neighbours of a bird: the best X + 1 ones come first in ascending order of fitness, and the worst X ones come last
+Parameters:
+s: search space
+b: current bird */
+void SelectNeighbours(SearchSpace *s, int b)
+{
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @SelectNeighbours.\n");
+        exit(-1);
     }
-    qsort(s->a[b]->nb, s->k, sizeof(Agent **), SortAgent); /* It sorts the neighbours */
+    int top = (int)fmin(s->X + 1, s->k);
+
+    SelectAgents(s->a[b]->nb, s->k, top);
+    qsort(s->a[b]->nb, top, sizeof(Agent **), SortAgent);
+    if (s->k - top > s->X) /* the worst ones are not among the best ones */
+        SelectAgents(s->a[b]->nb + top, s->k - top, s->k - top - s->X);
 }
 
 /* It shares the neighbours to the following bird
@@ -59,29 +93,19 @@ void ShareNeighbours(SearchSpace *s)
         fprintf(stderr, "\nSearch space not allocated @ShareNeighbours.\n");
         exit(-1);
     }
-    int i, j, k;
+    int i, b, from;
 
-    for (i = 0; i < s->X; i++)
-    { /* It distribuites the X best neighbours (except the first) to the following birds of leader (1st and 2nd) */
-        for (j = 0; j < s->n; j++)
-            s->a[1]->nb[(s->k) - (s->X) + i]->x[j] = s->a[2]->nb[(s->k) - (s->X) + i]->x[j] = s->a[0]->nb[i + 1]->x[j];
-        s->a[1]->nb[(s->k) - (s->X) + i]->fit = s->a[2]->nb[(s->k) - (s->X) + i]->fit = s->a[0]->nb[i + 1]->fit;
-    }
-    qsort(s->a[1]->nb, s->k, sizeof(Agent **), SortAgent); /* It sorts the new neighbours */
-    qsort(s->a[2]->nb, s->k, sizeof(Agent **), SortAgent);
-
-    if (s->m > 3)
+    /* It distributes the X best neighbours (except the first) to the following birds: the 1st and 2nd ones follow the leader,
+    and every other bird follows the bird two positions ahead of it */
+    for (b = 1; b < s->m; b++)
     {
-        for (k = 1; k < s->m - 2; k++)
-        { /* It distributes the X best neighbours (except the first) to the following birds */
-            for (i = 0; i < s->X; i++)
-            {
-                for (j = 0; j < s->n; j++)
-                    s->a[k + 2]->nb[(s->k) - (s->X) + i]->x[j] = s->a[k]->nb[i + 1]->x[j];
-                s->a[k + 2]->nb[(s->k) - (s->X) + i]->fit = s->a[k]->nb[i + 1]->fit;
-            }
-            qsort(s->a[k + 2]->nb, s->k, sizeof(Agent **), SortAgent); /* It sorts the new neighbours */
+        from = (b < 3) ? 0 : b - 2;
+        for (i = 0; i < s->X; i++)
+        {
+            memcpy(s->a[b]->nb[(s->k) - (s->X) + i]->x, s->a[from]->nb[i + 1]->x, s->n * sizeof(double));
+            s->a[b]->nb[(s->k) - (s->X) + i]->fit = s->a[from]->nb[i + 1]->fit;
         }
+        SelectNeighbours(s, b); /* It selects the best new neighbours */
     }
 }
 
@@ -116,8 +140,9 @@ arg: list of additional arguments */
 void runMBO(SearchSpace *s, prtFun Evaluate, ...)
 {
     va_list arg, argtmp;
-    int i, j, t, k, tour;
-    double beta, prob;
+    int i, j, t, k, tour, n_candidates;
+    double *block = NULL;
+    Agent *candidate_data = NULL, **candidate = NULL;
 
     va_start(arg, Evaluate);
     va_copy(argtmp, arg);
@@ -128,33 +153,69 @@ void runMBO(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    /* The leader gets k new neighbours per tour and every other bird gets k - X, which are stored in a single contiguous block */
+    n_candidates = s->k + (s->m - 1) * (s->k - s->X);
+    block = (double *)malloc(n_candidates * s->n * sizeof(double));
+    candidate_data = (Agent *)calloc(n_candidates, sizeof(Agent));
+    candidate = (Agent **)malloc(n_candidates * sizeof(Agent *));
+    for (i = 0; i < n_candidates; i++)
+    {
+        candidate_data[i].n = s->n;
+        candidate_data[i].x = block + i * s->n;
+        candidate_data[i].fit = DBL_MAX;
+        candidate[i] = &candidate_data[i];
+    }
+
+    if (s->numa)
+    { /* the block is first touched by the workers that evaluate each neighbour (see SetNUMASearchSpace) */
+#pragma omp parallel num_threads(s->n_threads) if (s->n_threads > 1)
+        {
+            PinWorker(s);
+#pragma omp for schedule(static)
+            for (i = 0; i < n_candidates; i++)
+                memset(candidate[i]->x, 0, s->n * sizeof(double));
+            UnpinWorker();
+        }
+    }
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _MBO_, Evaluate, arg);   /* Initial evaluation */
     qsort(s->a, s->m, sizeof(Agent **), SortAgent); /* Initial bird sort */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
-        va_copy(arg, argtmp);
 
         /* for each tour */
         for (tour = 0; tour < s->M; tour++)
         {
-            UpdateNeighbours(s, 0, s->k, Evaluate, arg); /* It generates the k neighbours of leader */
+            va_copy(arg, argtmp);
+            GenerateNeighbours(s, candidate, n_candidates);
+            EvaluateBatch(s, candidate, n_candidates, Evaluate, arg); /* It evaluates the new neighbours of all birds at once */
 
-            for (k = 1; k < s->m; k++)
-            { /* It generates the k-X neighbours of each bird */
-                UpdateNeighbours(s, k, s->k - s->X, Evaluate, arg);
-                va_copy(arg, argtmp);
-            }
+            UpdateNeighbours(s, 0, s->k, candidate); /* the k neighbours of leader */
+            for (k = 1; k < s->m; k++) /* the k-X neighbours of each bird */
+                UpdateNeighbours(s, k, s->k - s->X, candidate + s->k + (k - 1) * (s->k - s->X));
 
             ShareNeighbours(s);
             ImproveBirds(s);
         }
 
         qsort(s->a, s->m, sizeof(Agent **), SortAgent); /* It replaces the leader with the best bird and sorts the birds flock*/
+
+        if (s->a[0]->fit < s->gfit)
+        { /* update the global best */
+            s->gfit = s->a[0]->fit;
+            for (j = 0; j < s->n; j++)
+                s->g[j] = s->a[0]->x[j];
+        }
+
         //ShowSearchSpace(s, _MBO_);
         fprintf(stderr, "OK (minimum fitness value %lf)", s->a[0]->fit);
     }
 
+    free(candidate);
+    free(candidate_data);
+    free(block);
     va_end(arg);
-}
\ No newline at end of file
+}
@@ -77,9 +77,16 @@ void runPSO(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    if (s->is_binary_opt)
+    {
+        fprintf(stderr, "\nBinary search spaces must be optimized by runBPSO @runPSO.\n");
+        exit(-1);
+    }
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _PSO_, Evaluate, arg); /* Initial evaluation */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
         va_copy(arg, argtmp);
@@ -122,12 +129,19 @@ void runAIWPSO(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    if (s->is_binary_opt)
+    {
+        fprintf(stderr, "\nBinary search spaces must be optimized by runBPSO @runAIWPSO.\n");
+        exit(-1);
+    }
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateSearchSpace(s, _PSO_, Evaluate, arg); /* Initial evaluation */
 
     for (i = 0; i < s->m; i++)
         s->a[i]->pfit = s->a[i]->fit;
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
         va_copy(arg, argtmp);
@@ -179,6 +193,186 @@ double ComputeSuccess(SearchSpace *s)
 }
 /****************************/
 
+/* MOPSO-related functions */
+/* It executes the Multi-Objective Particle Swarm Optimization for the minimization of several objectives. The non-dominated
+solutions found so far are kept by the archive of the search space (s->archive), which must be created beforehand and is the
+outcome of the run. Each particle follows its personal best and a leader drawn from the archive, which takes the place of the
+global best (s->g). A personal best is replaced by a new position that dominates it, or at random if neither dominates the other.
+Parameters:
+s: search space
+Evaluate: pointer to the function used to evaluate the objectives of particles
+arg: list of additional arguments */
+void runMOPSO(SearchSpace *s, prtMOFun Evaluate, ...)
+{
+    va_list arg, argtmp;
+    int t, i, l, M;
+    double *f = NULL, *pf = NULL;
+
+    va_start(arg, Evaluate);
+    va_copy(argtmp, arg);
+
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @runMOPSO.\n");
+        exit(-1);
+    }
+
+    if (!s->archive || (s->archive->n != s->n))
+    {
+        fprintf(stderr, "\nArchive not allocated or with a different number of decision variables @runMOPSO.\n");
+        exit(-1);
+    }
+
+    M = s->archive->n_objectives;
+    f = (double *)malloc((size_t)s->m * M * sizeof(double));  /* objectives of the particles */
+    pf = (double *)malloc((size_t)s->m * M * sizeof(double)); /* objectives of the personal bests */
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
+    EvaluateObjectivesBatch(s, s->a, s->m, Evaluate, f, arg); /* Initial evaluation */
+
+    for (i = 0; i < s->m; i++)
+        memcpy(s->a[i]->xl, s->a[i]->x, s->n * sizeof(double));
+    memcpy(pf, f, (size_t)s->m * M * sizeof(double));
+
+    for (t = 1; !StopOptimization(s, t); t++)
+    {
+        fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
+        va_copy(arg, argtmp);
+
+        /* for each particle */
+        for (i = 0; i < s->m; i++)
+        {
+            l = SelectArchiveLeader(s->archive);
+            if (l >= 0)
+                memcpy(s->g, s->archive->X + (size_t)l * s->n, s->n * sizeof(double));
+            else /* no feasible solution has been found so far */
+                memcpy(s->g, s->a[i]->xl, s->n * sizeof(double));
+
+            UpdateParticleVelocity(s, i);
+            UpdateParticlePosition(s, i);
+            CheckAgentLimits(s, s->a[i]);
+        }
+
+        EvaluateObjectivesBatch(s, s->a, s->m, Evaluate, f, arg);
+
+        for (i = 0; i < s->m; i++)
+        {
+            if (Dominates(pf + (size_t)i * M, f + (size_t)i * M, M))
+                continue;
+            if (Dominates(f + (size_t)i * M, pf + (size_t)i * M, M) || (GenerateUniformRandomNumber(0, 1) < 0.5))
+            {
+                memcpy(s->a[i]->xl, s->a[i]->x, s->n * sizeof(double));
+                memcpy(pf + (size_t)i * M, f + (size_t)i * M, M * sizeof(double));
+            }
+        }
+
+        fprintf(stderr, "OK (%d non-dominated solutions)", s->archive->size);
+    }
+
+    free(f);
+    free(pf);
+    va_end(arg);
+}
+/****************************/
+
+/* BPSO-related functions */
+/* It updates the velocity of an agent (particle) as PSO does, but with bits as positions, and then draws each bit of its
+position with a probability given by the sigmoid of the corresponding velocity. The bits are read and written a word at a time.
+Parameters:
+s: binary search space
+i: particle's index
+r: n numbers drawn from a uniform distribution within [0,1] */
+void UpdateBinaryParticle(SearchSpace *s, int i, double *r)
+{
+    double r1, r2, v;
+    int j, k, w, end, words;
+    uint64_t x, l, g, b;
+    Agent *a = NULL;
+
+    if (!s || !s->is_binary_opt)
+    {
+        fprintf(stderr, "\nBinary search space not allocated @UpdateBinaryParticle.\n");
+        exit(-1);
+    }
+
+    a = s->a[i];
+    words = getBinaryWords(s->n);
+    r1 = GenerateUniformRandomNumber(0, 1);
+    r2 = GenerateUniformRandomNumber(0, 1);
+
+    for (w = 0; w < words; w++)
+    {
+        x = a->b[w];
+        l = a->bl[w];
+        g = s->gb[w];
+        b = 0;
+        end = (w < words - 1) ? BINARY_WORD_SIZE : s->n - w * BINARY_WORD_SIZE;
+        for (k = 0; k < end; k++)
+        {
+            j = w * BINARY_WORD_SIZE + k;
+            v = s->w * a->v[j] + s->c1 * r1 * ((double)((l >> k) & 1) - (double)((x >> k) & 1)) + s->c2 * r2 * ((double)((g >> k) & 1) - (double)((x >> k) & 1));
+            if (v > BPSO_MAX_VELOCITY)
+                v = BPSO_MAX_VELOCITY;
+            else if (v < -BPSO_MAX_VELOCITY)
+                v = -BPSO_MAX_VELOCITY;
+            a->v[j] = v;
+
+            if (r[j] < 1 / (1 + exp(-v)))
+                b |= (uint64_t)1 << k;
+        }
+        a->b[w] = b;
+    }
+}
+
+/* It executes the Binary Particle Swarm Optimization for function minimization. The search space must be a binary one
+(see SetBinarySearchSpace), so the fitness function reads the position of each agent at a->b. Only the positions and local
+bests are packed: every particle still keeps one real-valued velocity per bit (a->v), which dominates its memory footprint.
+Parameters:
+s: search space
+Evaluate: pointer to the function used to evaluate particles
+arg: list of additional arguments */
+void runBPSO(SearchSpace *s, prtFun Evaluate, ...)
+{
+    va_list arg, argtmp;
+    int t, i;
+    double *r = NULL;
+
+    va_start(arg, Evaluate);
+    va_copy(argtmp, arg);
+
+    if (!s || !s->is_binary_opt)
+    {
+        fprintf(stderr, "\nBinary search space not allocated @runBPSO.\n");
+        exit(-1);
+    }
+
+    r = (double *)malloc(s->n * sizeof(double));
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
+    EvaluateBinarySearchSpace(s, Evaluate, arg); /* Initial evaluation */
+
+    for (t = 1; !StopOptimization(s, t); t++)
+    {
+        fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
+        va_copy(arg, argtmp);
+
+        /* for each particle */
+        for (i = 0; i < s->m; i++)
+        {
+            GenerateUniformRandomArray(r, s->n, 0, 1);
+            UpdateBinaryParticle(s, i, r);
+        }
+
+        EvaluateBinarySearchSpace(s, Evaluate, arg);
+
+        fprintf(stderr, "OK (minimum fitness value %lf)", s->gfit);
+    }
+
+    free(r);
+    va_end(arg);
+}
+/****************************/
+
 /* TensorPSO-related functions */
 /* It updates the velocity of an tensor (particle)
 Parameters:
@@ -249,9 +443,10 @@ void runTensorPSO(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _PSO_, tensor_id, Evaluate, arg); /* Initial evaluation */
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
         va_copy(arg, argtmp);
@@ -294,12 +489,13 @@ void runTensorAIWPSO(SearchSpace *s, int tensor_id, prtFun Evaluate, ...)
         exit(-1);
     }
 
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
     EvaluateTensorSearchSpace(s, _PSO_, tensor_id, Evaluate, arg); /* Initial evaluation */
 
     for (i = 0; i < s->m; i++)
         s->a[i]->pfit = s->a[i]->fit;
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
         va_copy(arg, argtmp);
@@ -22,9 +22,9 @@ double ran2(int *idum)
 {
     int j;
     int k;
-    static int idum2 = 123456789;
-    static int iy = 0;
-    static int iv[NTAB];
+    static RAND_THREAD_LOCAL int idum2 = 123456789;
+    static RAND_THREAD_LOCAL int iy = 0;
+    static RAND_THREAD_LOCAL int iv[NTAB];
     double temp;
 
     if (*idum <= 0)
@@ -83,7 +83,7 @@ double ran2(int *idum)
 #undef EPS
 #undef RNMX
 
-static int randx = 0; /* copy of random seed (internal use only) */
+static RAND_THREAD_LOCAL int randx = 0; /* copy of random seed (internal use only) */
 
 /* It initializes the random number generator */
 int srandinter(int seed)
@@ -103,6 +103,22 @@ double randinter(double a, double b)
     return a + (b - a) * ((double)ran2(&randx));
 }
 
+/* It fills an array with numbers uniformly distributed within [a,b]. The generator is seeded once for the whole array.
+Parameters:
+out: output array
+n: number of samples
+a: lower bound
+b: upper bound */
+void randinterArray(double *out, int n, double a, double b)
+{
+    int i;
+
+    if (randx == 0)
+        srandinter(0);
+    for (i = 0; i < n; i++)
+        out[i] = a + (b - a) * ((double)ran2(&randx));
+}
+
 /* It returns a number drawn from a Gaussian distribution
 Parameters:
 mean: mean of the distribution
@@ -112,13 +128,41 @@ double randGaussian(double mean, double variance)
     double v, x, y, r;
 
     do
-    {
-        x = (double)2 * randinter(1, 100) / 99;
-        y = (double)2 * randinter(1, 100) / 99;
+    { /* (x, y) must be drawn from the whole square [-1,1]x[-1,1] with full resolution */
+        x = 2 * randinter(0, 1) - 1;
+        y = 2 * randinter(0, 1) - 1;
         r = x * x + y * y;
     } while (r >= 1 || r == 0);
 
     v = x * sqrt(-2 * log(r) / r) * variance + mean;
 
     return v;
-}
\ No newline at end of file
+}
+
+/* It fills an array with numbers drawn from a Gaussian distribution using the Box-Muller transform.
+The uniform numbers are drawn first, and then transformed in a second loop with no branches, which can be vectorized by the compiler.
+Parameters:
+out: output array
+n: number of samples
+mean: mean of the distribution
+variance: variance of the distribution (it is applied as a scale factor, as in randGaussian) */
+void randGaussianArray(double *out, int n, double mean, double variance)
+{
+    int i, half = n / 2;
+    double r, theta;
+
+    for (i = 0; i < 2 * half; i++)
+        out[i] = randinter(0, 1);
+
+#pragma omp simd private(r, theta)
+    for (i = 0; i < half; i++)
+    {
+        r = sqrt(-2 * log(1 - out[2 * i])); /* 1 - u lies in (0,1], which avoids log(0) */
+        theta = 2 * M_PI * out[2 * i + 1];
+        out[2 * i] = r * cos(theta) * variance + mean;
+        out[2 * i + 1] = r * sin(theta) * variance + mean;
+    }
+
+    if (n % 2)
+        out[n - 1] = randGaussian(mean, variance);
+}
@@ -0,0 +1,138 @@
+/*Copyright 2018 LibOpt Authors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "restart.h"
+
+/* It executes an optimization technique with restarts. Each run stops when it stagnates (s->stop.max_stagnation, or
+RESTART_STAGNATION iterations if it is not set) or reaches s->iterations. The search space is then resized and re-initialized,
+and the technique is executed again. The evaluation budget and the wall-clock deadline of s->stop are shared by all runs,
+and the global best across all runs is stored in s->g and s->gfit at the end.
+The fitness function is called with no additional arguments.
+Parameters:
+s: search space (its current number of agents is used by the first run)
+opt_id: identifier of the optimization technique
+strategy: restart strategy (_IPOP_ or _BIPOP_)
+max_restarts: maximum number of restarts
+run: pointer to the function that runs the optimization technique (e.g., runPSO)
+Evaluate: pointer to the function used to evaluate agents */
+void runRestart(SearchSpace *s, int opt_id, int strategy, int max_restarts, prtRun run, prtFun Evaluate)
+{
+    int r, i, j, m, m0, m_large, max_stagnation;
+    char is_large;
+    long int budget, spent = 0, evals_large = 0, evals_small = 0;
+    double max_time, start_time, elapsed, u, best_fit = DBL_MAX, *best_x = NULL;
+
+    if (!s)
+    {
+        fprintf(stderr, "\nSearch space not allocated @runRestart.\n");
+        exit(-1);
+    }
+
+    if (!run || ((strategy != _IPOP_) && (strategy != _BIPOP_)) || (max_restarts < 0))
+    {
+        fprintf(stderr, "\nInvalid input parameters @runRestart.\n");
+        exit(-1);
+    }
+
+    m0 = s->m;
+    m_large = m0;
+    budget = s->stop.max_evaluations;
+    max_time = s->stop.max_time;
+    max_stagnation = s->stop.max_stagnation;
+    if (!s->stop.max_stagnation)
+        s->stop.max_stagnation = RESTART_STAGNATION;
+
+    best_x = (double *)malloc(s->n * sizeof(double));
+    start_time = GetWallClockTime();
+
+    for (r = 0; r <= max_restarts; r++)
+    {
+        /* sharing the evaluation budget and the deadline among the runs */
+        if (budget > 0)
+        {
+            if (spent >= budget)
+                break;
+            s->stop.max_evaluations = budget - spent;
+        }
+        if (max_time > 0)
+        {
+            elapsed = GetWallClockTime() - start_time;
+            if (elapsed >= max_time)
+                break;
+            s->stop.max_time = max_time - elapsed;
+        }
+
+        /* computing the number of agents of this run */
+        is_large = 1;
+        if (r == 0)
+            m = m0;
+        else if ((strategy == _BIPOP_) && (evals_small < evals_large))
+        { /* small regime: a population between m0 and half of the last large one */
+            is_large = 0;
+            u = GenerateUniformRandomNumber(0, 1);
+            m = (int)floor(m0 * pow(0.5 * m_large / m0, u * u));
+            if (m < m0)
+                m = m0;
+        }
+        else
+        { /* large regime */
+            m_large *= RESTART_FACTOR;
+            m = m_large;
+        }
+
+        fprintf(stderr, "\n\nRestart %d/%d with %d agents ***", r, max_restarts, m);
+
+        ResizeSearchSpace(s, m, opt_id);
+        InitializeSearchSpace(s, opt_id);
+        for (i = 0; i < s->m; i++)
+        {
+            s->a[i]->fit = DBL_MAX;
+            s->a[i]->pfit = DBL_MAX;
+        }
+        s->gfit = DBL_MAX;
+        s->gcv = DBL_MAX;
+
+        run(s, Evaluate);
+
+        spent += s->stop.n_evaluations;
+        if (is_large)
+            evals_large += s->stop.n_evaluations;
+        else
+            evals_small += s->stop.n_evaluations;
+
+        if (s->gfit < best_fit)
+        { /* keeping the global best across restarts */
+            best_fit = s->gfit;
+            for (j = 0; j < s->n; j++)
+                best_x[j] = s->g[j];
+        }
+
+        if ((s->stop.reason == _STOP_EVALUATIONS_) || (s->stop.reason == _STOP_TIME_))
+            break;
+    }
+
+    s->gfit = best_fit;
+    for (j = 0; j < s->n; j++)
+        s->g[j] = best_x[j];
+
+    s->stop.max_evaluations = budget;
+    s->stop.max_time = max_time;
+    s->stop.max_stagnation = max_stagnation;
+    s->stop.n_evaluations = spent;
+
+    fprintf(stderr, "\n\nRestarts finished after %ld evaluations (minimum fitness value %lf)\n", spent, s->gfit);
+
+    free(best_x);
+}
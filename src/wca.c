@@ -16,102 +16,127 @@ limitations under the License.
 
 #include "wca.h"
 
-int *FlowIntensity(SearchSpace *s)
+/* It computes the number of streams that flow to the sea (flow[0]) and to each river (flow[1..nsr]), which is proportional to their fitness values
+Parameters:
+s: search space, whose first nsr + 1 agents are the sea and the rivers
+flow: array with nsr + 1 positions */
+void FlowIntensity(SearchSpace *s, int *flow)
 {
-    int *flow = NULL, i;
-    double tmp = 0, sum_fitness;
-
-    flow = (int *)calloc(s->nsr + 1, sizeof(int));
-
-    sum_fitness = 0;
+    int i, n_streams = s->m - (s->nsr + 1), remaining = n_streams;
+    double sum_fitness = 0;
 
     for (i = 0; i < s->nsr + 1; i++)
-    {
         sum_fitness += s->a[i]->fit;
-    }
 
-    for (i = 0; i < s->nsr + 1; i++)
+    for (i = s->nsr; i >= 1; i--)
     {
-        tmp = round(fabs(s->a[i]->fit / sum_fitness) * (s->m - (s->nsr + 1)));
-        flow[i] = tmp;
+        flow[i] = (sum_fitness != 0) ? (int)round(fabs(s->a[i]->fit / sum_fitness) * n_streams) : 0;
+        if (flow[i] > remaining)
+            flow[i] = remaining;
+        remaining -= flow[i];
     }
-
-    return flow;
+    flow[0] = remaining; /* the sea takes the streams that are left */
 }
 
-void UpdateStreamPosition(SearchSpace *s, int *flow, double c)
+/* It moves every stream toward its river or the sea and every river toward the sea as a single pass over the population
+Parameters:
+s: search space
+guide: array that gives the rank (0 for the sea, 1..nsr for the rivers) each raindrop flows to
+r: array of random numbers, one per raindrop
+c: constant within [1,2] */
+void UpdateStreamPosition(SearchSpace *s, int *guide, double *r, double c)
 {
-    int k, i, j, flow_count = 0;
-    double tmp, rand;
+    int i, j;
 
-    /* Streams flow to rivers */
-    for (k = 1; k < s->nsr + 1; k++)
+    /* Streams flow to rivers and to the sea. Rivers do not move during this pass, so every stream is independent */
+#pragma omp parallel for private(j) num_threads(s->n_threads) if (s->n_threads > 1)
+    for (i = s->nsr + 1; i < s->m; i++)
     {
-        flow_count = flow_count + flow[k];
-        for (i = (flow_count - flow[k]); i <= flow_count; i++)
-        {
-            rand = GenerateUniformRandomNumber(0, 1);
-            for (j = 0; j < s->n; j++)
-            {
-                tmp = s->a[i]->x[j] + rand * c * (s->a[k]->x[j] - s->a[i]->x[j]);
-                s->a[i]->x[j] = tmp;
-            }
-        }
-    }
+        double *x = s->a[i]->x, *y = s->a[guide[i]]->x, step = r[i] * c;
 
-    /* Streams flow to the sea */
-    for (i = s->nsr + 1; i <= flow[0]; i++)
-    {
-        rand = GenerateUniformRandomNumber(0, 1);
+#pragma omp simd
         for (j = 0; j < s->n; j++)
-        {
-            tmp = s->a[i]->x[j] + rand * c * (s->a[s->best]->x[j] - s->a[i]->x[j]);
-            s->a[i]->x[j] = tmp;
-        }
+            x[j] += step * (y[j] - x[j]);
+
+        CheckAgentLimits(s, s->a[i]);
     }
 }
 
-void UpdateRiverPosition(SearchSpace *s, double c)
+/* It moves every river toward the sea
+Parameters:
+s: search space
+r: array of random numbers, one per raindrop
+c: constant within [1,2] */
+void UpdateRiverPosition(SearchSpace *s, double *r, double c)
 {
     int i, j;
-    double tmp = 0, rand;
+    double *sea = s->a[0]->x;
 
     /* Rivers flow to the sea */
     for (i = 1; i < s->nsr + 1; i++)
     {
-        rand = GenerateUniformRandomNumber(0, 1);
+        double *x = s->a[i]->x, step = r[i] * c;
+
+#pragma omp simd
         for (j = 0; j < s->n; j++)
-        {
-            tmp = s->a[i]->x[j] + rand * c * (s->a[s->best]->x[j] - s->a[i]->x[j]);
-            s->a[i]->x[j] = tmp;
-        }
+            x[j] += step * (sea[j] - x[j]);
+
+        CheckAgentLimits(s, s->a[i]);
     }
 }
 
-void RainingProcess(SearchSpace *s, int *flow)
+/* It exchanges the roles of a stream and its river (or a river and the sea) whenever the former is better than the latter,
+which keeps the sea and the rivers ranked without sorting the population
+Parameters:
+s: search space
+guide: array that gives the rank (0 for the sea, 1..nsr for the rivers) each raindrop flows to */
+void UpdateRanking(SearchSpace *s, int *guide)
 {
-    int i, j;
-    double tmp, rand, dist;
+    int i;
+    Agent *aux = NULL;
+
+    for (i = s->nsr + 1; i < s->m; i++)
+    {
+        if (s->a[i]->fit < s->a[guide[i]]->fit)
+        {
+            aux = s->a[i];
+            s->a[i] = s->a[guide[i]];
+            s->a[guide[i]] = aux;
+        }
+    }
 
     for (i = 1; i < s->nsr + 1; i++)
     {
-        rand = GenerateUniformRandomNumber(0, 1);
-        dist = EuclideanDistance(s->a[0]->x, s->a[i]->x, s->n); /* It obtains the euclidean distance for further use */
-        if ((dist < s->dmax) || (rand < 0.1))
+        if (s->a[i]->fit < s->a[0]->fit)
         {
-            DestroyAgent(&(s->a[i]), _WCA_);
-            s->a[i] = GenerateNewAgent(s, _WCA_);
+            aux = s->a[i];
+            s->a[i] = s->a[0];
+            s->a[0] = aux;
         }
     }
+}
 
-    for (i = s->nsr + 1; i < flow[0]; i++)
+/* It reinitializes, in place, the rivers and the streams of the sea that get too close to the sea
+Parameters:
+s: search space
+guide: array that gives the rank (0 for the sea, 1..nsr for the rivers) each raindrop flows to */
+void RainingProcess(SearchSpace *s, int *guide)
+{
+    int i, j;
+    double rand, dist;
+
+    for (i = 1; i < s->m; i++)
     {
+        if ((i > s->nsr) && (guide[i] != 0)) /* only the rivers and the streams that flow to the sea evaporate */
+            continue;
+
         rand = GenerateUniformRandomNumber(0, 1);
         dist = EuclideanDistance(s->a[0]->x, s->a[i]->x, s->n); /* It obtains the euclidean distance for further use */
         if ((dist < s->dmax) || (rand < 0.1))
         {
-            DestroyAgent(&(s->a[i]), _WCA_);
-            s->a[i] = GenerateNewAgent(s, _WCA_);
+            for (j = 0; j < s->n; j++)
+                s->a[i]->x[j] = GenerateUniformRandomNumber(s->LB[j], s->UB[j]);
+            s->a[i]->fit = DBL_MAX; /* it will be evaluated in the next iteration */
         }
     }
 }
@@ -124,9 +149,9 @@ arg: list of additional arguments */
 void runWCA(SearchSpace *s, prtFun Evaluate, ...)
 {
     va_list arg, argtmp;
-    int t, i, *flow = NULL;
+    int t, i, j, k, *flow = NULL, *guide = NULL;
     double c = 2; /* c = [1,2]. The author recommends 2 as the best value */
-    Agent *tmp = NULL;
+    double *block = NULL, **x = NULL, *r = NULL;
 
     va_start(arg, Evaluate);
     va_copy(argtmp, arg);
@@ -137,29 +162,85 @@ void runWCA(SearchSpace *s, prtFun Evaluate, ...)
         exit(-1);
     }
 
-    EvaluateSearchSpace(s, _WCA_, Evaluate, arg); /* Initial evaluation of the search space */
-
-    qsort(s->a, s->m, sizeof(Agent **), SortAgent); /* Sorts all raindrops according to their fitness. First position gets the sea. */
+    /* During the run, the positions of all raindrops live in a single contiguous block */
+    block = (double *)malloc(s->m * s->n * sizeof(double));
+    x = (double **)malloc(s->m * sizeof(double *));
+    for (i = 0; i < s->m; i++)
+        x[i] = s->a[i]->x;
 
-    flow = FlowIntensity(s);
+    /* in the NUMA-aware mode, every row is first touched by the worker that evaluates it along the run (the sea is not
+    evaluated again), as EvaluateBatch follows the same static schedule (see SetNUMASearchSpace) */
+    memcpy(block, x[0], s->n * sizeof(double));
+#pragma omp parallel num_threads(s->n_threads) if (s->numa && (s->n_threads > 1))
+    {
+        PinWorker(s);
+#pragma omp for schedule(static)
+        for (i = 1; i < s->m; i++)
+            memcpy(block + i * s->n, x[i], s->n * sizeof(double));
+        UnpinWorker();
+    }
+    for (i = 0; i < s->m; i++)
+        s->a[i]->x = block + i * s->n;
+    flow = (int *)malloc((s->nsr + 1) * sizeof(int));
+    guide = (int *)malloc(s->m * sizeof(int));
+    r = (double *)malloc(s->m * sizeof(double));
+
+    ResetTermination(s); /* It starts counting evaluations, time and stagnation */
+    va_copy(arg, argtmp);
+    EvaluateBatch(s, s->a, s->m, Evaluate, arg); /* Initial evaluation of the search space */
+
+    /* Sorts all raindrops once. First position gets the sea and the next nsr ones get the rivers. */
+    SelectAgents(s->a, s->m, s->nsr + 1);
+    qsort(s->a, s->nsr + 1, sizeof(Agent **), SortAgent);
+    s->gfit = s->a[0]->fit;
+    for (j = 0; j < s->n; j++)
+        s->g[j] = s->a[0]->x[j];
+
+    /* It assigns the streams to the sea and to the rivers according to their flow intensity */
+    FlowIntensity(s, flow);
+    for (i = 0; i < s->nsr + 1; i++)
+        guide[i] = 0; /* the sea and the rivers flow to the sea */
+    for (i = 0, k = s->nsr + 1; i < s->nsr + 1; i++)
+        for (j = 0; j < flow[i]; j++)
+            guide[k++] = i;
 
-    for (t = 1; t <= s->iterations; t++)
+    for (t = 1; !StopOptimization(s, t); t++)
     {
         fprintf(stderr, "\nRunning iteration %d/%d ... ", t, s->iterations);
         va_copy(arg, argtmp);
 
-        UpdateStreamPosition(s, flow, c);
-        UpdateRiverPosition(s, c);
-        for (i = 0; i < s->m; i++)
-        {
-            CheckAgentLimits(s, s->a[i]);
+        for (i = 1; i < s->m; i++)
+            r[i] = GenerateUniformRandomNumber(0, 1);
+        UpdateStreamPosition(s, guide, r, c);
+        UpdateRiverPosition(s, r, c);
+
+        EvaluateBatch(s, s->a + 1, s->m - 1, Evaluate, arg); /* the sea does not move */
+        UpdateRanking(s, guide);
+
+        if (s->a[0]->fit < s->gfit)
+        { /* It updates the global best value and position */
+            s->gfit = s->a[0]->fit;
+            for (j = 0; j < s->n; j++)
+                s->g[j] = s->a[0]->x[j];
         }
-        EvaluateSearchSpace(s, _WCA_, Evaluate, arg);   /* Initial evaluation of the search space */
-        qsort(s->a, s->m, sizeof(Agent **), SortAgent); /* Sorts all raindrops according to their fitness. First position gets the sea. */
-        RainingProcess(s, flow);
+
+        RainingProcess(s, guide);
         s->dmax = s->dmax - (s->dmax / s->iterations);
         fprintf(stderr, "OK (minimum fitness value %lf)", s->gfit);
     }
+
+    /* the agents get their own position arrays back */
+    for (i = 0; i < s->m; i++)
+    {
+        k = (s->a[i]->x - block) / s->n; /* original owner of this row */
+        memcpy(x[k], s->a[i]->x, s->n * sizeof(double));
+        s->a[i]->x = x[k];
+    }
+
+    free(x);
+    free(block);
     free(flow);
+    free(guide);
+    free(r);
     va_end(arg);
 }